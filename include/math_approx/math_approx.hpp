@@ -15,3 +15,26 @@ namespace math_approx
 #include "src/sigmoid_approx.hpp"
 #include "src/wright_omega_approx.hpp"
 #include "src/polylogarithm_approx.hpp"
+
+#include "src/half_precision.hpp"
+#include "src/denormals.hpp"
+#include "src/bulk_approx.hpp"
+#include "src/quantized_lut.hpp"
+#include "src/normalization.hpp"
+#include "src/recurrent_gates.hpp"
+#include "src/rotary_embedding.hpp"
+#include "src/entropy.hpp"
+#include "src/adaa.hpp"
+#include "src/wdf_diodes.hpp"
+#include "src/oscillators.hpp"
+#include "src/oscillator_bank.hpp"
+#include "src/exponential_ramp.hpp"
+#include "src/phasor.hpp"
+#include "src/biquad_design.hpp"
+#include "src/unit_conversions.hpp"
+#include "src/windows.hpp"
+#include "src/companding.hpp"
+#include "src/spectrum.hpp"
+#include "src/random_variates.hpp"
+#include "src/oversampling.hpp"
+#include "src/fixed_point.hpp"
@@ -0,0 +1,433 @@
+#pragma once
+
+#include "basic_math.hpp"
+#include "hyperbolic_trig_approx.hpp"
+#include "log_approx.hpp"
+#include "polylogarithm_approx.hpp"
+#include "pow_approx.hpp"
+#include "sigmoid_approx.hpp"
+
+#include <cmath>
+#include <type_traits>
+
+namespace math_approx
+{
+// Antiderivative antialiasing (ADAA) waveshapers, following:
+// - Parker et al., "Reducing the Aliasing of Nonlinear Waveshaping Using Continuous-Time Convolution", DAFx 2016
+// - Bilbao et al., "Antiderivative Antialiasing for Memoryless Nonlinearities", IEEE SPL 2017
+//
+// Each "shaper" struct provides the nonlinearity (func), its first antiderivative (ad1),
+// and its second antiderivative (ad2), all of which work with scalars or XSIMD batches.
+//
+// Since these nonlinearities saturate, their second antiderivatives grow quadratically,
+// which leaves very little precision for the divided differences used by second-order ADAA.
+// So each shaper also describes the asymptotes of its first antiderivative (F1(x) ~ L x + c,
+// where L is the limit of f(x) as x goes to +/- infinity), and provides the "residual" of the
+// second antiderivative, after the asymptotic part (L x^2 / 2 + c x) is removed. The divided
+// differences of the asymptotic part are then computed without cancellation.
+
+namespace adaa_detail
+{
+    template <typename T>
+    T abs (T x)
+    {
+        using std::abs;
+#if defined(XSIMD_HPP)
+        using xsimd::abs;
+#endif
+        return abs (x);
+    }
+
+    template <typename T>
+    T copysign (T mag, T sign_source)
+    {
+        return select (sign_source < (T) 0, -mag, mag);
+    }
+
+    /**
+     * Returns select (ill_condition, fallback(), regular()). For scalar types, only
+     * the branch that is needed gets evaluated, while for SIMD types, both are.
+     */
+    template <typename Bool, typename Fallback, typename Regular>
+    auto select_conditioned (Bool ill_condition, Fallback&& fallback, Regular&& regular)
+    {
+        if constexpr (std::is_same_v<Bool, bool>)
+            return ill_condition ? fallback() : regular();
+        else
+            return select (ill_condition, fallback(), regular());
+    }
+
+    /** The asymptotic part of the second antiderivative of the shaper */
+    template <typename Shaper, typename T>
+    T ad2_asymptote (T x)
+    {
+        using S = scalar_of_t<T>;
+        const auto limit = select (x >= (T) 0, (T) (S) Shaper::positive_limit, (T) (S) Shaper::negative_limit);
+        return x * ((S) 0.5 * limit * x + (S) Shaper::ad1_offset);
+    }
+
+    /**
+     * The divided difference of the asymptotic part of the second antiderivative.
+     * When x0 and x1 have the same sign, this is L (x0 + x1) / 2 + c. Otherwise,
+     * the difference has no cancellation (unless the limits have the same sign,
+     * in which case the cancellation is no worse than for the full antiderivative).
+     */
+    template <typename Shaper, typename T>
+    T ad2_asymptote_divided_difference (T x0, T x1, T safe_delta)
+    {
+        using S = scalar_of_t<T>;
+        const auto sum = x0 + x1;
+        const auto limit = select (sum >= (T) 0, (T) (S) Shaper::positive_limit, (T) (S) Shaper::negative_limit);
+        const auto same_sign = (S) 0.5 * limit * sum + (S) Shaper::ad1_offset;
+        const auto mixed_sign = (ad2_asymptote<Shaper> (x0) - ad2_asymptote<Shaper> (x1)) / safe_delta;
+        return select (x0 * x1 >= (T) 0, same_sign, mixed_sign);
+    }
+
+    /**
+     * Returns log(1 + e) and Li2(-e), for e in (0, 1], using the reduction
+     * Li2(-e) = -Li2(e / (1 + e)) - log(1 + e)^2 / 2, so that only the
+     * [0, 1/2] range of the dilogarithm approximation is needed.
+     */
+    template <int log_order, int li2_order, typename T>
+    void log1p_li2_neg (T e, T& log1p_e, T& li2_neg_e)
+    {
+        const auto one_plus_e = (T) 1 + e;
+        log1p_e = log<log_order, true> (one_plus_e);
+        li2_neg_e = -li2_0_half<li2_order> (e / one_plus_e) - (scalar_of_t<T>) 0.5 * log1p_e * log1p_e;
+    }
+} // namespace adaa_detail
+
+/** Hard clipper: f(x) = clamp(x, -1, 1) */
+struct adaa_hard_clip
+{
+    static constexpr int positive_limit = 1;
+    static constexpr int negative_limit = -1;
+    static constexpr double ad1_offset = -0.5;
+
+    template <typename T>
+    static T func (T x)
+    {
+        return select (x > (T) 1, (T) 1, select (x < (T) -1, (T) -1, x));
+    }
+
+    template <typename T>
+    static T ad1 (T x)
+    {
+        using S = scalar_of_t<T>;
+        const auto a = adaa_detail::abs (x);
+        return select (a <= (T) 1, (S) 0.5 * x * x, a - (S) 0.5);
+    }
+
+    template <typename T>
+    static T ad2_residual (T x)
+    {
+        using S = scalar_of_t<T>;
+        const auto a = adaa_detail::abs (x);
+        const auto inside = x * (x * x * ((S) 1 / (S) 6) - (S) 0.5 * a + (S) 0.5);
+        const auto outside = adaa_detail::copysign (T ((S) 1 / (S) 6), x);
+        return select (a <= (T) 1, inside, outside);
+    }
+
+    template <typename T>
+    static T ad2 (T x)
+    {
+        return adaa_detail::ad2_asymptote<adaa_hard_clip> (x) + ad2_residual (x);
+    }
+};
+
+/** Cubic soft clipper: f(x) = 1.5 x - 0.5 x^3 for |x| <= 1, and sign(x) otherwise */
+struct adaa_soft_clip
+{
+    static constexpr int positive_limit = 1;
+    static constexpr int negative_limit = -1;
+    static constexpr double ad1_offset = -0.375;
+
+    template <typename T>
+    static T func (T x)
+    {
+        using S = scalar_of_t<T>;
+        const auto x_c = adaa_hard_clip::func (x);
+        return x_c * ((S) 1.5 - (S) 0.5 * x_c * x_c);
+    }
+
+    template <typename T>
+    static T ad1 (T x)
+    {
+        using S = scalar_of_t<T>;
+        const auto a = adaa_detail::abs (x);
+        const auto x_sq = x * x;
+        return select (a <= (T) 1, x_sq * ((S) 0.75 - (S) 0.125 * x_sq), a - (S) 0.375);
+    }
+
+    template <typename T>
+    static T ad2_residual (T x)
+    {
+        using S = scalar_of_t<T>;
+        const auto a = adaa_detail::abs (x);
+        const auto x_sq = x * x;
+        const auto inside = x * (x_sq * ((S) 0.25 - (S) 0.025 * x_sq) - (S) 0.5 * a + (S) 0.375);
+        const auto outside = adaa_detail::copysign (T ((S) 0.1), x);
+        return select (a <= (T) 1, inside, outside);
+    }
+
+    template <typename T>
+    static T ad2 (T x)
+    {
+        return adaa_detail::ad2_asymptote<adaa_soft_clip> (x) + ad2_residual (x);
+    }
+};
+
+/**
+ * Hyperbolic tangent: f(x) = tanh(x)
+ *
+ * The first antiderivative is log(cosh(x)) = |x| + log(1 + e^(-2|x|)) - log(2),
+ * and the second antiderivative (which is odd) is
+ * sign(x) (x^2 / 2 - |x| log(2) + Li2(-e^(-2|x|)) / 2 + pi^2 / 24).
+ */
+template <int tanh_order = 7, int exp_order = 6, int log_order = 6, int li2_order = 3>
+struct adaa_tanh
+{
+    static constexpr int positive_limit = 1;
+    static constexpr int negative_limit = -1;
+    static constexpr double ad1_offset = -M_LN2;
+
+    template <typename T>
+    static T func (T x)
+    {
+        return tanh<tanh_order> (x);
+    }
+
+    template <typename T>
+    static T ad1 (T x)
+    {
+        using S = scalar_of_t<T>;
+        const auto a = adaa_detail::abs (x);
+        const auto log1p_e = log<log_order, true> ((T) 1 + exp<exp_order> ((S) -2 * a));
+        return a + log1p_e - (S) M_LN2;
+    }
+
+    template <typename T>
+    static T ad2_residual (T x)
+    {
+        using S = scalar_of_t<T>;
+        constexpr auto pisq_o_24 = (S) (M_PI * M_PI / 24.0);
+
+        T log1p_e, li2_neg_e;
+        adaa_detail::log1p_li2_neg<log_order, li2_order> (exp<exp_order> ((S) -2 * adaa_detail::abs (x)), log1p_e, li2_neg_e);
+        return adaa_detail::copysign ((S) 0.5 * li2_neg_e + pisq_o_24, x);
+    }
+
+    template <typename T>
+    static T ad2 (T x)
+    {
+        return adaa_detail::ad2_asymptote<adaa_tanh> (x) + ad2_residual (x);
+    }
+};
+
+/**
+ * Sigmoid: f(x) = 1 / (1 + e^(-x))
+ *
+ * The first antiderivative is softplus(x) = max(x, 0) + log(1 + e^(-|x|)),
+ * and the second antiderivative is -Li2(-e^x) - pi^2 / 12, which is evaluated
+ * as x^2 / 2 + Li2(-e^(-x)) + pi^2 / 12 for x >= 0 to avoid overflow.
+ */
+template <int sigmoid_order = 7, int exp_order = 6, int log_order = 6, int li2_order = 3>
+struct adaa_sigmoid
+{
+    static constexpr int positive_limit = 1;
+    static constexpr int negative_limit = 0;
+    static constexpr double ad1_offset = 0.0;
+
+    template <typename T>
+    static T func (T x)
+    {
+        return sigmoid<sigmoid_order> (x);
+    }
+
+    template <typename T>
+    static T ad1 (T x)
+    {
+        const auto log1p_e = log<log_order, true> ((T) 1 + exp<exp_order> (-adaa_detail::abs (x)));
+        return select (x > (T) 0, x, (T) 0) + log1p_e;
+    }
+
+    template <typename T>
+    static T ad2_residual (T x)
+    {
+        using S = scalar_of_t<T>;
+        constexpr auto pisq_o_12 = (S) (M_PI * M_PI / 12.0);
+
+        T log1p_e, li2_neg_e;
+        adaa_detail::log1p_li2_neg<log_order, li2_order> (exp<exp_order> (-adaa_detail::abs (x)), log1p_e, li2_neg_e);
+        return adaa_detail::copysign (li2_neg_e + pisq_o_12, x);
+    }
+
+    template <typename T>
+    static T ad2 (T x)
+    {
+        return adaa_detail::ad2_asymptote<adaa_sigmoid> (x) + ad2_residual (x);
+    }
+};
+
+/**
+ * First-order ADAA waveshaper:
+ * y[n] = (F1(x[n]) - F1(x[n-1])) / (x[n] - x[n-1]),
+ * falling back to f((x[n] + x[n-1]) / 2) when the inputs are
+ * too close together for the division to be well-conditioned.
+ *
+ * T may be a scalar, or an XSIMD batch, in which case each
+ * lane is processed as an independent channel.
+ */
+template <typename Shaper, typename T = float>
+class first_order_adaa
+{
+public:
+    using S = scalar_of_t<T>;
+
+    explicit first_order_adaa (S ill_condition_tolerance = (S) 1.0e-3)
+        : tolerance (ill_condition_tolerance)
+    {
+        reset();
+    }
+
+    /** Resets the waveshaper state, as though the previous input was x */
+    void reset (T x = T ((S) 0))
+    {
+        x1 = x;
+        ad1_x1 = Shaper::ad1 (x);
+    }
+
+    /** Processes a single sample */
+    T process (T x)
+    {
+        const auto ad1_x = Shaper::ad1 (x);
+        const auto delta = x - x1;
+        const auto ill_condition = adaa_detail::abs (delta) < (T) tolerance;
+        const auto y = adaa_detail::select_conditioned (
+            ill_condition,
+            [&]
+            { return Shaper::func ((S) 0.5 * (x + x1)); },
+            [&]
+            { return (ad1_x - ad1_x1) / select (ill_condition, (T) 1, delta); });
+
+        x1 = x;
+        ad1_x1 = ad1_x;
+        return y;
+    }
+
+    /** Processes a block of samples in-place */
+    void process_block (T* data, size_t N)
+    {
+        for (size_t n = 0; n < N; ++n)
+            data[n] = process (data[n]);
+    }
+
+private:
+    S tolerance;
+    T x1 {};
+    T ad1_x1 {};
+};
+
+/**
+ * Second-order ADAA waveshaper:
+ * y[n] = 2 / (x[n] - x[n-2]) * (D[n] - D[n-1]),
+ * where D[n] = (F2(x[n]) - F2(x[n-1])) / (x[n] - x[n-1]).
+ *
+ * When x[n] and x[n-1] are too close, D[n] falls back to F1 at their midpoint,
+ * and when x[n] and x[n-2] are too close, the output falls back to the limit of the
+ * expression above as x[n] -> x[n-2] (see midpoint_fallback()).
+ * Note that second-order ADAA introduces one sample of delay.
+ *
+ * T may be a scalar, or an XSIMD batch, in which case each
+ * lane is processed as an independent channel.
+ */
+template <typename Shaper, typename T = float>
+class second_order_adaa
+{
+public:
+    using S = scalar_of_t<T>;
+
+    explicit second_order_adaa (S ill_condition_tolerance = (S) 1.0e-3)
+        : tolerance (ill_condition_tolerance)
+    {
+        reset();
+    }
+
+    /** Resets the waveshaper state, as though the previous inputs were x */
+    void reset (T x = T ((S) 0))
+    {
+        x1 = x;
+        x2 = x;
+        ad2_residual_x1 = Shaper::ad2_residual (x);
+        d2 = Shaper::ad1 (x);
+    }
+
+    /** Processes a single sample */
+    T process (T x)
+    {
+        const auto ad2_residual_x = Shaper::ad2_residual (x);
+
+        const auto delta_1 = x - x1;
+        const auto ill_condition_1 = adaa_detail::abs (delta_1) < (T) tolerance;
+        const auto safe_delta_1 = select (ill_condition_1, (T) 1, delta_1);
+        const auto d1 = adaa_detail::select_conditioned (
+            ill_condition_1,
+            [&]
+            { return Shaper::ad1 ((S) 0.5 * (x + x1)); },
+            [&]
+            { return adaa_detail::ad2_asymptote_divided_difference<Shaper> (x, x1, safe_delta_1)
+                     + (ad2_residual_x - ad2_residual_x1) / safe_delta_1; });
+
+        const auto delta_2 = x - x2;
+        const auto ill_condition_2 = adaa_detail::abs (delta_2) < (T) tolerance;
+        const auto y = adaa_detail::select_conditioned (
+            ill_condition_2,
+            [&]
+            { return midpoint_fallback ((S) 0.5 * (x + x2)); },
+            [&]
+            { return (S) 2 * (d1 - d2) / select (ill_condition_2, (T) 1, delta_2); });
+
+        x2 = x1;
+        x1 = x;
+        ad2_residual_x1 = ad2_residual_x;
+        d2 = d1;
+        return y;
+    }
+
+    /** Processes a block of samples in-place */
+    void process_block (T* data, size_t N)
+    {
+        for (size_t n = 0; n < N; ++n)
+            data[n] = process (data[n]);
+    }
+
+private:
+    /**
+     * The limit of the second-order ADAA expression as x[n] -> x[n-2], with x_bar = (x[n] + x[n-2]) / 2:
+     * y = 2 (F1(x_bar) (x_bar - x[n-1]) - (F2(x_bar) - F2(x[n-1]))) / (x_bar - x[n-1])^2,
+     * which falls back to f(x_bar) when x_bar and x[n-1] are also too close.
+     */
+    T midpoint_fallback (T x_bar) const
+    {
+        const auto delta = x_bar - x1;
+        const auto ill_condition = adaa_detail::abs (delta) < (T) tolerance;
+        const auto safe_delta = select (ill_condition, (T) 1, delta);
+        return adaa_detail::select_conditioned (
+            ill_condition,
+            [&]
+            { return Shaper::func (x_bar); },
+            [&]
+            {
+                const auto ad2_divided_difference = adaa_detail::ad2_asymptote_divided_difference<Shaper> (x_bar, x1, safe_delta)
+                                                    + (Shaper::ad2_residual (x_bar) - ad2_residual_x1) / safe_delta;
+                return (scalar_of_t<T>) 2 * (Shaper::ad1 (x_bar) - ad2_divided_difference) / safe_delta;
+            });
+    }
+
+    S tolerance;
+    T x1 {};
+    T x2 {};
+    T ad2_residual_x1 {};
+    T d2 {};
+};
+} // namespace math_approx
@@ -13,6 +13,7 @@
 
 #include <algorithm>
 #include <bit>
+#include <limits>
 
 namespace math_approx
 {
@@ -82,6 +83,44 @@ xsimd::batch<T> select (xsimd::batch_bool<T> q, xsimd::batch<T> t, xsimd::batch<
 }
 #endif
 
+/**
+ * How an approximation handles special values: NaN or infinite inputs,
+ * inputs outside of the function's domain, and results that overflow
+ * (or underflow) the floating-point range.
+ *
+ * unchecked: no extra work, so special values give unspecified results
+ * saturate: inputs are clamped into the domain, so that the result is always finite
+ *           (NaN inputs are clamped to the lower end of the domain)
+ * ieee: special values give the results that the standard library would,
+ *       e.g. NaN for inputs outside of the domain, +Inf for overflow, and
+ *       -Inf for log(0), and subnormal inputs/results are handled correctly
+ * flush_denormals: the same as ieee, except that subnormal results are flushed
+ *                  to zero, and subnormal inputs are treated as zero (the same
+ *                  as the FTZ/DAZ modes, see scoped_flush_denormals), so that
+ *                  no denormals are ever built
+ */
+enum class special_value_policy
+{
+    unchecked,
+    saturate,
+    ieee,
+    flush_denormals,
+};
+
+/** True for the policies that give IEEE results for NaN, infinite, and out-of-domain inputs */
+constexpr bool has_ieee_special_values (special_value_policy policy)
+{
+    return policy == special_value_policy::ieee || policy == special_value_policy::flush_denormals;
+}
+
+/** Clamps x to [lo, hi], where NaN is clamped to lo (for scalars and XSIMD batches) */
+template <typename T>
+T clamp_nan_to_low (T x, scalar_of_t<T> lo, scalar_of_t<T> hi)
+{
+    x = select (x > lo, x, T { lo });
+    return select (x < hi, x, T { hi });
+}
+
 #if ! __cpp_lib_bit_cast
 // bit_cast requirement.
 template <typename From, typename To>
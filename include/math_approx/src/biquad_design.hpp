@@ -0,0 +1,172 @@
+#pragma once
+
+#include "bulk_approx.hpp"
+#include "pow_approx.hpp"
+#include "trig_approx.hpp"
+
+#include <cmath>
+
+namespace math_approx
+{
+/** Biquad filter types, following the RBJ "Audio EQ Cookbook" */
+enum class biquad_type
+{
+    lowpass,
+    highpass,
+    bandpass, // constant 0 dB peak gain
+    notch,
+    allpass,
+    peak,
+    low_shelf,
+    high_shelf,
+};
+
+/** The coefficients of a biquad filter, normalized so that a0 = 1 */
+template <typename T>
+struct biquad_coefficients
+{
+    T b0, b1, b2;
+    T a1, a2;
+};
+
+/** Buffers for the coefficients of many biquad filters, as structure-of-arrays */
+template <typename T>
+struct biquad_coefficient_buffers
+{
+    T* b0;
+    T* b1;
+    T* b2;
+    T* a1;
+    T* a2;
+};
+
+namespace biquad_detail
+{
+    template <typename T>
+    T sqrt (T x)
+    {
+        using std::sqrt;
+#if defined(XSIMD_HPP)
+        using xsimd::sqrt;
+#endif
+        return sqrt (x);
+    }
+
+    template <typename T>
+    biquad_coefficients<T> normalize (T b0, T b1, T b2, T a0, T a1, T a2)
+    {
+        using S = scalar_of_t<T>;
+        const auto a0_inv = (S) 1 / a0;
+        return { b0 * a0_inv, b1 * a0_inv, b2 * a0_inv, a1 * a0_inv, a2 * a0_inv };
+    }
+} // namespace biquad_detail
+
+/**
+ * Designs a biquad filter, with the cutoff/center frequency normalized to the sample rate
+ * (i.e. fc / fs, which should be within (0, 1/2)), and the gain (for peak and shelf filters) in dB.
+ *
+ * The RBJ cookbook formulas are written in terms of K = tan(pi fc / fs), using
+ * cos(w0) = (1 - K^2) / (1 + K^2) and sin(w0) = 2K / (1 + K^2), so that each
+ * design needs only one tan() approximation (plus one exp10() for the gain),
+ * rather than computing tan(), sin(), and cos() separately.
+ *
+ * T may be float, double, or an XSIMD batch, where each lane is a separate filter.
+ */
+template <biquad_type type, int tan_order = 9, int exp_order = 5, typename T>
+biquad_coefficients<T> design_biquad (T normalized_frequency, T q, T gain_db = (T) (scalar_of_t<T>) 0)
+{
+    using S = scalar_of_t<T>;
+    const auto K = tan_mhalfpi_halfpi<tan_order> ((S) M_PI * normalized_frequency);
+    const auto K_sq = K * K;
+    const auto K_over_q = K / q;
+
+    if constexpr (type == biquad_type::lowpass || type == biquad_type::highpass || type == biquad_type::bandpass
+                  || type == biquad_type::notch || type == biquad_type::allpass)
+    {
+        const auto a0 = (S) 1 + K_over_q + K_sq;
+        const auto a1 = (S) 2 * (K_sq - (S) 1);
+        const auto a2 = (S) 1 - K_over_q + K_sq;
+
+        if constexpr (type == biquad_type::lowpass)
+            return biquad_detail::normalize (K_sq, (S) 2 * K_sq, K_sq, a0, a1, a2);
+        else if constexpr (type == biquad_type::highpass)
+            return biquad_detail::normalize (T ((S) 1), T ((S) -2), T ((S) 1), a0, a1, a2);
+        else if constexpr (type == biquad_type::bandpass)
+            return biquad_detail::normalize (K_over_q, T ((S) 0), -K_over_q, a0, a1, a2);
+        else if constexpr (type == biquad_type::notch)
+            return biquad_detail::normalize ((S) 1 + K_sq, a1, (S) 1 + K_sq, a0, a1, a2);
+        else
+            return biquad_detail::normalize (a2, a1, a0, a0, a1, a2);
+    }
+    else
+    {
+        // A = 10^(gain / 40)
+        const auto A = exp10<exp_order> (gain_db * (S) (1.0 / 40.0));
+
+        if constexpr (type == biquad_type::peak)
+        {
+            const auto one_plus_K_sq = (S) 1 + K_sq;
+            const auto a1 = (S) 2 * (K_sq - (S) 1);
+            const auto K_A_over_q = K_over_q * A;
+            const auto K_over_q_A = K_over_q / A;
+            return biquad_detail::normalize (one_plus_K_sq + K_A_over_q,
+                                             a1,
+                                             one_plus_K_sq - K_A_over_q,
+                                             one_plus_K_sq + K_over_q_A,
+                                             a1,
+                                             one_plus_K_sq - K_over_q_A);
+        }
+        else if constexpr (type == biquad_type::low_shelf)
+        {
+            const auto sqrt_A_K_over_q = biquad_detail::sqrt (A) * K_over_q;
+            const auto A_K_sq = A * K_sq;
+            return biquad_detail::normalize (A * ((S) 1 + sqrt_A_K_over_q + A_K_sq),
+                                             (S) 2 * A * (A_K_sq - (S) 1),
+                                             A * ((S) 1 - sqrt_A_K_over_q + A_K_sq),
+                                             A + sqrt_A_K_over_q + K_sq,
+                                             (S) 2 * (K_sq - A),
+                                             A - sqrt_A_K_over_q + K_sq);
+        }
+        else if constexpr (type == biquad_type::high_shelf)
+        {
+            const auto sqrt_A_K_over_q = biquad_detail::sqrt (A) * K_over_q;
+            const auto A_K_sq = A * K_sq;
+            return biquad_detail::normalize (A * (A + sqrt_A_K_over_q + K_sq),
+                                             (S) 2 * A * (K_sq - A),
+                                             A * (A - sqrt_A_K_over_q + K_sq),
+                                             (S) 1 + sqrt_A_K_over_q + A_K_sq,
+                                             (S) 2 * (A_K_sq - (S) 1),
+                                             (S) 1 - sqrt_A_K_over_q + A_K_sq);
+        }
+    }
+}
+
+/**
+ * Designs N biquad filters at once (SIMD across filters, when XSIMD is available),
+ * from per-filter frequencies (in Hz), Q values, and gains (in dB). The gains are
+ * only used for peak and shelf filters, so gain_db may be nullptr for other types.
+ *
+ * The coefficients are written as structure-of-arrays.
+ */
+template <biquad_type type, int tan_order = 9, int exp_order = 5, typename T>
+void design_biquads (biquad_coefficient_buffers<T> coeffs, const T* frequency, const T* q, const T* gain_db, size_t N, T sample_rate)
+{
+    using namespace bulk_detail;
+    const auto one_over_fs = (T) 1 / sample_rate;
+    for_each_chunk<T> (N,
+                       [&] (size_t n, auto tag)
+                       {
+                           using V = typename decltype (tag)::type;
+                           constexpr auto uses_gain = type == biquad_type::peak || type == biquad_type::low_shelf || type == biquad_type::high_shelf;
+                           const auto gain = uses_gain ? load<V> (gain_db + n) : V ((T) 0);
+                           const auto c = design_biquad<type, tan_order, exp_order> (load<V> (frequency + n) * one_over_fs,
+                                                                                     load<V> (q + n),
+                                                                                     gain);
+                           store (coeffs.b0 + n, c.b0);
+                           store (coeffs.b1 + n, c.b1);
+                           store (coeffs.b2 + n, c.b2);
+                           store (coeffs.a1 + n, c.a1);
+                           store (coeffs.a2 + n, c.a2);
+                       });
+}
+} // namespace math_approx
@@ -0,0 +1,330 @@
+#pragma once
+
+#include "basic_math.hpp"
+#include "denormals.hpp"
+#include "half_precision.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+#if defined(XSIMD_HPP) && (defined(__SSE2__) || defined(_M_X64))
+#include <immintrin.h>
+#elif defined(XSIMD_HPP) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace math_approx
+{
+namespace bulk_detail
+{
+    /**
+     * Describes how a storage type is loaded into (and stored from)
+     * the type that the approximations are computed with.
+     */
+    template <typename StorageType>
+    struct storage_traits
+    {
+        using compute_type = StorageType;
+
+        static constexpr compute_type to_compute (StorageType x) { return x; }
+        static constexpr StorageType from_compute (compute_type x) { return x; }
+
+#if defined(XSIMD_HPP)
+        static xsimd::batch<compute_type> load (const StorageType* p)
+        {
+            return xsimd::batch<compute_type>::load_unaligned (p);
+        }
+
+        static void store (StorageType* p, xsimd::batch<compute_type> x)
+        {
+            x.store_unaligned (p);
+        }
+#endif
+    };
+
+    template <>
+    struct storage_traits<bfloat16>
+    {
+        using compute_type = float;
+
+        static float to_compute (bfloat16 x) { return to_float (x); }
+        static bfloat16 from_compute (float x) { return to_bfloat16 (x); }
+
+#if defined(XSIMD_HPP)
+        static xsimd::batch<float> load (const bfloat16* p) { return half_detail::load_bfloat16 (p); }
+        static void store (bfloat16* p, xsimd::batch<float> x) { half_detail::store_bfloat16 (p, x); }
+#endif
+    };
+
+    template <>
+    struct storage_traits<float16>
+    {
+        using compute_type = float;
+
+        static float to_compute (float16 x) { return to_float (x); }
+        static float16 from_compute (float x) { return to_float16 (x); }
+
+#if defined(XSIMD_HPP)
+        static xsimd::batch<float> load (const float16* p) { return half_detail::load_float16 (p); }
+        static void store (float16* p, xsimd::batch<float> x) { half_detail::store_float16 (p, x); }
+#endif
+    };
+
+    struct no_denormal_guard
+    {
+    };
+
+    /** scoped_flush_denormals for denormal_mode::flush, otherwise an empty guard */
+    template <denormal_mode mode>
+    using denormal_guard = std::conditional_t<mode == denormal_mode::flush, scoped_flush_denormals, no_denormal_guard>;
+
+    template <typename V>
+    struct type_tag
+    {
+        using type = V;
+    };
+
+    /**
+     * Calls func (n, type_tag<V>) for each chunk of the range [0, N),
+     * where V is the XSIMD batch type for T (when available) for as
+     * many full batches as possible, and then T for the remainder.
+     */
+    template <typename T, typename Func>
+    void for_each_chunk (size_t N, Func&& func)
+    {
+        size_t n = 0;
+#if defined(XSIMD_HPP)
+        using B = xsimd::batch<T>;
+        for (; n + B::size <= N; n += B::size)
+            func (n, type_tag<B> {});
+#endif
+        for (; n < N; ++n)
+            func (n, type_tag<T> {});
+    }
+
+    /** Loads a value of type V (scalar or batch) from memory */
+    template <typename V, typename T>
+    V load (const T* p)
+    {
+        if constexpr (std::is_same_v<V, T>)
+            return *p;
+#if defined(XSIMD_HPP)
+        else
+            return V::load_unaligned (p);
+#endif
+    }
+
+    /** Stores a value of type V (scalar or batch) to memory */
+    template <typename V, typename T>
+    void store (T* p, V x)
+    {
+        if constexpr (std::is_same_v<V, T>)
+            *p = x;
+#if defined(XSIMD_HPP)
+        else
+            x.store_unaligned (p);
+#endif
+    }
+
+#if defined(XSIMD_HPP)
+    // These methods are templated on the batch type, so that the
+    // intrinsics for the "other" register widths are not instantiated.
+
+    /**
+     * Loads B::size doubles (i.e. two double batches), and narrows them to a float batch,
+     * packing the two halves with a single conversion per half.
+     */
+    template <typename B = xsimd::batch<float>>
+    B load_narrowed (const double* p)
+    {
+#if defined(__AVX512F__)
+        if constexpr (B::size == 16)
+        {
+            const auto lo = _mm512_castps256_ps512 (_mm512_cvtpd_ps (_mm512_loadu_pd (p)));
+            const auto hi = _mm256_castps_pd (_mm512_cvtpd_ps (_mm512_loadu_pd (p + 8)));
+            return _mm512_castpd_ps (_mm512_insertf64x4 (_mm512_castps_pd (lo), hi, 1));
+        }
+#endif
+#if defined(__AVX__)
+        if constexpr (B::size == 8)
+        {
+            const auto lo = _mm256_castps128_ps256 (_mm256_cvtpd_ps (_mm256_loadu_pd (p)));
+            return _mm256_insertf128_ps (lo, _mm256_cvtpd_ps (_mm256_loadu_pd (p + 4)), 1);
+        }
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+        if constexpr (B::size == 4)
+            return _mm_movelh_ps (_mm_cvtpd_ps (_mm_loadu_pd (p)), _mm_cvtpd_ps (_mm_loadu_pd (p + 2)));
+#elif defined(__aarch64__)
+        if constexpr (B::size == 4)
+            return vcvt_high_f32_f64 (vcvt_f32_f64 (vld1q_f64 (p)), vld1q_f64 (p + 2));
+#endif
+
+        alignas (B::arch_type::alignment()) float data[B::size];
+        for (size_t i = 0; i < B::size; ++i)
+            data[i] = (float) p[i];
+        return B::load_aligned (data);
+    }
+
+    /** Widens a float batch to B::size doubles (i.e. two double batches), and stores them. */
+    template <typename B = xsimd::batch<float>>
+    void store_widened (double* p, B x)
+    {
+#if defined(__AVX512F__)
+        if constexpr (B::size == 16)
+        {
+            const __m512 v = x;
+            _mm512_storeu_pd (p, _mm512_cvtps_pd (_mm512_castps512_ps256 (v)));
+            _mm512_storeu_pd (p + 8, _mm512_cvtps_pd (_mm256_castpd_ps (_mm512_extractf64x4_pd (_mm512_castps_pd (v), 1))));
+            return;
+        }
+#endif
+#if defined(__AVX__)
+        if constexpr (B::size == 8)
+        {
+            const __m256 v = x;
+            _mm256_storeu_pd (p, _mm256_cvtps_pd (_mm256_castps256_ps128 (v)));
+            _mm256_storeu_pd (p + 4, _mm256_cvtps_pd (_mm256_extractf128_ps (v, 1)));
+            return;
+        }
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+        if constexpr (B::size == 4)
+        {
+            const __m128 v = x;
+            _mm_storeu_pd (p, _mm_cvtps_pd (v));
+            _mm_storeu_pd (p + 2, _mm_cvtps_pd (_mm_movehl_ps (v, v)));
+            return;
+        }
+#elif defined(__aarch64__)
+        if constexpr (B::size == 4)
+        {
+            const float32x4_t v = x;
+            vst1q_f64 (p, vcvt_f64_f32 (vget_low_f32 (v)));
+            vst1q_f64 (p + 2, vcvt_high_f64_f32 (v));
+            return;
+        }
+#endif
+
+        alignas (B::arch_type::alignment()) float data[B::size];
+        x.store_aligned (data);
+        for (size_t i = 0; i < B::size; ++i)
+            p[i] = (double) data[i];
+    }
+#endif
+
+    /** Loads a value of type V (scalar or batch), converting each element from T */
+    template <typename V, typename T>
+    V load_converted (const T* p)
+    {
+        if constexpr (std::is_arithmetic_v<V>)
+        {
+            return (V) *p;
+        }
+#if defined(XSIMD_HPP)
+        else if constexpr (std::is_same_v<T, double> && std::is_same_v<typename V::value_type, float>)
+        {
+            return load_narrowed<V> (p);
+        }
+        else
+        {
+            using S = typename V::value_type;
+            alignas (V::arch_type::alignment()) S lanes[V::size];
+            for (size_t i = 0; i < V::size; ++i)
+                lanes[i] = (S) p[i];
+            return V::load_aligned (lanes);
+        }
+#endif
+    }
+
+    /** Stores a value of type V (scalar or batch), converting each element to T */
+    template <typename T, typename V>
+    void store_converted (T* p, V x)
+    {
+        if constexpr (std::is_arithmetic_v<V>)
+        {
+            *p = (T) x;
+        }
+#if defined(XSIMD_HPP)
+        else if constexpr (std::is_same_v<T, double> && std::is_same_v<typename V::value_type, float>)
+        {
+            store_widened (p, x);
+        }
+        else
+        {
+            using S = typename V::value_type;
+            alignas (V::arch_type::alignment()) S lanes[V::size];
+            x.store_aligned (lanes);
+            for (size_t i = 0; i < V::size; ++i)
+                p[i] = (T) lanes[i];
+        }
+#endif
+    }
+} // namespace bulk_detail
+
+/**
+ * Applies an approximation to a buffer of N values,
+ * using SIMD batches when XSIMD is available, and
+ * falling back to scalar code for the remainder.
+ *
+ * The function must be callable with the "compute" type
+ * for StorageType (and its XSIMD batch), e.g.
+ * `[] (auto x) { return math_approx::tanh<5> (x); }`.
+ *
+ * For bfloat16 and float16 storage, the data is widened
+ * to float as it is loaded, and narrowed back to the storage
+ * type as it is stored, so the data never makes an extra
+ * trip through memory as float. The x and y buffers may alias.
+ *
+ * With denormal_mode::flush (e.g. `process_bulk<math_approx::denormal_mode::flush> (...)`),
+ * the buffer is processed with denormals flushed to zero (see scoped_flush_denormals).
+ */
+template <denormal_mode mode = denormal_mode::preserve, typename StorageType, typename Func>
+void process_bulk (const StorageType* x, StorageType* y, size_t N, Func&& func)
+{
+    using Traits = bulk_detail::storage_traits<StorageType>;
+    [[maybe_unused]] const bulk_detail::denormal_guard<mode> guard {};
+
+    size_t n = 0;
+#if defined(XSIMD_HPP)
+    using B = xsimd::batch<typename Traits::compute_type>;
+    for (; n + B::size <= N; n += B::size)
+        Traits::store (y + n, func (Traits::load (x + n)));
+#endif
+
+    for (; n < N; ++n)
+        y[n] = Traits::from_compute (func (Traits::to_compute (x[n])));
+}
+
+/**
+ * Mixed-precision version of process_bulk() for double buffers: the values are
+ * narrowed to float as they are loaded, the approximation is computed with float
+ * (and float SIMD batches, with twice as many lanes as double batches), and the
+ * results are widened back to double as they are stored. The x and y buffers may alias.
+ *
+ * The results are exactly the float approximation's results, so this should only
+ * be used where the float approximation is accurate enough (no better than ~1e-7
+ * relative error), and where:
+ * - The inputs and results are within float range: |x| and |y| below ~3.4e38
+ *   (larger values become infinite), and above ~1.2e-38 (smaller values are denormal,
+ *   or flushed to zero, e.g. exp(x) for x < -87 is clamped).
+ * - The function isn't sensitive to the ~6e-8 relative error from narrowing the input.
+ *   That error is multiplied by the function's condition number, |x f'(x) / f(x)|,
+ *   so e.g. exp(x) loses ~6e-8 |x| of relative accuracy, and sin(x) loses ~6e-8 |x|
+ *   of absolute accuracy, which rules out large arguments.
+ *
+ * The denormal_mode is the same as for process_bulk().
+ */
+template <denormal_mode mode = denormal_mode::preserve, typename Func>
+void process_bulk_mixed_precision (const double* x, double* y, size_t N, Func&& func)
+{
+    using namespace bulk_detail;
+    [[maybe_unused]] const denormal_guard<mode> guard {};
+    for_each_chunk<float> (N,
+                           [&] (size_t n, auto tag)
+                           {
+                               using V = typename decltype (tag)::type;
+                               store_converted (y + n, func (load_converted<V> (x + n)));
+                           });
+}
+} // namespace math_approx
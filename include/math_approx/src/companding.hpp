@@ -0,0 +1,437 @@
+#pragma once
+
+#include "bulk_approx.hpp"
+#include "log_approx.hpp"
+#include "pow_approx.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace math_approx
+{
+namespace companding_detail
+{
+    /** mu-law with mu = 255: log2(1 + mu) = 8 */
+    template <typename T>
+    struct MuLawBase
+    {
+        static constexpr auto log2_base = (T) 8;
+    };
+
+    /**
+     * A-law with A = 87.6: with this base, pow() computes exp(y (1 + ln(A)) - 1) / A,
+     * and log() computes (1 + ln(A x)) / (1 + ln(A)), i.e. the logarithmic segments
+     * of the A-law expander and compressor. Since the offset is -1 / ln(2) - log2(A),
+     * it's the same as -log2_base.
+     */
+    template <typename T>
+    struct ALawBase
+    {
+        static constexpr auto log2_base = (T) (5.4727542655597013 * 1.4426950408889634074); // (1 + ln(A)) / ln(2)
+        static constexpr auto offset = -log2_base;
+    };
+
+    static constexpr double mu = 255.0;
+    static constexpr double A = 87.6;
+    static constexpr double one_plus_log_A = 5.4727542655597013;
+
+    template <typename T>
+    T abs (T x)
+    {
+        using std::abs;
+#if defined(XSIMD_HPP)
+        using xsimd::abs;
+#endif
+        return abs (x);
+    }
+
+    template <typename T>
+    T copysign (T mag, T sign_source)
+    {
+        return select (sign_source < (scalar_of_t<T>) 0, -mag, mag);
+    }
+
+    //=================================================
+    // G.711 helpers, for int32_t, or XSIMD batches of int32_t
+
+    template <typename I>
+    auto to_float (I x)
+    {
+        if constexpr (std::is_arithmetic_v<I>)
+            return (float) x;
+#if defined(XSIMD_HPP)
+        else
+            return xsimd::to_float (x);
+#endif
+    }
+
+    template <typename F>
+    auto to_int (F x)
+    {
+        if constexpr (std::is_arithmetic_v<F>)
+            return (int32_t) x;
+#if defined(XSIMD_HPP)
+        else
+            return xsimd::to_int (x);
+#endif
+    }
+
+    template <typename F>
+    auto float_bits (F x)
+    {
+        if constexpr (std::is_arithmetic_v<F>)
+            return bit_cast<int32_t> (x);
+#if defined(XSIMD_HPP)
+        else
+            return xsimd::bit_cast<xsimd::batch<int32_t>> (x);
+#endif
+    }
+
+    template <typename I>
+    auto float_from_bits (I x)
+    {
+        if constexpr (std::is_arithmetic_v<I>)
+            return bit_cast<float> (x);
+#if defined(XSIMD_HPP)
+        else
+            return xsimd::bit_cast<xsimd::batch<float>> (x);
+#endif
+    }
+
+    template <typename T>
+    T min (T a, T b)
+    {
+        using std::min;
+#if defined(XSIMD_HPP)
+        using xsimd::min;
+#endif
+        return min (a, b);
+    }
+
+    template <typename T>
+    T clamp (T x, T lo, T hi)
+    {
+        using std::clamp;
+#if defined(XSIMD_HPP)
+        using xsimd::clip;
+        if constexpr (! std::is_arithmetic_v<T>)
+            return clip (x, lo, hi);
+        else
+#endif
+            return clamp (x, lo, hi);
+    }
+
+    /** Returns the magnitude, with its sign flipped where is_negative is 0x80 (or kept where it is 0) */
+    template <typename F, typename I>
+    F apply_sign (F magnitude, I is_negative)
+    {
+        if constexpr (std::is_arithmetic_v<F>)
+            return is_negative != 0 ? -magnitude : magnitude;
+#if defined(XSIMD_HPP)
+        else
+            return magnitude ^ float_from_bits (is_negative << 24); // 0x80 << 24 is the float sign bit
+#endif
+    }
+
+    /**
+     * For a code with the segment and mantissa in its low 7 bits, returns the bits of
+     * the float (16 + mantissa + 1/2) * 2^(segment + 3), i.e. 1.mmmm1 * 2^(segment + 7).
+     * This is the G.711 reconstruction level for segments >= 1 (for both laws).
+     */
+    template <typename I>
+    I segment_reconstruction_bits (I code_7_bits)
+    {
+        return ((code_7_bits + (I) (134 << 4)) << 19) | (I) (1 << 18);
+    }
+
+    /** G.711 mu-law encoding, from 16-bit PCM (as int32) to an 8-bit code (as int32) */
+    template <typename I>
+    I g711_mu_law_encode (I pcm)
+    {
+        const auto pcm_14 = pcm >> 2;
+        const auto is_negative = pcm_14 < (I) 0;
+        const auto magnitude = min (select (is_negative, -pcm_14, pcm_14), (I) 8158) + (I) 33;
+
+        // magnitude is in [33, 8191], so the float's exponent is segment + 5,
+        // and its top four mantissa bits are the quantized mantissa
+        const auto segment_mantissa = (float_bits (to_float (magnitude)) >> 19) - (I) (132 << 4);
+        return segment_mantissa ^ select (is_negative, (I) 0x7f, (I) 0xff);
+    }
+
+    /** G.711 mu-law decoding, from an 8-bit code (as int32) to 16-bit PCM (as float) */
+    template <typename I>
+    auto g711_mu_law_decode (I code)
+    {
+        const auto u = ~code & (I) 0xff;
+        return apply_sign (float_from_bits (segment_reconstruction_bits (u & (I) 0x7f)) - 132.0f, u & (I) 0x80);
+    }
+
+    /** G.711 A-law encoding, from 16-bit PCM (as int32) to an 8-bit code (as int32) */
+    template <typename I>
+    I g711_a_law_encode (I pcm)
+    {
+        const auto pcm_13 = pcm >> 3;
+        const auto is_negative = pcm_13 < (I) 0;
+        const auto magnitude = select (is_negative, (I) -1 - pcm_13, pcm_13);
+
+        // for magnitude in [32, 4095], the float's exponent is segment + 4,
+        // and its top four mantissa bits are the quantized mantissa
+        const auto segment_mantissa = select (magnitude < (I) 32,
+                                              magnitude >> 1,
+                                              (float_bits (to_float (magnitude)) >> 19) - (I) (131 << 4));
+        return segment_mantissa ^ select (is_negative, (I) 0x55, (I) 0xd5);
+    }
+
+    /** G.711 A-law decoding, from an 8-bit code (as int32) to 16-bit PCM (as float) */
+    template <typename I>
+    auto g711_a_law_decode (I code)
+    {
+        const auto a = (code ^ (I) 0x55) & (I) 0xff;
+        const auto code_7_bits = a & (I) 0x7f;
+        const auto magnitude_bits = select ((code_7_bits >> 4) == (I) 0,
+                                            float_bits (to_float ((code_7_bits << 4) + (I) 8)),
+                                            segment_reconstruction_bits (code_7_bits));
+        return apply_sign (float_from_bits (magnitude_bits), (a & (I) 0x80) ^ (I) 0x80);
+    }
+
+    /** Converts normalized float samples to 16-bit PCM (as int32), with saturation */
+    template <typename F>
+    auto float_to_pcm (F x)
+    {
+        return to_int (clamp (x * 32768.0f, F (-32768.0f), F (32767.0f)));
+    }
+
+    template <typename Encoder>
+    void encode_bulk (const int16_t* pcm, uint8_t* codes, size_t N, Encoder&& encode)
+    {
+        using namespace bulk_detail;
+        for_each_chunk<int32_t> (N,
+                                 [&] (size_t n, auto tag)
+                                 {
+                                     using V = typename decltype (tag)::type;
+                                     store_converted (codes + n, encode (load_converted<V> (pcm + n)));
+                                 });
+    }
+
+    template <typename Encoder>
+    void encode_bulk (const float* x, uint8_t* codes, size_t N, Encoder&& encode)
+    {
+        using namespace bulk_detail;
+        for_each_chunk<float> (N,
+                               [&] (size_t n, auto tag)
+                               {
+                                   using V = typename decltype (tag)::type;
+                                   store_converted (codes + n, encode (float_to_pcm (load<V> (x + n))));
+                               });
+    }
+
+    template <typename Decoder>
+    void decode_bulk (const uint8_t* codes, int16_t* pcm, size_t N, Decoder&& decode)
+    {
+        using namespace bulk_detail;
+        for_each_chunk<int32_t> (N,
+                                 [&] (size_t n, auto tag)
+                                 {
+                                     using V = typename decltype (tag)::type;
+                                     store_converted (pcm + n, to_int (decode (load_converted<V> (codes + n))));
+                                 });
+    }
+
+    template <typename Decoder>
+    void decode_bulk (const uint8_t* codes, float* y, size_t N, Decoder&& decode)
+    {
+        using namespace bulk_detail;
+        for_each_chunk<int32_t> (N,
+                                 [&] (size_t n, auto tag)
+                                 {
+                                     using V = typename decltype (tag)::type;
+                                     store (y + n, decode (load_converted<V> (codes + n)) * (1.0f / 32768.0f));
+                                 });
+    }
+} // namespace companding_detail
+
+/**
+ * Continuous mu-law compressor (mu = 255): sgn(x) ln(1 + mu |x|) / ln(1 + mu), for x in [-1, 1].
+ * Since 1 + mu = 2^8, this is log2(1 + mu |x|) / 8, with log2() from log().
+ * Max error: ~1.5e-5 (order 4), ~2e-6 (order 5), ~7e-7 (order 6)
+ */
+template <int order = 5, typename T>
+T mu_law_compress (T x)
+{
+    using S = scalar_of_t<T>;
+    const auto y = log<companding_detail::MuLawBase<S>, order, false> ((S) 1 + (S) companding_detail::mu * companding_detail::abs (x));
+    return companding_detail::copysign (y, x);
+}
+
+/**
+ * Continuous mu-law expander (mu = 255): sgn(y) ((1 + mu)^|y| - 1) / mu, for y in [-1, 1].
+ * Max error: ~3.5e-6 (order 4), ~2.5e-7 (order 5), ~1.6e-7 (order 6)
+ */
+template <int order = 5, typename T>
+T mu_law_expand (T y)
+{
+    using S = scalar_of_t<T>;
+    const auto x = (pow<companding_detail::MuLawBase<S>, order, false, true> (companding_detail::abs (y)) - (S) 1) * (S) (1.0 / companding_detail::mu);
+    return companding_detail::copysign (x, y);
+}
+
+/**
+ * Continuous A-law compressor (A = 87.6), for x in [-1, 1]:
+ * sgn(x) A|x| / (1 + ln(A)) for |x| < 1/A, or sgn(x) (1 + ln(A|x|)) / (1 + ln(A)) otherwise.
+ * Max error: ~2e-5 (order 4), ~6e-6 (order 5), ~4.5e-6 (order 6)
+ */
+template <int order = 5, typename T>
+T a_law_compress (T x)
+{
+    using namespace companding_detail;
+    using S = scalar_of_t<T>;
+    const auto abs_x = abs (x);
+    const auto is_linear = abs_x < (S) (1.0 / A);
+    const auto linear = abs_x * (S) (A / one_plus_log_A);
+    const auto logarithmic = log<ALawBase<S>, order, false> (select (is_linear, T ((S) 1), abs_x));
+    return copysign (select (is_linear, linear, logarithmic), x);
+}
+
+/**
+ * Continuous A-law expander (A = 87.6), for y in [-1, 1]:
+ * sgn(y) |y| (1 + ln(A)) / A for |y| < 1 / (1 + ln(A)), or sgn(y) exp(|y| (1 + ln(A)) - 1) / A otherwise.
+ * Max error: ~4e-6 (order 4), ~2e-6 (order 5)
+ */
+template <int order = 5, typename T>
+T a_law_expand (T y)
+{
+    using namespace companding_detail;
+    using S = scalar_of_t<T>;
+    const auto abs_y = abs (y);
+    const auto is_linear = abs_y < (S) (1.0 / one_plus_log_A);
+    const auto linear = abs_y * (S) (one_plus_log_A / A);
+    const auto exponential = pow<ALawBase<S>, order, false, true> (abs_y);
+    return copysign (select (is_linear, linear, exponential), y);
+}
+
+/** Applies the continuous mu-law compressor to a buffer (see process_bulk) */
+template <int order = 5, typename T>
+void mu_law_compress (const T* x, T* y, size_t N)
+{
+    process_bulk (x, y, N, [] (auto v)
+                  { return mu_law_compress<order> (v); });
+}
+
+/** Applies the continuous mu-law expander to a buffer (see process_bulk) */
+template <int order = 5, typename T>
+void mu_law_expand (const T* x, T* y, size_t N)
+{
+    process_bulk (x, y, N, [] (auto v)
+                  { return mu_law_expand<order> (v); });
+}
+
+/** Applies the continuous A-law compressor to a buffer (see process_bulk) */
+template <int order = 5, typename T>
+void a_law_compress (const T* x, T* y, size_t N)
+{
+    process_bulk (x, y, N, [] (auto v)
+                  { return a_law_compress<order> (v); });
+}
+
+/** Applies the continuous A-law expander to a buffer (see process_bulk) */
+template <int order = 5, typename T>
+void a_law_expand (const T* x, T* y, size_t N)
+{
+    process_bulk (x, y, N, [] (auto v)
+                  { return a_law_expand<order> (v); });
+}
+
+/**
+ * G.711 mu-law encoding of a 16-bit PCM sample, bit-exact with the ITU-T/Sun
+ * reference implementation. Rather than searching the segment table, the
+ * segment and mantissa are read from the bits of the sample's magnitude
+ * converted to float (like log() does).
+ */
+inline uint8_t mu_law_encode (int16_t pcm)
+{
+    return (uint8_t) companding_detail::g711_mu_law_encode ((int32_t) pcm);
+}
+
+/** G.711 mu-law decoding to a 16-bit PCM sample, bit-exact with the ITU-T/Sun reference implementation */
+inline int16_t mu_law_decode (uint8_t code)
+{
+    return (int16_t) companding_detail::g711_mu_law_decode ((int32_t) code);
+}
+
+/**
+ * G.711 A-law encoding of a 16-bit PCM sample, bit-exact with the ITU-T/Sun
+ * reference implementation (see mu_law_encode()).
+ */
+inline uint8_t a_law_encode (int16_t pcm)
+{
+    return (uint8_t) companding_detail::g711_a_law_encode ((int32_t) pcm);
+}
+
+/** G.711 A-law decoding to a 16-bit PCM sample, bit-exact with the ITU-T/Sun reference implementation */
+inline int16_t a_law_decode (uint8_t code)
+{
+    return (int16_t) companding_detail::g711_a_law_decode ((int32_t) code);
+}
+
+/** G.711 mu-law encodes a buffer of 16-bit PCM samples (SIMD across samples, when XSIMD is available) */
+inline void mu_law_encode (const int16_t* pcm, uint8_t* codes, size_t N)
+{
+    companding_detail::encode_bulk (pcm, codes, N, [] (auto x)
+                                    { return companding_detail::g711_mu_law_encode (x); });
+}
+
+/**
+ * G.711 mu-law encodes a buffer of float samples in [-1, 1), which are
+ * scaled to 16-bit PCM (with saturation, and truncated towards zero).
+ */
+inline void mu_law_encode (const float* x, uint8_t* codes, size_t N)
+{
+    companding_detail::encode_bulk (x, codes, N, [] (auto v)
+                                    { return companding_detail::g711_mu_law_encode (v); });
+}
+
+/** G.711 mu-law decodes a buffer of codes to 16-bit PCM samples */
+inline void mu_law_decode (const uint8_t* codes, int16_t* pcm, size_t N)
+{
+    companding_detail::decode_bulk (codes, pcm, N, [] (auto c)
+                                    { return companding_detail::g711_mu_law_decode (c); });
+}
+
+/** G.711 mu-law decodes a buffer of codes to float samples in [-1, 1) */
+inline void mu_law_decode (const uint8_t* codes, float* y, size_t N)
+{
+    companding_detail::decode_bulk (codes, y, N, [] (auto c)
+                                    { return companding_detail::g711_mu_law_decode (c); });
+}
+
+/** G.711 A-law encodes a buffer of 16-bit PCM samples (SIMD across samples, when XSIMD is available) */
+inline void a_law_encode (const int16_t* pcm, uint8_t* codes, size_t N)
+{
+    companding_detail::encode_bulk (pcm, codes, N, [] (auto x)
+                                    { return companding_detail::g711_a_law_encode (x); });
+}
+
+/**
+ * G.711 A-law encodes a buffer of float samples in [-1, 1), which are
+ * scaled to 16-bit PCM (with saturation, and truncated towards zero).
+ */
+inline void a_law_encode (const float* x, uint8_t* codes, size_t N)
+{
+    companding_detail::encode_bulk (x, codes, N, [] (auto v)
+                                    { return companding_detail::g711_a_law_encode (v); });
+}
+
+/** G.711 A-law decodes a buffer of codes to 16-bit PCM samples */
+inline void a_law_decode (const uint8_t* codes, int16_t* pcm, size_t N)
+{
+    companding_detail::decode_bulk (codes, pcm, N, [] (auto c)
+                                    { return companding_detail::g711_a_law_decode (c); });
+}
+
+/** G.711 A-law decodes a buffer of codes to float samples in [-1, 1) */
+inline void a_law_decode (const uint8_t* codes, float* y, size_t N)
+{
+    companding_detail::decode_bulk (codes, y, N, [] (auto c)
+                                    { return companding_detail::g711_a_law_decode (c); });
+}
+} // namespace math_approx
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#endif
+
+namespace math_approx
+{
+namespace denormals_detail
+{
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    static constexpr bool is_supported = true;
+
+    // MXCSR: flush-to-zero (bit 15) and denormals-are-zero (bit 6)
+    static constexpr uint64_t flush_bits = 0x8040;
+
+    inline uint64_t get_state() { return (uint64_t) _mm_getcsr(); }
+    inline void set_state (uint64_t state) { _mm_setcsr ((unsigned int) state); }
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+    static constexpr bool is_supported = true;
+
+    // FPCR: flush-to-zero (bit 24), which also treats denormal inputs as zero
+    static constexpr uint64_t flush_bits = (uint64_t) 1 << 24;
+
+    inline uint64_t get_state()
+    {
+        uint64_t state;
+        __asm__ __volatile__ ("mrs %0, fpcr" : "=r"(state));
+        return state;
+    }
+
+    inline void set_state (uint64_t state) { __asm__ __volatile__ ("msr fpcr, %0" : : "r"(state)); }
+#else
+    static constexpr bool is_supported = false;
+    static constexpr uint64_t flush_bits = 0;
+
+    inline uint64_t get_state() { return 0; }
+    inline void set_state (uint64_t) {}
+#endif
+} // namespace denormals_detail
+
+/**
+ * While this object is in scope, the FPU flushes denormal results to zero,
+ * and treats denormal inputs as zero (the FTZ/DAZ bits of the x86 MXCSR
+ * register, or the FZ bit of the AArch64 FPCR register). The previous state
+ * is restored when the object goes out of scope.
+ *
+ * On x86, arithmetic that produces (or consumes) denormals is handled by a
+ * microcode assist, which can be 10-100x slower than normal arithmetic, e.g.
+ * when a decaying feedback loop or a tanh() saturator runs into silence.
+ *
+ * The state is per-thread, so the guard only affects the thread that
+ * created it. On other targets, the guard does nothing (see is_supported).
+ */
+class scoped_flush_denormals
+{
+public:
+    static constexpr bool is_supported = denormals_detail::is_supported;
+
+    scoped_flush_denormals()
+        : previous_state (denormals_detail::get_state())
+    {
+        // writing the control register stalls the pipeline, so it's skipped when the bits are already set
+        if ((previous_state & denormals_detail::flush_bits) != denormals_detail::flush_bits)
+            denormals_detail::set_state (previous_state | denormals_detail::flush_bits);
+    }
+
+    ~scoped_flush_denormals()
+    {
+        if ((previous_state & denormals_detail::flush_bits) != denormals_detail::flush_bits)
+            denormals_detail::set_state (previous_state);
+    }
+
+    scoped_flush_denormals (const scoped_flush_denormals&) = delete;
+    scoped_flush_denormals& operator= (const scoped_flush_denormals&) = delete;
+
+private:
+    const uint64_t previous_state;
+};
+
+/** Controls whether the bulk processing functions (e.g. process_bulk()) flush denormals while they run */
+enum class denormal_mode
+{
+    preserve, // the FPU state is left as-is
+    flush, // the bulk processing runs within a scoped_flush_denormals
+};
+} // namespace math_approx
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "bulk_approx.hpp"
+#include "log_approx.hpp"
+
+#include <limits>
+
+namespace math_approx
+{
+namespace entropy_detail
+{
+    /**
+     * Kahan (compensated) summation. When T is an XSIMD batch,
+     * each lane is an independent compensated sum.
+     *
+     * Note that this relies on strict floating-point semantics,
+     * so it will not be effective with -ffast-math (or /fp:fast).
+     */
+    template <typename T>
+    struct kahan_sum
+    {
+        T sum = T ((scalar_of_t<T>) 0);
+        T compensation = T ((scalar_of_t<T>) 0);
+
+        void add (T x)
+        {
+            const auto y = x - compensation;
+            const auto t = sum + y;
+            compensation = (t - sum) - y;
+            sum = t;
+        }
+    };
+
+    /**
+     * Clamps x to at least the smallest normal number, so that log(x) is finite
+     * (and so the approximations never see denormals). For x = 0, terms like
+     * x * log(clamp_to_normal(x)) then evaluate to exactly zero, without branching.
+     */
+    template <typename T>
+    T clamp_to_normal (T x)
+    {
+        using S = scalar_of_t<T>;
+        constexpr auto min_normal = std::numeric_limits<S>::min();
+        return select (x < (T) min_normal, (T) min_normal, x);
+    }
+
+    /**
+     * Computes the compensated sum of term(n, type_tag<V>) over [0, N),
+     * where V is the XSIMD batch type for T (when available) for as many
+     * full batches as possible, and then T for the remainder.
+     */
+    template <typename T, typename Term>
+    T accumulate (size_t N, Term&& term)
+    {
+        kahan_sum<T> acc;
+
+        size_t n = 0;
+#if defined(XSIMD_HPP)
+        using B = xsimd::batch<T>;
+        kahan_sum<B> acc_simd;
+        for (; n + B::size <= N; n += B::size)
+            acc_simd.add (term (n, bulk_detail::type_tag<B> {}));
+
+        alignas (B::arch_type::alignment()) T sums[B::size];
+        alignas (B::arch_type::alignment()) T compensations[B::size];
+        acc_simd.sum.store_aligned (sums);
+        acc_simd.compensation.store_aligned (compensations);
+        for (size_t i = 0; i < B::size; ++i)
+        {
+            acc.add (sums[i]);
+            acc.add (-compensations[i]);
+        }
+#endif
+
+        for (; n < N; ++n)
+            acc.add (term (n, bulk_detail::type_tag<T> {}));
+
+        return acc.sum - acc.compensation;
+    }
+
+    template <typename Base, int order, typename T>
+    T entropy (const T* p, size_t N)
+    {
+        return -accumulate<T> (N,
+                               [p] (size_t n, auto tag)
+                               {
+                                   using V = typename decltype (tag)::type;
+                                   const auto p_n = bulk_detail::load<V> (p + n);
+                                   return p_n * log<Base, order, false> (clamp_to_normal (p_n));
+                               });
+    }
+} // namespace entropy_detail
+
+/**
+ * Shannon entropy (in nats) of a probability distribution: -sum(p * log(p)).
+ * Zero probabilities contribute zero, without branching.
+ */
+template <int order = 5, typename T>
+T entropy (const T* p, size_t N)
+{
+    return entropy_detail::entropy<pow_detail::BaseE<T>, order> (p, N);
+}
+
+/**
+ * Shannon entropy (in bits) of a probability distribution: -sum(p * log2(p)).
+ * Zero probabilities contribute zero, without branching.
+ */
+template <int order = 5, typename T>
+T entropy_bits (const T* p, size_t N)
+{
+    return entropy_detail::entropy<pow_detail::Base2<T>, order> (p, N);
+}
+
+/**
+ * Categorical cross-entropy (in nats) between a target distribution p
+ * and a predicted distribution q: -sum(p * log(q)).
+ *
+ * Predicted probabilities are clamped to the smallest normal number,
+ * so q = 0 gives a large (but finite) contribution, similar to the
+ * log-clamping done by most ML frameworks.
+ */
+template <int order = 5, typename T>
+T cross_entropy (const T* p, const T* q, size_t N)
+{
+    return -entropy_detail::accumulate<T> (N,
+                                           [p, q] (size_t n, auto tag)
+                                           {
+                                               using V = typename decltype (tag)::type;
+                                               const auto p_n = bulk_detail::load<V> (p + n);
+                                               const auto q_n = bulk_detail::load<V> (q + n);
+                                               return p_n * log<order> (entropy_detail::clamp_to_normal (q_n));
+                                           });
+}
+
+/**
+ * Binary cross-entropy (in nats), summed over N predictions:
+ * -sum(y * log(p) + (1 - y) * log(1 - p)),
+ * where y are the targets in [0, 1] and p are the predicted probabilities.
+ *
+ * The arguments to the logs are clamped to the smallest normal number,
+ * so p = 0 or p = 1 give a large (but finite) contribution.
+ * Divide by N for the mean reduction.
+ */
+template <int order = 5, typename T>
+T binary_cross_entropy (const T* y, const T* p, size_t N)
+{
+    return -entropy_detail::accumulate<T> (N,
+                                           [y, p] (size_t n, auto tag)
+                                           {
+                                               using V = typename decltype (tag)::type;
+                                               const auto y_n = bulk_detail::load<V> (y + n);
+                                               const auto p_n = bulk_detail::load<V> (p + n);
+                                               const auto log_p = log<order> (entropy_detail::clamp_to_normal (p_n));
+                                               const auto log_1mp = log<order> (entropy_detail::clamp_to_normal ((T) 1 - p_n));
+                                               return log_1mp + y_n * (log_p - log_1mp);
+                                           });
+}
+} // namespace math_approx
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "basic_math.hpp"
+#include "bulk_approx.hpp"
+#include "pow_approx.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+namespace math_approx
+{
+/**
+ * Generates the ramp Base^(start + n * slope), for n = 0, 1, 2, ...
+ *
+ * Rather than evaluating pow() for every sample, the ramp is seeded
+ * with pow<Base, order>(), and then advanced with one multiply per sample,
+ * since Base^(start + (n + 1) * slope) = Base^(start + n * slope) * Base^slope.
+ * The ramp is re-anchored with pow<Base, order>() every anchor_interval
+ * samples, so the multiplicative error can't accumulate indefinitely.
+ *
+ * T may be float or double (in which case process_block() computes
+ * several consecutive samples per SIMD batch, when XSIMD is available),
+ * or an XSIMD batch, in which case each lane is an independent ramp.
+ */
+template <typename Base, int order = 6, typename T = float>
+class exponential_ramp
+{
+public:
+    using S = scalar_of_t<T>;
+
+    explicit exponential_ramp (size_t samples_between_anchors = 64)
+        : anchor_interval (std::max (samples_between_anchors, (size_t) 1))
+    {
+        set ((T) (S) 0, (T) (S) 0);
+    }
+
+    /** Starts a new ramp, Base^(start_exponent + n * slope) */
+    void set (T start_exponent, T slope_per_sample)
+    {
+        start = start_exponent;
+        slope = slope_per_sample;
+        count = 0;
+        ratio = pow_approx (slope);
+
+#if defined(XSIMD_HPP)
+        if constexpr (std::is_arithmetic_v<T>)
+        {
+            for (size_t i = 0; i < time_lanes; ++i)
+                lane_powers[i] = pow_approx ((T) i * slope);
+            block_ratio = pow_approx ((T) time_lanes * slope);
+        }
+#endif
+
+        anchor();
+    }
+
+    /** Returns the current exponent, i.e. start + n * slope */
+    [[nodiscard]] T get_exponent() const noexcept { return start + (S) count * slope; }
+
+    /** Returns the current value of the ramp, without advancing it */
+    [[nodiscard]] T get_value() const noexcept { return value; }
+
+    /** Returns the next value of the ramp */
+    T process()
+    {
+        const auto y = value;
+        ++count;
+        if (--samples_until_anchor == 0)
+            anchor();
+        else
+            value *= ratio;
+        return y;
+    }
+
+    /** Writes the next N values of the ramp to the output buffer */
+    void process_block (T* output, size_t N)
+    {
+        generate_block (output, N, [] (T* y, auto v)
+                        { bulk_detail::store (y, v); });
+    }
+
+    /** Multiplies a buffer (in-place) by the next N values of the ramp, e.g. for applying a smoothed gain */
+    void multiply_block (T* data, size_t N)
+    {
+        generate_block (data, N, [] (T* y, auto v)
+                        { bulk_detail::store (y, bulk_detail::load<decltype (v)> (y) * v); });
+    }
+
+private:
+    static T pow_approx (T x)
+    {
+        return pow<Base, order, false, true> (x);
+    }
+
+    void anchor()
+    {
+        value = pow_approx (get_exponent());
+        samples_until_anchor = anchor_interval;
+    }
+
+    template <typename Op>
+    void generate_block (T* data, size_t N, Op&& op)
+    {
+        for (size_t n = 0; n < N;)
+        {
+            const auto segment_length = std::min (N - n, samples_until_anchor);
+            generate_segment (data + n, segment_length, op);
+
+            n += segment_length;
+            count += segment_length;
+            samples_until_anchor -= segment_length;
+            if (samples_until_anchor == 0)
+                anchor();
+        }
+    }
+
+    /** Generates a segment of the ramp, between re-anchoring points */
+    template <typename Op>
+    void generate_segment (T* data, size_t N, Op& op)
+    {
+        size_t i = 0;
+#if defined(XSIMD_HPP)
+        if constexpr (std::is_arithmetic_v<T>)
+        {
+            using B = xsimd::batch<T>;
+            if (N >= B::size)
+            {
+                auto v = value * B::load_aligned (lane_powers);
+                for (; i + B::size <= N; i += B::size)
+                {
+                    op (data + i, v);
+                    v *= block_ratio;
+                }
+                value = v.get (0);
+            }
+        }
+#endif
+        for (; i < N; ++i)
+        {
+            op (data + i, value);
+            value *= ratio;
+        }
+    }
+
+    size_t anchor_interval;
+    size_t samples_until_anchor = 1;
+    size_t count = 0;
+
+    T start {};
+    T slope {};
+    T ratio {};
+    T value {};
+
+#if defined(XSIMD_HPP)
+    // for float/double ramps, process_block() computes several consecutive samples per batch
+    static constexpr size_t time_lanes = xsimd::batch<S>::size;
+    alignas (xsimd::batch<S>::arch_type::alignment()) S lane_powers[time_lanes] {};
+    S block_ratio {};
+#endif
+};
+
+/** A ramp of exp(start + n * slope) (see exponential_ramp) */
+template <int order = 6, typename T = float>
+using exp_ramp = exponential_ramp<pow_detail::BaseE<scalar_of_t<T>>, order, T>;
+
+/** A ramp of 2^(start + n * slope), e.g. for frequency glides in octaves (see exponential_ramp) */
+template <int order = 6, typename T = float>
+using exp2_ramp = exponential_ramp<pow_detail::Base2<scalar_of_t<T>>, order, T>;
+
+/** A ramp of 10^(start + n * slope), e.g. for gain ramps in decibels / 20 (see exponential_ramp) */
+template <int order = 6, typename T = float>
+using exp10_ramp = exponential_ramp<pow_detail::Base10<scalar_of_t<T>>, order, T>;
+} // namespace math_approx
@@ -0,0 +1,615 @@
+#pragma once
+
+#include "bulk_approx.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+namespace math_approx
+{
+/**
+ * Rounding for the fixed-point approximations, used for each multiply
+ * (when the product is shifted back down) and for the final result:
+ *
+ * truncate: rounds towards -infinity (a plain arithmetic shift)
+ * nearest: rounds to the nearest value (with ties rounded up)
+ */
+enum class fixed_point_rounding
+{
+    truncate,
+    nearest,
+};
+
+namespace fixed_point_detail
+{
+    /**
+     * The fixed-point approximations keep every value (the inputs, the polynomial
+     * coefficients, and the intermediate results) in [-1, 1), so that it fits in the
+     * storage type: Q1.15 in int16_t, or Q1.31 in int32_t. Coefficients that would be
+     * >= 1 are stored minus 1, with the 1 added back by the kernel (e.g. 2^f = 1 + p(f)),
+     * which is checked by a static_assert on each polynomial.
+     *
+     * Scalars are computed in wider integers (int32_t or int64_t), where a product of two
+     * such values (at most 2^30 or 2^62) can't overflow. XSIMD batches are computed in the
+     * storage type itself (int16_t or int32_t lanes), taking the high half of each product,
+     * so the two give the same results. The only product that doesn't fit back into
+     * [-1, 1) is -1 * -1, so each product has at least one operand above -1 (the
+     * kernels clamp the values they square to (-1, 1)).
+     *
+     * That doesn't leave room for any guard bits though, so each Horner step can add
+     * up to 1/2 LSB of rounding error (or 1 LSB, when truncating).
+     */
+    template <typename I>
+    static constexpr int frac_bits = std::is_arithmetic_v<I> ? (int) sizeof (I) * 4 - 1 : (int) sizeof (scalar_of_t<I>) * 8 - 1;
+
+    /** The largest fixed-point value, 1 - 2^-frac */
+    template <typename I>
+    static constexpr auto max_value = (scalar_of_t<I>) (((int64_t) 1 << frac_bits<I>) - 1);
+
+    /** Polynomial coefficients, in fixed-point */
+    template <typename S, size_t N>
+    struct fixed_coeffs
+    {
+        S c[N];
+    };
+
+    /** Returns true if each coefficient, with frac fractional bits (rounded to nearest), is in [-1, 1) */
+    template <int frac, size_t N>
+    constexpr bool fits (const double (&c)[N])
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            const auto scaled = c[i] * (double) ((int64_t) 1 << frac);
+            if (scaled <= -(double) ((int64_t) 1 << frac) - 0.5 || scaled >= (double) ((int64_t) 1 << frac) - 0.5)
+                return false;
+        }
+        return true;
+    }
+
+    /** Converts polynomial coefficients to fixed-point, with frac fractional bits (rounded to nearest) */
+    template <int frac, typename S, size_t N>
+    constexpr fixed_coeffs<S, N> to_fixed (const double (&c)[N])
+    {
+        fixed_coeffs<S, N> result {};
+        for (size_t i = 0; i < N; ++i)
+        {
+            const auto scaled = c[i] * (double) ((int64_t) 1 << frac);
+            result.c[i] = (S) (scaled < 0.0 ? scaled - 0.5 : scaled + 0.5);
+        }
+        return result;
+    }
+
+    /** Returns x / 2^shift, with the given rounding */
+    template <fixed_point_rounding rounding, typename I>
+    I shift_down (I x, int shift)
+    {
+        using S = scalar_of_t<I>;
+        if constexpr (rounding == fixed_point_rounding::truncate)
+            return x >> shift;
+        else if constexpr (std::is_arithmetic_v<I>)
+            return (x + ((S) 1 << (shift - 1))) >> shift; // the wider scalar types have room for the rounding bias
+        else
+            return (x >> shift) + ((x >> (shift - 1)) & (S) 1);
+    }
+
+    /** Fixed-point multiply: (a * b) / 2^frac */
+    template <fixed_point_rounding rounding, typename I>
+    I mul (I a, I b);
+
+#if defined(XSIMD_HPP)
+    // Templated on the batch type, like bulk_detail::load_narrowed().
+
+    /**
+     * Fixed-point multiply for batches of int16_t (Q1.15) or int32_t (Q1.31), returning the
+     * high half of the double-width product. For Q1.15, that's pmulhrsw (or pmulhw/pmullw,
+     * when truncating). x86 doesn't have a 32-bit high-half multiply, so for Q1.31 the even
+     * and odd lanes are multiplied with one pmuldq each, and blended back together.
+     * On AArch64, it's vqrdmulh (or vqdmulh, when truncating) for both.
+     */
+    template <fixed_point_rounding rounding, typename B>
+    B mul_high (B a, B b)
+    {
+        using S = scalar_of_t<B>;
+        [[maybe_unused]] constexpr auto nearest = rounding == fixed_point_rounding::nearest;
+        if constexpr (std::is_same_v<S, int16_t>)
+        {
+#if defined(__AVX512BW__)
+            if constexpr (B::size == 32)
+            {
+                if constexpr (nearest)
+                    return _mm512_mulhrs_epi16 (a, b);
+                else
+                    return _mm512_or_si512 (_mm512_slli_epi16 (_mm512_mulhi_epi16 (a, b), 1), _mm512_srli_epi16 (_mm512_mullo_epi16 (a, b), 15));
+            }
+#endif
+#if defined(__AVX2__)
+            if constexpr (B::size == 16)
+            {
+                if constexpr (nearest)
+                    return _mm256_mulhrs_epi16 (a, b);
+                else
+                    return _mm256_or_si256 (_mm256_slli_epi16 (_mm256_mulhi_epi16 (a, b), 1), _mm256_srli_epi16 (_mm256_mullo_epi16 (a, b), 15));
+            }
+#endif
+#if defined(__SSSE3__)
+            if constexpr (B::size == 8)
+            {
+                if constexpr (nearest)
+                    return _mm_mulhrs_epi16 (a, b);
+                else
+                    return _mm_or_si128 (_mm_slli_epi16 (_mm_mulhi_epi16 (a, b), 1), _mm_srli_epi16 (_mm_mullo_epi16 (a, b), 15));
+            }
+#elif defined(__aarch64__)
+            if constexpr (B::size == 8)
+            {
+                if constexpr (nearest)
+                    return vqrdmulhq_s16 (a, b);
+                else
+                    return vqdmulhq_s16 (a, b);
+            }
+#endif
+        }
+        else
+        {
+#if defined(__AVX512F__)
+            if constexpr (B::size == 16)
+            {
+                const auto round = _mm512_set1_epi64 (nearest ? (int64_t) 1 << 30 : 0);
+                const auto even = _mm512_add_epi64 (_mm512_mul_epi32 (a, b), round);
+                const auto odd = _mm512_add_epi64 (_mm512_mul_epi32 (_mm512_srli_epi64 (a, 32), _mm512_srli_epi64 (b, 32)), round);
+                return _mm512_mask_blend_epi32 ((__mmask16) 0xaaaa, _mm512_srli_epi64 (even, 31), _mm512_slli_epi64 (odd, 1));
+            }
+#endif
+#if defined(__AVX2__)
+            if constexpr (B::size == 8)
+            {
+                const auto round = _mm256_set1_epi64x (nearest ? (int64_t) 1 << 30 : 0);
+                const auto even = _mm256_add_epi64 (_mm256_mul_epi32 (a, b), round);
+                const auto odd = _mm256_add_epi64 (_mm256_mul_epi32 (_mm256_srli_epi64 (a, 32), _mm256_srli_epi64 (b, 32)), round);
+                return _mm256_blend_epi32 (_mm256_srli_epi64 (even, 31), _mm256_slli_epi64 (odd, 1), 0xaa);
+            }
+#endif
+#if defined(__SSE4_1__)
+            if constexpr (B::size == 4)
+            {
+                const auto round = _mm_set1_epi64x (nearest ? (int64_t) 1 << 30 : 0);
+                const auto even = _mm_add_epi64 (_mm_mul_epi32 (a, b), round);
+                const auto odd = _mm_add_epi64 (_mm_mul_epi32 (_mm_srli_epi64 (a, 32), _mm_srli_epi64 (b, 32)), round);
+                return _mm_blend_epi16 (_mm_srli_epi64 (even, 31), _mm_slli_epi64 (odd, 1), 0xcc);
+            }
+#elif defined(__aarch64__)
+            if constexpr (B::size == 4)
+            {
+                if constexpr (nearest)
+                    return vqrdmulhq_s32 (a, b);
+                else
+                    return vqdmulhq_s32 (a, b);
+            }
+#endif
+        }
+
+        using W = std::conditional_t<std::is_same_v<S, int16_t>, int32_t, int64_t>;
+        alignas (B::arch_type::alignment()) S a_data[B::size];
+        alignas (B::arch_type::alignment()) S b_data[B::size];
+        a.store_aligned (a_data);
+        b.store_aligned (b_data);
+        for (size_t i = 0; i < B::size; ++i)
+            a_data[i] = (S) mul<rounding> ((W) a_data[i], (W) b_data[i]);
+        return B::load_aligned (a_data);
+    }
+#endif
+
+    template <fixed_point_rounding rounding, typename I>
+    I mul (I a, I b)
+    {
+        if constexpr (std::is_arithmetic_v<I>)
+            return shift_down<rounding> (a * b, frac_bits<I>);
+#if defined(XSIMD_HPP)
+        else
+            return mul_high<rounding> (a, b);
+#endif
+    }
+
+    /** a + b, saturated to [-1, 1) */
+    template <typename I>
+    I add_saturate (I a, I b)
+    {
+        if constexpr (std::is_arithmetic_v<I>)
+            return std::clamp (a + b, -max_value<I> - 1, max_value<I>);
+#if defined(XSIMD_HPP)
+        else
+            return xsimd::sadd (a, b);
+#endif
+    }
+
+    /** Clamps x to [-limit, limit] */
+    template <typename I>
+    I clamp_magnitude (I x, scalar_of_t<I> limit)
+    {
+        using std::clamp;
+#if defined(XSIMD_HPP)
+        if constexpr (! std::is_arithmetic_v<I>)
+            return xsimd::clip (x, I { (scalar_of_t<I>) -limit }, I { limit });
+        else
+#endif
+            return clamp (x, -limit, limit);
+    }
+
+    /**
+     * Evaluates the polynomial c[0] + c[1] x + ... + c[N - 1] x^(N - 1), using Horner's method.
+     * The constant term is added with saturation, since p(x) can round up to 1 at the ends of the range.
+     */
+    template <fixed_point_rounding rounding, typename I, typename S, size_t N>
+    I horner (I x, const fixed_coeffs<S, N>& coeffs)
+    {
+        auto acc = I { coeffs.c[N - 1] };
+        for (size_t i = N - 1; i > 1; --i)
+            acc = I { coeffs.c[i - 1] } + mul<rounding> (acc, x);
+        return add_saturate (I { coeffs.c[0] }, mul<rounding> (acc, x));
+    }
+
+    //=================================================
+    // Polynomials, with the input mapped to [-1, 1].
+    // The orders are chosen so that the polynomial error is well below
+    // 1/2 LSB of the output format: ~6e-7 (Q1.15) or ~1.3e-11 (Q1.31) for
+    // sin(pi/2 x); ~4e-6 or ~1.1e-12 for 2^((x + 1) / 2); ~1.3e-5 or ~1e-9
+    // for log2((x + 3) / 2) (before the output is scaled by 1/16 or 1/32);
+    // and ~2.8e-6 or ~1.2e-11 for tanh(x).
+
+    // sin(pi/2 x) = x + x * p(x^2) (i.e. the x^1 coefficient minus 1)
+    static constexpr double sin_q15_poly[] = { 0.5707910110760047641, -0.64589284954572349953, 0.079434344605991652829, -0.0043330952845237558645 };
+    static constexpr double sin_q31_poly[] = { 0.5707963266218763894, -0.64596409265269809805, 0.079692587335035602007, -0.0046816203508015543265, 0.00016021724634303529171, -3.4182130525186866869e-6 };
+
+    // 2^((x + 1) / 2) - 1
+    static constexpr double pow2_q15_poly[] = { 0.4142137760333607725, 0.49011058463936824355, 0.084930119936901157434, 0.0098857108946948041388, 0.00085610402973807009213 };
+    static constexpr double pow2_q31_poly[] = { 0.4142135623731332133, 0.49012907172436382541, 0.084932896044204170403, 0.0098118330372619534591, 0.00085013054997447494377, 0.000058926083177512057638, 3.4037052561651920059e-6, 1.6915409490221227655e-7, 7.327431976122842857e-9 };
+
+    // log2((x + 3) / 2)
+    static constexpr double log2_q15_poly[] = { 0.58495049249906854536, 0.4809198404447434039, -0.079937228125265261324, 0.017677859236692566206, -0.0050007256288583099248, 0.0014023003185640298968 };
+    static constexpr double log2_q31_poly[] = { 0.58496250103423297105, 0.48089835759473623912, -0.08014974340839476838, 0.017810839683255245002, -0.0044525727808734532171, 0.001188560513853587543, -0.00033053968830383641423, 0.000091667133588598306474, -0.000026297403140617562113, 0.000010574054495818236346, -3.3477535202954726122e-6 };
+
+    // tanh(x) = x * p(x^2)
+    static constexpr double tanh_q15_poly[] = { 0.99996846946870967237, -0.33265823204673421032, 0.12922066858119797191, -0.043299863699021632182, 0.0083658865677290500343 };
+    static constexpr double tanh_q31_poly[] = { 0.99999999973929128862, -0.33333331352794254492, 0.13333288917010704554, -0.053963663988840405967, 0.021843193480282195777, -0.0087713942576636683837, 0.003386176033849270596, -0.0011512913210590130027, 0.00028924774926333465086, -0.000037687133721856897705 };
+
+    static_assert (fits<15> (sin_q15_poly) && fits<31> (sin_q31_poly)
+                       && fits<15> (pow2_q15_poly) && fits<31> (pow2_q31_poly)
+                       && fits<15> (log2_q15_poly) && fits<31> (log2_q31_poly)
+                       && fits<15> (tanh_q15_poly) && fits<31> (tanh_q31_poly),
+                   "The fixed-point coefficients must be in [-1, 1)");
+
+    static constexpr auto sin_q15_coeffs = to_fixed<15, int16_t> (sin_q15_poly);
+    static constexpr auto sin_q31_coeffs = to_fixed<31, int32_t> (sin_q31_poly);
+    static constexpr auto pow2_q15_coeffs = to_fixed<15, int16_t> (pow2_q15_poly);
+    static constexpr auto pow2_q31_coeffs = to_fixed<31, int32_t> (pow2_q31_poly);
+    static constexpr auto log2_q15_coeffs = to_fixed<15, int16_t> (log2_q15_poly);
+    static constexpr auto log2_q31_coeffs = to_fixed<31, int32_t> (log2_q31_poly);
+    static constexpr auto tanh_q15_coeffs = to_fixed<15, int16_t> (tanh_q15_poly);
+    static constexpr auto tanh_q31_coeffs = to_fixed<31, int32_t> (tanh_q31_poly);
+
+    template <typename I, typename Q15Coeffs, typename Q31Coeffs>
+    constexpr const auto& coeffs (const Q15Coeffs& q15, const Q31Coeffs& q31)
+    {
+        if constexpr (frac_bits<I> == 15)
+            return q15;
+        else
+            return q31;
+    }
+
+    //=================================================
+    // Kernels, for Q1.15 values in int32 (or int16 lanes), or Q1.31 values in int64 (or int32 lanes)
+
+    /** sin(2 pi x), with x in turns (wrapped to one period) */
+    template <fixed_point_rounding rounding, typename I>
+    I sin_turns (I x)
+    {
+        using S = scalar_of_t<I>;
+        constexpr auto frac = frac_bits<I>;
+        constexpr auto half_period = (S) ((int64_t) 1 << (frac - 1));
+        constexpr auto quarter_period = (S) ((int64_t) 1 << (frac - 2));
+
+        // wrap to [-1/2, 1/2) turns, then fold into [-1/4, 1/4] turns, using sin(pi - x) = sin(x)
+        const I phase = ((x & max_value<I>) ^ half_period) - half_period;
+        const I folded = select (phase > quarter_period,
+                                 I { half_period } - phase,
+                                 select (phase < (S) -quarter_period, I { (S) -half_period } - phase, phase));
+
+        // y = folded * 4 is in [-1, 1] (in quarter turns), so sin(2 pi x) = sin(pi/2 y).
+        // y is kept within (-1, 1), which changes the peaks by less than 1/2 LSB.
+        const I y = clamp_magnitude (folded, (S) (quarter_period - 1)) * (S) 4;
+        const I y_sq = mul<rounding> (y, y);
+        return add_saturate (y, mul<rounding> (y, horner<rounding> (y_sq, coeffs<I> (sin_q15_coeffs, sin_q31_coeffs))));
+    }
+
+    /** cos(2 pi x) = sin(2 pi (x + 1/4)), with x in turns (wrapped to one period) */
+    template <fixed_point_rounding rounding, typename I>
+    I cos_turns (I x)
+    {
+        using S = scalar_of_t<I>;
+        return sin_turns<rounding> (x + (S) ((int64_t) 1 << (frac_bits<I> - 2)));
+    }
+
+    /** 2^(x - 1), for x in [-1, 1) */
+    template <fixed_point_rounding rounding, typename I>
+    I pow2 (I x)
+    {
+        using S = scalar_of_t<I>;
+        constexpr auto frac = frac_bits<I>;
+        constexpr auto half = (S) ((int64_t) 1 << (frac - 1));
+        constexpr auto quarter = (S) ((int64_t) 1 << (frac - 2));
+
+        // 2^(x - 1) = 2^f / 2 (for x >= 0), or 2^f / 4 with f = x + 1 (for x < 0),
+        // with 2^f = 1 + p(2f - 1), since 2^f itself doesn't fit
+        const auto is_negative = x < (S) 0;
+        const I f = x & max_value<I>;
+        const I p = horner<rounding> ((f - half) * (S) 2, coeffs<I> (pow2_q15_coeffs, pow2_q31_coeffs));
+        return select (is_negative,
+                       I { quarter } + shift_down<rounding> (p, 2),
+                       add_saturate (I { half }, shift_down<rounding> (p, 1)));
+    }
+
+    /** log2(x) / 16 (for Q1.15) or log2(x) / 32 (for Q1.31), for x in (0, 1), or -1 for x <= 0 */
+    template <fixed_point_rounding rounding, typename I>
+    I log2 (I x)
+    {
+        using S = scalar_of_t<I>;
+        constexpr auto frac = frac_bits<I>;
+        constexpr auto half = (S) ((int64_t) 1 << (frac - 1));
+        constexpr auto log2_scale_bits = frac == 15 ? 4 : 5; // the output is log2(x) / 2^log2_scale_bits
+        constexpr auto exponent_scale = (S) ((int64_t) 1 << (frac - log2_scale_bits));
+
+        // x = (1 + m) * 2^e, with the exponent scaled to the output format, and m in Q1.frac
+        I exponent {};
+        I mantissa {};
+        if constexpr (std::is_arithmetic_v<I>)
+        {
+            // x (as an integer) converts to float (or double) exactly, so that
+            // the exponent is floor(log2(x)), and the mantissa has all of x's bits
+            using F = std::conditional_t<frac == 15, float, double>;
+            constexpr auto exponent_bits = frac == 15 ? 23 : 52;
+            constexpr auto exponent_bias = frac == 15 ? 127 : 1023;
+            const auto bits = bit_cast<I> ((F) x);
+            exponent = ((bits >> exponent_bits) - (S) (exponent_bias + frac)) * exponent_scale;
+            mantissa = (bits >> (exponent_bits - frac)) & max_value<I>;
+        }
+#if defined(XSIMD_HPP)
+        else
+        {
+            // normalize x to [1/2, 1), with a binary search for the leading bit
+            // (there's no SIMD count-leading-zeros for 16-bit lanes, or before AVX-512)
+            auto v = xsimd::max (x, I { 1 });
+            exponent = I { (S) -exponent_scale };
+            for (int shift = (frac + 1) / 2; shift > 0; shift /= 2)
+            {
+                const auto is_small = v < (S) ((int64_t) 1 << (frac - shift));
+                v = select (is_small, v << shift, v);
+                exponent = select (is_small, exponent - (S) (shift * exponent_scale), exponent);
+            }
+            mantissa = (v - half) * (S) 2;
+        }
+#endif
+
+        const I p = horner<rounding> ((mantissa - half) * (S) 2, coeffs<I> (log2_q15_coeffs, log2_q31_coeffs));
+        const I y = exponent + shift_down<rounding> (p, log2_scale_bits);
+        return select (x > (S) 0, y, I { (S) (-max_value<I> - 1) });
+    }
+
+    /** tanh(x), for x in [-1, 1) */
+    template <fixed_point_rounding rounding, typename I>
+    I tanh (I x)
+    {
+        // x is kept within (-1, 1), which changes tanh(-1) by less than 1/2 LSB
+        const I x_clamped = clamp_magnitude (x, max_value<I>);
+        const I x_sq = mul<rounding> (x_clamped, x_clamped);
+        return mul<rounding> (x_clamped, horner<rounding> (x_sq, coeffs<I> (tanh_q15_coeffs, tanh_q31_coeffs)));
+    }
+
+    /** Applies a kernel to a buffer of Q1.15 (int16_t) or Q1.31 (int32_t) values, SIMD across values */
+    template <typename T, typename Kernel>
+    void process_fixed_bulk (const T* x, T* y, size_t N, Kernel&& kernel)
+    {
+        using namespace bulk_detail;
+        using W = std::conditional_t<std::is_same_v<T, int16_t>, int32_t, int64_t>;
+        for_each_chunk<T> (N,
+                           [&] (size_t n, auto tag)
+                           {
+                               using V = typename decltype (tag)::type;
+                               if constexpr (std::is_same_v<V, T>)
+                                   y[n] = (T) kernel ((W) x[n]);
+                               else
+                                   store (y + n, kernel (load<V> (x + n)));
+                           });
+    }
+} // namespace fixed_point_detail
+
+/**
+ * Fixed-point approximation of sin(2 pi x), with x a phase in turns (Q1.15, wrapped to
+ * one period, so x = -1 and x = 0 are the same phase), and the result in Q1.15.
+ * The integer phase is folded into a quarter period (like sin_turns_mhalfpi_halfpi),
+ * and then an order 7 polynomial is evaluated with integer Horner steps.
+ * Max error: ~2 LSB (nearest), ~3.5 LSB (truncate)
+ */
+template <fixed_point_rounding rounding = fixed_point_rounding::nearest>
+int16_t sin_turns_q15 (int16_t x)
+{
+    return (int16_t) fixed_point_detail::sin_turns<rounding> ((int32_t) x);
+}
+
+/** Fixed-point approximation of cos(2 pi x), with x a phase in turns (see sin_turns_q15()) */
+template <fixed_point_rounding rounding = fixed_point_rounding::nearest>
+int16_t cos_turns_q15 (int16_t x)
+{
+    return (int16_t) fixed_point_detail::cos_turns<rounding> ((int32_t) x);
+}
+
+/**
+ * Fixed-point approximation of sin(2 pi x), for Q1.31 values (see sin_turns_q15()),
+ * using an order 11 polynomial.
+ * Max error: ~3 LSB (nearest), ~5.5 LSB (truncate)
+ */
+template <fixed_point_rounding rounding = fixed_point_rounding::nearest>
+int32_t sin_turns_q31 (int32_t x)
+{
+    return (int32_t) fixed_point_detail::sin_turns<rounding> ((int64_t) x);
+}
+
+/** Fixed-point approximation of cos(2 pi x), for Q1.31 values (see sin_turns_q15()) */
+template <fixed_point_rounding rounding = fixed_point_rounding::nearest>
+int32_t cos_turns_q31 (int32_t x)
+{
+    return (int32_t) fixed_point_detail::cos_turns<rounding> ((int64_t) x);
+}
+
+/**
+ * Fixed-point approximation of 2^(x - 1), for x in [-1, 1) (Q1.15), with the result
+ * (in [1/4, 1)) in Q1.15. The integer part of x is applied with a shift, and the
+ * fractional part with an order 4 polynomial (like pow2_approx).
+ * Max error: ~1.5 LSB (nearest), ~2.5 LSB (truncate)
+ */
+template <fixed_point_rounding rounding = fixed_point_rounding::nearest>
+int16_t pow2_q15 (int16_t x)
+{
+    return (int16_t) fixed_point_detail::pow2<rounding> ((int32_t) x);
+}
+
+/**
+ * Fixed-point approximation of 2^(x - 1), for Q1.31 values (see pow2_q15()),
+ * using an order 8 polynomial.
+ * Max error: ~2 LSB (nearest), ~4.5 LSB (truncate)
+ */
+template <fixed_point_rounding rounding = fixed_point_rounding::nearest>
+int32_t pow2_q31 (int32_t x)
+{
+    return (int32_t) fixed_point_detail::pow2<rounding> ((int64_t) x);
+}
+
+/**
+ * Fixed-point approximation of log2(x) / 16, for x in (0, 1) (Q1.15), with the result
+ * (in [-15/16, 0)) in Q1.15. For x <= 0, the result is -1 (i.e. log2(x) = -16).
+ * Like Log2Provider::log2_approx, the exponent of x is read from its bits (converted to
+ * float), or found by normalizing x (for SIMD batches), and the log of the mantissa comes
+ * from an order 5 polynomial.
+ * Max error: ~0.7 LSB (nearest), ~1.1 LSB (truncate)
+ */
+template <fixed_point_rounding rounding = fixed_point_rounding::nearest>
+int16_t log2_q15 (int16_t x)
+{
+    return (int16_t) fixed_point_detail::log2<rounding> ((int32_t) x);
+}
+
+/**
+ * Fixed-point approximation of log2(x) / 32, for Q1.31 values (see log2_q15()),
+ * using an order 10 polynomial.
+ * For x <= 0, the result is -1 (i.e. log2(x) = -32).
+ * Max error: ~0.7 LSB (nearest), ~1.2 LSB (truncate)
+ */
+template <fixed_point_rounding rounding = fixed_point_rounding::nearest>
+int32_t log2_q31 (int32_t x)
+{
+    return (int32_t) fixed_point_detail::log2<rounding> ((int64_t) x);
+}
+
+/**
+ * Fixed-point approximation of tanh(x), for x in [-1, 1) (Q1.15), with the result in Q1.15.
+ * Since the input range is small, this uses an order 9 (odd) polynomial, rather than
+ * the rational form of tanh(), which would need an integer division.
+ * Max error: ~2.7 LSB (nearest), ~5 LSB (truncate)
+ */
+template <fixed_point_rounding rounding = fixed_point_rounding::nearest>
+int16_t tanh_q15 (int16_t x)
+{
+    return (int16_t) fixed_point_detail::tanh<rounding> ((int32_t) x);
+}
+
+/**
+ * Fixed-point approximation of tanh(x), for Q1.31 values (see tanh_q15()),
+ * using an order 19 polynomial.
+ * Max error: ~4 LSB (nearest), ~8.5 LSB (truncate)
+ */
+template <fixed_point_rounding rounding = fixed_point_rounding::nearest>
+int32_t tanh_q31 (int32_t x)
+{
+    return (int32_t) fixed_point_detail::tanh<rounding> ((int64_t) x);
+}
+
+/** Applies sin_turns_q15() to a buffer (SIMD across values, in int16 lanes, when XSIMD is available) */
+template <fixed_point_rounding rounding = fixed_point_rounding::nearest>
+void sin_turns_q15 (const int16_t* x, int16_t* y, size_t N)
+{
+    fixed_point_detail::process_fixed_bulk (x, y, N, [] (auto v)
+                                            { return fixed_point_detail::sin_turns<rounding> (v); });
+}
+
+/** Applies cos_turns_q15() to a buffer */
+template <fixed_point_rounding rounding = fixed_point_rounding::nearest>
+void cos_turns_q15 (const int16_t* x, int16_t* y, size_t N)
+{
+    fixed_point_detail::process_fixed_bulk (x, y, N, [] (auto v)
+                                            { return fixed_point_detail::cos_turns<rounding> (v); });
+}
+
+/** Applies sin_turns_q31() to a buffer (SIMD across values, in int32 lanes, when XSIMD is available) */
+template <fixed_point_rounding rounding = fixed_point_rounding::nearest>
+void sin_turns_q31 (const int32_t* x, int32_t* y, size_t N)
+{
+    fixed_point_detail::process_fixed_bulk (x, y, N, [] (auto v)
+                                            { return fixed_point_detail::sin_turns<rounding> (v); });
+}
+
+/** Applies cos_turns_q31() to a buffer */
+template <fixed_point_rounding rounding = fixed_point_rounding::nearest>
+void cos_turns_q31 (const int32_t* x, int32_t* y, size_t N)
+{
+    fixed_point_detail::process_fixed_bulk (x, y, N, [] (auto v)
+                                            { return fixed_point_detail::cos_turns<rounding> (v); });
+}
+
+/** Applies pow2_q15() to a buffer */
+template <fixed_point_rounding rounding = fixed_point_rounding::nearest>
+void pow2_q15 (const int16_t* x, int16_t* y, size_t N)
+{
+    fixed_point_detail::process_fixed_bulk (x, y, N, [] (auto v)
+                                            { return fixed_point_detail::pow2<rounding> (v); });
+}
+
+/** Applies pow2_q31() to a buffer */
+template <fixed_point_rounding rounding = fixed_point_rounding::nearest>
+void pow2_q31 (const int32_t* x, int32_t* y, size_t N)
+{
+    fixed_point_detail::process_fixed_bulk (x, y, N, [] (auto v)
+                                            { return fixed_point_detail::pow2<rounding> (v); });
+}
+
+/** Applies log2_q15() to a buffer */
+template <fixed_point_rounding rounding = fixed_point_rounding::nearest>
+void log2_q15 (const int16_t* x, int16_t* y, size_t N)
+{
+    fixed_point_detail::process_fixed_bulk (x, y, N, [] (auto v)
+                                            { return fixed_point_detail::log2<rounding> (v); });
+}
+
+/** Applies log2_q31() to a buffer */
+template <fixed_point_rounding rounding = fixed_point_rounding::nearest>
+void log2_q31 (const int32_t* x, int32_t* y, size_t N)
+{
+    fixed_point_detail::process_fixed_bulk (x, y, N, [] (auto v)
+                                            { return fixed_point_detail::log2<rounding> (v); });
+}
+
+/** Applies tanh_q15() to a buffer */
+template <fixed_point_rounding rounding = fixed_point_rounding::nearest>
+void tanh_q15 (const int16_t* x, int16_t* y, size_t N)
+{
+    fixed_point_detail::process_fixed_bulk (x, y, N, [] (auto v)
+                                            { return fixed_point_detail::tanh<rounding> (v); });
+}
+
+/** Applies tanh_q31() to a buffer */
+template <fixed_point_rounding rounding = fixed_point_rounding::nearest>
+void tanh_q31 (const int32_t* x, int32_t* y, size_t N)
+{
+    fixed_point_detail::process_fixed_bulk (x, y, N, [] (auto v)
+                                            { return fixed_point_detail::tanh<rounding> (v); });
+}
+} // namespace math_approx
@@ -0,0 +1,244 @@
+#pragma once
+
+#include "basic_math.hpp"
+
+#include <cstdint>
+
+#if defined(XSIMD_HPP) && (defined(__F16C__) || defined(__AVX512BF16__))
+#include <immintrin.h>
+#endif
+
+namespace math_approx
+{
+/**
+ * Storage type for "brain floating-point" (bfloat16) data.
+ *
+ * bfloat16 is the upper 16 bits of an IEEE 754 single-precision
+ * float, so it can only be used as a storage type. Math should
+ * be done after widening to float (see process_bulk()).
+ */
+struct bfloat16
+{
+    uint16_t bits;
+};
+
+#if defined(__FLT16_MANT_DIG__)
+/** Storage type for IEEE 754 half-precision data. */
+using float16 = _Float16;
+#define MATH_APPROX_HAS_NATIVE_FLOAT16 1
+#else
+/** Storage type for IEEE 754 half-precision data. */
+struct float16
+{
+    uint16_t bits;
+};
+#define MATH_APPROX_HAS_NATIVE_FLOAT16 0
+#endif
+
+namespace half_detail
+{
+    inline float16 float16_from_bits ([[maybe_unused]] uint16_t bits)
+    {
+#if MATH_APPROX_HAS_NATIVE_FLOAT16
+        return bit_cast<float16> (bits);
+#else
+        return { bits };
+#endif
+    }
+
+    inline uint16_t float16_to_bits (float16 x)
+    {
+        return bit_cast<uint16_t> (x);
+    }
+
+    // The software conversions below are adapted from Fabian Giesen's
+    // "half <-> float" conversion routines: https://gist.github.com/rygorous/2156668
+
+    /** Converts IEEE half-precision bits to a float (exact, handles denormals, Inf, and NaN) */
+    inline float half_bits_to_float (uint16_t h)
+    {
+        constexpr auto shifted_exp = (uint32_t) 0x7c00 << 13;
+        constexpr auto magic = (uint32_t) 113 << 23;
+
+        auto o = (uint32_t) (h & 0x7fff) << 13;
+        const auto exp = shifted_exp & o;
+        o += (uint32_t) (127 - 15) << 23;
+
+        if (exp == shifted_exp) // Inf/NaN
+        {
+            o += (uint32_t) (128 - 16) << 23;
+        }
+        else if (exp == 0) // zero/denormal
+        {
+            o += (uint32_t) 1 << 23;
+            o = bit_cast<uint32_t> (bit_cast<float> (o) - bit_cast<float> (magic));
+        }
+
+        o |= (uint32_t) (h & 0x8000) << 16;
+        return bit_cast<float> (o);
+    }
+
+    /** Converts a float to IEEE half-precision bits (round-to-nearest-even) */
+    inline uint16_t float_to_half_bits (float f)
+    {
+        constexpr auto f32_infty = (uint32_t) 255 << 23;
+        constexpr auto f16_max = (uint32_t) (127 + 16) << 23;
+        constexpr auto denorm_magic = (uint32_t) ((127 - 15) + (23 - 10) + 1) << 23;
+
+        auto u = bit_cast<uint32_t> (f);
+        const auto sign = u & 0x80000000u;
+        u ^= sign;
+
+        uint32_t o;
+        if (u >= f16_max) // result is Inf or NaN
+        {
+            o = u > f32_infty ? 0x7e00 : 0x7c00;
+        }
+        else if (u < ((uint32_t) 113 << 23)) // result is denormal or zero
+        {
+            o = bit_cast<uint32_t> (bit_cast<float> (u) + bit_cast<float> (denorm_magic)) - denorm_magic;
+        }
+        else
+        {
+            const auto mant_odd = (u >> 13) & 1;
+            u += ((uint32_t) (15 - 127) << 23) + 0xfff;
+            u += mant_odd;
+            o = u >> 13;
+        }
+
+        return static_cast<uint16_t> (o | (sign >> 16));
+    }
+} // namespace half_detail
+
+/** Widens a bfloat16 value to float (exact). */
+inline float to_float (bfloat16 x)
+{
+    return bit_cast<float> ((uint32_t) x.bits << 16);
+}
+
+/** Narrows a float value to bfloat16 (round-to-nearest-even, NaNs are kept quiet). */
+inline bfloat16 to_bfloat16 (float x)
+{
+    const auto u = bit_cast<uint32_t> (x);
+    if ((u & 0x7fffffff) > 0x7f800000)
+        return { static_cast<uint16_t> ((u >> 16) | 0x40) };
+
+    const auto lsb = (u >> 16) & 1;
+    return { static_cast<uint16_t> ((u + 0x7fff + lsb) >> 16) };
+}
+
+/** Widens a half-precision value to float (exact). */
+inline float to_float (float16 x)
+{
+#if MATH_APPROX_HAS_NATIVE_FLOAT16 && defined(__F16C__)
+    return static_cast<float> (x);
+#else
+    return half_detail::half_bits_to_float (half_detail::float16_to_bits (x));
+#endif
+}
+
+/** Narrows a float value to half-precision (round-to-nearest-even). */
+inline float16 to_float16 (float x)
+{
+#if MATH_APPROX_HAS_NATIVE_FLOAT16 && defined(__F16C__)
+    return static_cast<float16> (x);
+#else
+    return half_detail::float16_from_bits (half_detail::float_to_half_bits (x));
+#endif
+}
+
+#if defined(XSIMD_HPP)
+namespace half_detail
+{
+    // Templated on the batch type, like bulk_detail::load_narrowed().
+
+    /** Loads a batch of bfloat16 values, and widens them to float. */
+    template <typename B = xsimd::batch<float>>
+    B load_bfloat16 (const bfloat16* p)
+    {
+        const auto u = xsimd::batch<uint32_t, typename B::arch_type>::load_unaligned (reinterpret_cast<const uint16_t*> (p));
+        return xsimd::bit_cast<B> (u << 16);
+    }
+
+    /** Narrows a batch of floats to bfloat16 (round-to-nearest-even), and stores them. */
+    template <typename B = xsimd::batch<float>>
+    void store_bfloat16 (bfloat16* p, B x)
+    {
+#if defined(__AVX512BF16__)
+        if constexpr (B::size == 16)
+        {
+            const auto y = _mm512_cvtneps_pbh (x);
+            _mm256_storeu_si256 (reinterpret_cast<__m256i*> (p), reinterpret_cast<const __m256i&> (y));
+            return;
+        }
+#if defined(__AVX512VL__)
+        else if constexpr (B::size == 8)
+        {
+            const auto y = _mm256_cvtneps_pbh (x);
+            _mm_storeu_si128 (reinterpret_cast<__m128i*> (p), reinterpret_cast<const __m128i&> (y));
+            return;
+        }
+#endif
+#endif
+
+        using U = xsimd::batch<uint32_t, typename B::arch_type>;
+        const auto u = xsimd::bit_cast<U> (x);
+        const auto rounded = (u + ((u >> 16) & (uint32_t) 1) + (uint32_t) 0x7fff) >> 16;
+        const auto quiet_nan = (u >> 16) | (uint32_t) 0x40;
+        const auto y = xsimd::select (xsimd::batch_bool_cast<uint32_t> (x != x), quiet_nan, rounded);
+        y.store_unaligned (reinterpret_cast<uint16_t*> (p));
+    }
+
+    /** Loads a batch of half-precision values, and widens them to float. */
+    template <typename B = xsimd::batch<float>>
+    B load_float16 (const float16* p)
+    {
+#if defined(__F16C__)
+        if constexpr (B::size == 4)
+            return _mm_cvtph_ps (_mm_loadl_epi64 (reinterpret_cast<const __m128i*> (p)));
+        else if constexpr (B::size == 8)
+            return _mm256_cvtph_ps (_mm_loadu_si128 (reinterpret_cast<const __m128i*> (p)));
+#if defined(__AVX512F__)
+        else if constexpr (B::size == 16)
+            return _mm512_cvtph_ps (_mm256_loadu_si256 (reinterpret_cast<const __m256i*> (p)));
+#endif
+#endif
+
+        alignas (B::arch_type::alignment()) float data[B::size];
+        for (size_t i = 0; i < B::size; ++i)
+            data[i] = to_float (p[i]);
+        return B::load_aligned (data);
+    }
+
+    /** Narrows a batch of floats to half-precision (round-to-nearest-even), and stores them. */
+    template <typename B = xsimd::batch<float>>
+    void store_float16 (float16* p, B x)
+    {
+#if defined(__F16C__)
+        if constexpr (B::size == 4)
+        {
+            _mm_storel_epi64 (reinterpret_cast<__m128i*> (p), _mm_cvtps_ph (x, _MM_FROUND_TO_NEAREST_INT));
+            return;
+        }
+        else if constexpr (B::size == 8)
+        {
+            _mm_storeu_si128 (reinterpret_cast<__m128i*> (p), _mm256_cvtps_ph (x, _MM_FROUND_TO_NEAREST_INT));
+            return;
+        }
+#if defined(__AVX512F__)
+        else if constexpr (B::size == 16)
+        {
+            _mm256_storeu_si256 (reinterpret_cast<__m256i*> (p), _mm512_cvtps_ph (x, _MM_FROUND_TO_NEAREST_INT));
+            return;
+        }
+#endif
+#endif
+
+        alignas (B::arch_type::alignment()) float data[B::size];
+        x.store_aligned (data);
+        for (size_t i = 0; i < B::size; ++i)
+            p[i] = to_float16 (data[i]);
+    }
+} // namespace half_detail
+#endif
+} // namespace math_approx
@@ -9,23 +9,29 @@ namespace math_approx
 // let B = e^x, then sinh = (B^2 - 1) / (2B), cosh = (B^2 + 1) / (2B)
 // simplifying, we get: sinh = 0.5 (B - 1/B), cosh = 0.5 (B + 1/B)
 
-/** Approximation of sinh(x), using exp(x) internally */
-template <int order, typename T>
+/**
+ * Approximation of sinh(x), using exp(x) internally
+ * (the special_value_policy is passed along to exp(x)).
+ */
+template <int order, typename T, special_value_policy policy = special_value_policy::unchecked>
 constexpr T sinh (T x)
 {
     using S = scalar_of_t<T>;
-    auto B = exp<order> (x);
+    auto B = exp<order, false, true, T, policy> (x);
     auto Br = (S) 0.5 / B;
     B *= (S) 0.5;
     return B - Br;
 }
 
-/** Approximation of cosh(x), using exp(x) internally */
-template <int order, typename T>
+/**
+ * Approximation of cosh(x), using exp(x) internally
+ * (the special_value_policy is passed along to exp(x)).
+ */
+template <int order, typename T, special_value_policy policy = special_value_policy::unchecked>
 constexpr T cosh (T x)
 {
     using S = scalar_of_t<T>;
-    auto B = exp<order> (x);
+    auto B = exp<order, false, true, T, policy> (x);
     auto Br = (S) 0.5 / B;
     B *= (S) 0.5;
     return B + Br;
@@ -37,11 +43,11 @@ constexpr T cosh (T x)
  *
  * For more information see the comments above.
  */
-template <int order, typename T>
+template <int order, typename T, special_value_policy policy = special_value_policy::unchecked>
 constexpr auto sinh_cosh (T x)
 {
     using S = scalar_of_t<T>;
-    auto B = exp<order> (x);
+    auto B = exp<order, false, true, T, policy> (x);
     auto Br = (S) 0.5 / B;
     B *= (S) 0.5;
 
@@ -54,6 +60,70 @@ constexpr auto sinh_cosh (T x)
 namespace tanh_detail
 {
     // See notebooks/tanh_approx.nb for the derivation of these polynomials
+    // Orders 13 and above are intended for double-precision: since tanh(x) = sinh(x) / sqrt(sinh(x)^2 + 1),
+    // these are fits of p(x) ≈ sinh(x), with the error weighted by the sensitivity of tanh(x) to p(x).
+
+    template <typename T>
+    constexpr T tanh_poly_19 (T x)
+    {
+        using S = scalar_of_t<T>;
+        const auto x_sq = x * x;
+        const auto y_17_19 = (S) 2.3752989346606094254e-15 + (S) 1.3456835149522888378e-17 * x_sq;
+        const auto y_15_17_19 = (S) 7.8167257230137017452e-13 + y_17_19 * x_sq;
+        const auto y_13_15_17_19 = (S) 1.6024899532748853124e-10 + y_15_17_19 * x_sq;
+        const auto y_11_13_15_17_19 = (S) 2.5055745610538096135e-8 + y_13_15_17_19 * x_sq;
+        const auto y_9_11_13_15_17_19 = (S) 2.7557119734947557349e-6 + y_11_13_15_17_19 * x_sq;
+        const auto y_7_9_11_13_15_17_19 = (S) 0.00019841275061767201258 + y_9_11_13_15_17_19 * x_sq;
+        const auto y_5_7_9_11_13_15_17_19 = (S) 0.0083333332775826992301 + y_7_9_11_13_15_17_19 * x_sq;
+        const auto y_3_5_7_9_11_13_15_17_19 = (S) 0.16666666668346488773 + y_5_7_9_11_13_15_17_19 * x_sq;
+        const auto y_1_3_5_7_9_11_13_15_17_19 = (S) 1 + y_3_5_7_9_11_13_15_17_19 * x_sq;
+        return x * y_1_3_5_7_9_11_13_15_17_19;
+    }
+
+    template <typename T>
+    constexpr T tanh_poly_17 (T x)
+    {
+        using S = scalar_of_t<T>;
+        const auto x_sq = x * x;
+        const auto y_15_17 = (S) 6.7187585846865546775e-13 + (S) 4.3888284833535504541e-15 * x_sq;
+        const auto y_13_15_17 = (S) 1.6304577654374133252e-10 + y_15_17 * x_sq;
+        const auto y_11_13_15_17 = (S) 2.5020199064853461881e-8 + y_13_15_17 * x_sq;
+        const auto y_9_11_13_15_17 = (S) 2.7559358227628595705e-6 + y_11_13_15_17 * x_sq;
+        const auto y_7_9_11_13_15_17 = (S) 0.00019841209636599449695 + y_9_11_13_15_17 * x_sq;
+        const auto y_5_7_9_11_13_15_17 = (S) 0.0083333340415072577133 + y_7_9_11_13_15_17 * x_sq;
+        const auto y_3_5_7_9_11_13_15_17 = (S) 0.16666666643606395489 + y_5_7_9_11_13_15_17 * x_sq;
+        const auto y_1_3_5_7_9_11_13_15_17 = (S) 1 + y_3_5_7_9_11_13_15_17 * x_sq;
+        return x * y_1_3_5_7_9_11_13_15_17;
+    }
+
+    template <typename T>
+    constexpr T tanh_poly_15 (T x)
+    {
+        using S = scalar_of_t<T>;
+        const auto x_sq = x * x;
+        const auto y_13_15 = (S) 1.4573552732127871717e-10 + (S) 1.1381771240713369031e-12 * x_sq;
+        const auto y_11_13_15 = (S) 2.5304426174315137701e-8 + y_13_15 * x_sq;
+        const auto y_9_11_13_15 = (S) 2.7537741645601979035e-6 + y_11_13_15 * x_sq;
+        const auto y_7_9_11_13_15 = (S) 0.00019841939966311222042 + y_9_11_13_15 * x_sq;
+        const auto y_5_7_9_11_13_15 = (S) 0.0083333244877801469132 + y_7_9_11_13_15 * x_sq;
+        const auto y_3_5_7_9_11_13_15 = (S) 0.16666666982060644081 + y_5_7_9_11_13_15 * x_sq;
+        const auto y_1_3_5_7_9_11_13_15 = (S) 1 + y_3_5_7_9_11_13_15 * x_sq;
+        return x * y_1_3_5_7_9_11_13_15;
+    }
+
+    template <typename T>
+    constexpr T tanh_poly_13 (T x)
+    {
+        using S = scalar_of_t<T>;
+        const auto x_sq = x * x;
+        const auto y_11_13 = (S) 2.3347190117609409127e-8 + (S) 2.2782430718543746508e-10 * x_sq;
+        const auto y_9_11_13 = (S) 2.7729209019753292899e-6 + y_11_13 * x_sq;
+        const auto y_7_9_11_13 = (S) 0.00019834167329200489571 + y_9_11_13 * x_sq;
+        const auto y_5_7_9_11_13 = (S) 0.0083334413350184851032 + y_7_9_11_13 * x_sq;
+        const auto y_3_5_7_9_11_13 = (S) 0.16666662374737127287 + y_5_7_9_11_13 * x_sq;
+        const auto y_1_3_5_7_9_11_13 = (S) 1 + y_3_5_7_9_11_13 * x_sq;
+        return x * y_1_3_5_7_9_11_13;
+    }
 
     template <typename T>
     constexpr T tanh_poly_11 (T x)
@@ -114,14 +184,43 @@ namespace tanh_detail
 /**
  * Approximation of tanh(x), using tanh(x) ≈ p(x) / (p(x)^2 + 1),
  * where p(x) is an odd polynomial fit to minimize the maxinimum relative error.
+ *
+ * With the unchecked policy, p(x)^2 overflows for large |x|, giving NaN.
+ * With the other policies, x is clamped to the range where tanh(x) rounds
+ * to +/-1, the ieee and flush_denormals policies also pass NaN through, and
+ * the flush_denormals policy treats subnormal inputs as zero.
  */
-template <int order, typename T>
+template <int order, typename T, special_value_policy policy = special_value_policy::unchecked>
 T tanh (T x)
 {
-    static_assert (order % 2 == 1 && order <= 11 && order >= 3, "Order must e an odd number within [3, 11]");
+    static_assert (order % 2 == 1 && order <= 19 && order >= 3, "Order must e an odd number within [3, 19]");
+
+    using S = scalar_of_t<T>;
+    [[maybe_unused]] const auto x_in = x;
+    if constexpr (policy != special_value_policy::unchecked)
+    {
+        constexpr auto x_max = std::is_same_v<S, float> ? (S) 9 : (S) 19.1;
+        x = clamp_nan_to_low (x, -x_max, x_max);
+    }
+    if constexpr (policy == special_value_policy::flush_denormals)
+    {
+        using std::abs;
+#if defined(XSIMD_HPP)
+        using xsimd::abs;
+#endif
+        x = select (abs (x) < std::numeric_limits<S>::min(), T { (S) 0 }, x);
+    }
 
     T x_poly {};
-    if constexpr (order == 11)
+    if constexpr (order == 19)
+        x_poly = tanh_detail::tanh_poly_19 (x);
+    else if constexpr (order == 17)
+        x_poly = tanh_detail::tanh_poly_17 (x);
+    else if constexpr (order == 15)
+        x_poly = tanh_detail::tanh_poly_15 (x);
+    else if constexpr (order == 13)
+        x_poly = tanh_detail::tanh_poly_13 (x);
+    else if constexpr (order == 11)
         x_poly = tanh_detail::tanh_poly_11 (x);
     else if constexpr (order == 9)
         x_poly = tanh_detail::tanh_poly_9 (x);
@@ -132,7 +231,24 @@ T tanh (T x)
     else if constexpr (order == 3)
         x_poly = tanh_detail::tanh_poly_3 (x);
 
-    using S = scalar_of_t<T>;
-    return x_poly * rsqrt (x_poly * x_poly + (S) 1);
+    T y {};
+    if constexpr (order >= 13)
+    {
+        // the SIMD rsqrt() is only accurate to single-precision
+        using std::sqrt;
+#if defined(XSIMD_HPP)
+        using xsimd::sqrt;
+#endif
+        y = x_poly / sqrt (x_poly * x_poly + (S) 1);
+    }
+    else
+    {
+        y = x_poly * rsqrt (x_poly * x_poly + (S) 1);
+    }
+
+    if constexpr (has_ieee_special_values (policy))
+        return select (x_in != x_in, x_in, y);
+    else
+        return y;
 }
 } // namespace math_approx
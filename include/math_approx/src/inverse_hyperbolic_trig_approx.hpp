@@ -53,8 +53,13 @@ struct AsinhLog2Provider
  * but for most cases the accuracy improvement is not worth
  * the additional cost (when compared to the performance and
  * accuracy achieved by the STL implementation).
+ *
+ * With the ieee special_value_policy, asinh(+/-Inf) is +/-Inf, and NaN
+ * inputs give NaN. With the saturate policy, |x| is clamped so that the
+ * result is always finite. Both policies use asinh(x) ≈ log(x) + log(2)
+ * for large x, where x^2 would overflow.
  */
-template <int order, typename T>
+template <int order, typename T, special_value_policy policy = special_value_policy::unchecked>
 constexpr T asinh (T x)
 {
     using S = scalar_of_t<T>;
@@ -65,24 +70,48 @@ constexpr T asinh (T x)
 
     const auto sign = select (x > (S) 0, (T) (S) 1, select (x < (S) 0, (T) (S) -1, (T) (S) 0));
     x = abs (x);
+    if constexpr (policy == special_value_policy::saturate)
+        x = clamp_nan_to_low (x, (S) 0, std::numeric_limits<S>::max());
 
-    const auto log_arg = x + sqrt (x * x + (S) 1);
-    auto y = log<pow_detail::BaseE<scalar_of_t<T>>, std::min (order, 5), false, AsinhLog2Provider> (log_arg);
-
-    if constexpr (order > 5)
+    if constexpr (policy == special_value_policy::unchecked)
     {
-        const auto exp_y = math_approx::exp<order - 1> (y);
-        y -= (exp_y - log_arg) / exp_y;
+        const auto log_arg = x + sqrt (x * x + (S) 1);
+        auto y = log<pow_detail::BaseE<scalar_of_t<T>>, std::min (order, 5), false, AsinhLog2Provider> (log_arg);
+
+        if constexpr (order > 5)
+        {
+            const auto exp_y = math_approx::exp<order - 1> (y);
+            y -= (exp_y - log_arg) / exp_y;
+        }
+
+        return sign * y;
     }
+    else
+    {
+        // asinh(x) ≈ log(x) + log(2) for large x, which avoids overflowing x^2 (or 2x)
+        const auto is_large = x >= (S) 1.0e8;
+        const auto log_arg = select (is_large, x, x + sqrt (x * x + (S) 1));
+        auto y = log<pow_detail::BaseE<scalar_of_t<T>>, std::min (order, 5), false, AsinhLog2Provider, policy> (log_arg);
 
-    return sign * y;
+        if constexpr (order > 5)
+        {
+            const auto exp_y = math_approx::exp<order - 1> (y);
+            y = select (is_large, y, y - (exp_y - log_arg) / exp_y);
+        }
+
+        return sign * (y + select (is_large, T { (S) M_LN2 }, T { (S) 0 }));
+    }
 }
 
 /**
  * Approximation of acosh(x) in the full range, using identity
  * acosh(x) = log(x + sqrt(x^2 - 1)).
+ *
+ * For x < 1, the result is NaN with the ieee special_value_policy,
+ * or acosh(1) with the saturate policy. Both policies use
+ * acosh(x) ≈ log(2x) for large x, where x^2 would overflow.
  */
-template <int order, typename T>
+template <int order, typename T, special_value_policy policy = special_value_policy::unchecked>
 constexpr T acosh (T x)
 {
     using S = scalar_of_t<T>;
@@ -91,18 +120,36 @@ constexpr T acosh (T x)
     using xsimd::sqrt;
 #endif
 
-    const auto z1 = x + sqrt (x * x - (S) 1);
-    return log<order> (z1);
+    if constexpr (policy == special_value_policy::saturate)
+        x = clamp_nan_to_low (x, (S) 1, (S) 0.5 * std::numeric_limits<S>::max());
+
+    auto z1 = x + sqrt (x * x - (S) 1);
+    if constexpr (policy != special_value_policy::unchecked)
+        z1 = select (x < (S) 1.0e8, z1, x + x); // avoid overflowing x^2
+    const auto y = log<order, false, T, policy> (z1);
+    if constexpr (has_ieee_special_values (policy))
+        return select (x >= (S) 1, y, T { std::numeric_limits<S>::quiet_NaN() });
+    else
+        return y;
 }
 
 /**
  * Approximation of atanh(x), using identity
  * atanh(x) = (1/2) log((x + 1) / (x - 1)).
+ *
+ * With the ieee special_value_policy, atanh(+/-1) is +/-Inf, and the result is
+ * NaN for |x| > 1. With the saturate policy, x is clamped to (-1, 1).
  */
-template <int order, typename T>
+template <int order, typename T, special_value_policy policy = special_value_policy::unchecked>
 constexpr T atanh (T x)
 {
     using S = scalar_of_t<T>;
-    return (S) 0.5 * log<order> (((S) 1 + x) / ((S) 1 - x));
+    if constexpr (policy == special_value_policy::saturate)
+    {
+        constexpr auto x_max = (S) 1 - std::numeric_limits<S>::epsilon();
+        x = clamp_nan_to_low (x, -x_max, x_max);
+    }
+
+    return (S) 0.5 * log<order, false, T, policy> (((S) 1 + x) / ((S) 1 - x));
 }
 } // namespace math_approx
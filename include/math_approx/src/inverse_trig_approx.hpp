@@ -12,7 +12,7 @@ namespace inv_trig_detail
     constexpr T asin_kernel (T x)
     {
         using S = scalar_of_t<T>;
-        static_assert (order >= 1 && order <= 4);
+        static_assert (order >= 1 && order <= 10);
 
         if constexpr (order == 1)
         {
@@ -30,6 +30,31 @@ namespace inv_trig_detail
         {
             return (S) 0.16666803275183153521 + x * ((S) 0.074936964020844071266 + x * ((S) 0.045640288439217274741 + x * ((S) 0.023435504410713306478 + x * (S) 0.043323710842752508055)));
         }
+        // orders 5 and above are minimax absolute error fits for double-precision
+        else if constexpr (order == 5)
+        {
+            return (S) 0.16666653245659061744 + x * ((S) 0.075008143960434194368 + x * ((S) 0.044467179836682643215 + x * ((S) 0.032170233618718640603 + x * ((S) 0.013210787146482557654 + x * (S) 0.039088516399023345985))));
+        }
+        else if constexpr (order == 6)
+        {
+            return (S) 0.16666667805967031337 + x * ((S) 0.074999100186296229888 + x * ((S) 0.044668640346381652481 + x * ((S) 0.030019914067327939894 + x * ((S) 0.025118033569893864184 + x * ((S) 0.0060854258115935336218 + x * (S) 0.036210050692456755151)))));
+        }
+        else if constexpr (order == 7)
+        {
+            return (S) 0.16666666571548433831 + x * ((S) 0.07500009473796313804 + x * ((S) 0.044639386734782233093 + x * ((S) 0.030445754781234593142 + x * ((S) 0.02171188386171048139 + x * ((S) 0.021335111135154014567 + x * ((S) 0.00036008512298137678964 + x * (S) 0.034468126344844616511))))));
+        }
+        else if constexpr (order == 8)
+        {
+            return (S) 0.16666666674500147463 + x * ((S) 0.074999990400578749461 + x * ((S) 0.044643293969257798082 + x * ((S) 0.030371802244334342397 + x * ((S) 0.022508214019098196044 + x * ((S) 0.016241884515235766178 + x * ((S) 0.01951690083332197281 + x * ((S) -0.0046683599299677643647 + x * (S) 0.033508380323173719351)))))));
+        }
+        else if constexpr (order == 9)
+        {
+            return (S) 0.16666666666028860225 + x * ((S) 0.075000000942740425548 + x * ((S) 0.044642805031913700286 + x * ((S) 0.030383431432436585539 + x * ((S) 0.022347195313764218629 + x * ((S) 0.017615076365186019602 + x * ((S) 0.012199990093323709847 + x * ((S) 0.019072009558143954668 + x * ((S) -0.0094006004950382501809 + x * (S) 0.033127285400384415238))))))));
+        }
+        else if constexpr (order == 10)
+        {
+            return (S) 0.16666666666718097353 + x * ((S) 0.07499999990979086006 + x * ((S) 0.044642863091575768193 + x * ((S) 0.030381740171809168571 + x * ((S) 0.022376340280805184078 + x * ((S) 0.017298152139803788131 + x * ((S) 0.014435082844164442276 + x * ((S) 0.0088655978977537928029 + x * ((S) 0.019726071265458515425 + x * ((S) -0.014093268841783013979 + x * (S) 0.033202871753293896447)))))))));
+        }
         else
         {
             return {};
@@ -40,7 +65,7 @@ namespace inv_trig_detail
     constexpr T acos_kernel (T x)
     {
         using S = scalar_of_t<T>;
-        static_assert (order >= 1 && order <= 5);
+        static_assert (order >= 1 && order <= 10);
 
         if constexpr (order == 1)
         {
@@ -62,6 +87,11 @@ namespace inv_trig_detail
         {
             return (S) 0.16664924406383360700 + x * ((S) 0.075837825275592588015 + x * ((S) 0.030665158374004904823 + x * ((S) 0.13572846625592635550 + x * ((S) -0.34609357317006372856 + x * (S) 0.50800920599560273061))));
         }
+        else if constexpr (order >= 6)
+        {
+            // at these orders, the asin() fit is already as accurate as a separate acos() fit would be
+            return asin_kernel<order> (x);
+        }
         else
         {
             return {};
@@ -74,7 +104,7 @@ namespace inv_trig_detail
     constexpr T atan_kernel (T x)
     {
         using S = scalar_of_t<T>;
-        static_assert (order == 2 ||(order >= 4 && order <= 7));
+        static_assert (order == 2 || (order >= 4 && order <= 7) || (order % 2 == 1 && order >= 9 && order <= 19));
 
         if constexpr (order == 2)
         {
@@ -101,6 +131,33 @@ namespace inv_trig_detail
             const auto den = (S) 1 + x * ((S) 0.275079063405 + x * ((S) 0.683311392128 + x * (S) 0.0624877111229));
             return (x + x_sq * num) / den;
         }
+        else if constexpr (order >= 9)
+        {
+            // For double-precision, the higher orders reduce the range further, using
+            // atan(x) = pi/4 + atan((x - 1) / (x + 1)) for x > tan(pi/8), and then
+            // approximate atan(w) ≈ w + w^3 p(w^2), where p is a minimax relative error
+            // fit of degree (order - 3) / 2 on w in [0, tan(pi/8)].
+            const auto reduce = x > (S) 0.41421356237309504880;
+            const auto w = select (reduce, (x - (S) 1) / (x + (S) 1), x);
+            const auto w_sq = w * w;
+
+            T poly {};
+            if constexpr (order == 9)
+                poly = (S) -0.33332949138645737142 + w_sq * ((S) 0.19977710026034073776 + w_sq * ((S) -0.13877678737239962812 + w_sq * (S) 0.080537226976149296822));
+            else if constexpr (order == 11)
+                poly = (S) -0.33333315188628346689 + w_sq * ((S) 0.199984715163229022 + w_sq * ((S) -0.14243533359137068038 + w_sq * ((S) 0.10593813828046918008 + w_sq * (S) -0.060782216403426970105)));
+            else if constexpr (order == 13)
+                poly = (S) -0.33333332499115937374 + w_sq * ((S) 0.19999903907196168969 + w_sq * ((S) -0.14282007741836510062 + w_sq * ((S) 0.11044691519388144846 + w_sq * ((S) -0.08476269263660577588 + w_sq * (S) 0.04744049720136734355))));
+            else if constexpr (order == 15)
+                poly = (S) -0.33333333295729324362 + w_sq * ((S) 0.19999994326773656451 + w_sq * ((S) -0.14285423642390522972 + w_sq * ((S) 0.11104004304725417889 + w_sq * ((S) -0.089968446343896379579 + w_sq * ((S) 0.069912398614382266608 + w_sq * (S) -0.037924742831650618212)))));
+            else if constexpr (order == 17)
+                poly = (S) -0.33333333331663712721 + w_sq * ((S) 0.19999999680646946918 + w_sq * ((S) -0.14285693345913205594 + w_sq * ((S) 0.11110444023982013944 + w_sq * ((S) -0.090790616989679734317 + w_sq * ((S) 0.075680087861785635544 + w_sq * ((S) -0.058891319895541972868 + w_sq * (S) 0.030866412365892461337))))));
+            else
+                poly = (S) -0.33333333333260084218 + w_sq * ((S) 0.19999999982683599151 + w_sq * ((S) -0.1428571287290637345 + w_sq * ((S) 0.1111105440975944184 + w_sq * ((S) -0.090896150687366758449 + w_sq * ((S) 0.076743187832611516522 + w_sq * ((S) -0.065102491131285747332 + w_sq * ((S) 0.050374261197423107195 + w_sq * (S) -0.025474359286283218086)))))));
+
+            const auto atan_w = w + poly * (w_sq * w);
+            return select (reduce, (S) M_PI_4 + atan_w, atan_w);
+        }
         else
         {
             return {};
@@ -112,8 +169,11 @@ namespace inv_trig_detail
  * Approximation of asin(x) using asin(x) ≈ p(x^2) * x^3 + x for x in [0, 0.5],
  * and asin(x) ≈ pi/2 - p((1-x)/2) * ((1-x)/2)^3/2 + ((1-x)/2)^1/2 for x in [0.5, 1],
  * where p(x) is a polynomial fit to achieve the minimum absolute error.
+ *
+ * For |x| > 1, the result is NaN with the ieee special_value_policy,
+ * or asin(+/-1) with the saturate policy.
  */
-template <int order, typename T>
+template <int order, typename T, special_value_policy policy = special_value_policy::unchecked>
 T asin (T x)
 {
     using S = scalar_of_t<T>;
@@ -123,6 +183,9 @@ T asin (T x)
     using xsimd::abs, xsimd::sqrt;
 #endif
 
+    if constexpr (policy == special_value_policy::saturate)
+        x = clamp_nan_to_low (x, (S) -1, (S) 1);
+
     const auto abs_x = abs (x);
 
     const auto reflect = abs_x > (S) 0.5;
@@ -133,14 +196,18 @@ T asin (T x)
 
     auto z2 = z1 * (z0 * x2) + x2;
     auto res = select (reflect, (S) M_PI_2 - (z2 + z2), z2);
-    return select (x > (S) 0, res, -res);
+    res = select (x > (S) 0, res, -res);
+    if constexpr (has_ieee_special_values (policy))
+        return select (abs_x <= (S) 1, res, T { std::numeric_limits<S>::quiet_NaN() });
+    else
+        return res;
 }
 
 /**
  * Approximation of acos(x) using the same approach as asin(x),
- * but with a different polynomial fit.
+ * but with a different polynomial fit (and the same special value handling).
  */
-template <int order, typename T>
+template <int order, typename T, special_value_policy policy = special_value_policy::unchecked>
 T acos (T x)
 {
     using S = scalar_of_t<T>;
@@ -150,6 +217,9 @@ T acos (T x)
     using xsimd::abs, xsimd::sqrt;
 #endif
 
+    if constexpr (policy == special_value_policy::saturate)
+        x = clamp_nan_to_low (x, (S) -1, (S) 1);
+
     const auto abs_x = abs (x);
 
     const auto reflect = abs_x > (S) 0.5;
@@ -160,7 +230,11 @@ T acos (T x)
 
     auto z2 = z1 * (z0 * x2) + x2;
     auto res = select (reflect, (S) M_PI_2 - (z2 + z2), z2);
-    return (S) M_PI_2 - select (x > (S) 0, res, -res);
+    res = (S) M_PI_2 - select (x > (S) 0, res, -res);
+    if constexpr (has_ieee_special_values (policy))
+        return select (abs_x <= (S) 1, res, T { std::numeric_limits<S>::quiet_NaN() });
+    else
+        return res;
 }
 
 /**
@@ -186,4 +260,32 @@ T atan (T x)
     const auto res = select (reflect, (S) M_PI_2 - atan_01, atan_01);
     return select (x > (S) 0, res, -res);
 }
+
+/**
+ * Approximation of atan2(y, x), using the same polynomial approximation as atan(x),
+ * evaluated at min(|x|, |y|) / max(|x|, |y|) (which is always in [0, 1]),
+ * and then reflected into the correct octant. The sign of the result is taken from
+ * the sign bit of y, so atan2(-0, -1) = -pi, as with std::atan2. Returns ±0 for atan2(±0, ±0).
+ */
+template <int order, typename T>
+T atan2 (T y, T x)
+{
+    using S = scalar_of_t<T>;
+
+    using std::abs, std::min, std::max, std::copysign;
+#if defined(XSIMD_HPP)
+    using xsimd::abs, xsimd::min, xsimd::max, xsimd::copysign;
+#endif
+
+    const auto abs_x = abs (x);
+    const auto abs_y = abs (y);
+    const auto max_xy = max (abs_x, abs_y);
+
+    const auto z = select (max_xy > (S) 0, min (abs_x, abs_y) / max_xy, T { (S) 0 });
+    const auto atan_01 = inv_trig_detail::atan_kernel<order> (z);
+
+    auto res = select (abs_y > abs_x, (S) M_PI_2 - atan_01, atan_01);
+    res = select (x < (S) 0, (S) M_PI - res, res);
+    return copysign (res, y);
+}
 } // namespace math_approx
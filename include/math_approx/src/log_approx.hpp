@@ -58,7 +58,7 @@ namespace log_detail
             }
             else
             {
-                static_assert (order >= 1 && order <= 6);
+                static_assert (order >= 1 && order <= 10);
                 if constexpr (order == 1)
                 {
                     return (S) -1 + x;
@@ -98,6 +98,22 @@ namespace log_detail
                     const auto x_1_2_3_4_5_6 = x_1_2 + x_3_4_5_6 * x_sq;
                     return (S) -3.04376925958 + x_1_2_3_4_5_6 * x;
                 }
+                else if constexpr (order >= 7)
+                {
+                    // For double-precision, a polynomial in x converges too slowly, so the higher
+                    // orders use log2(x) = s * p(s^2), with s = (x - 1) / (x + 1) in [0, 1/3],
+                    // where p(s^2) is a minimax fit with (order - 1) terms.
+                    const auto s = (x - (S) 1) / (x + (S) 1);
+                    const auto s_sq = s * s;
+                    if constexpr (order == 7)
+                        return s * ((S) 2.8853900798586549191 + s_sq * ((S) 0.96179717008691598899 + s_sq * ((S) 0.57704433989705392383 + s_sq * ((S) 0.41321373030746196893 + s_sq * ((S) 0.30590528926793130414 + s_sq * (S) 0.3611491577987948322)))));
+                    else if constexpr (order == 8)
+                        return s * ((S) 2.8853900818344775778 + s_sq * ((S) 0.96179667518370132415 + s_sq * ((S) 0.57707981067134691626 + s_sq * ((S) 0.41212309835699520919 + s_sq * ((S) 0.3222180252296893896 + s_sq * ((S) 0.24397284571878309204 + s_sq * (S) 0.32385269182329609971))))));
+                    else if constexpr (order == 9)
+                        return s * ((S) 2.8853900817762608915 + s_sq * ((S) 0.96179669463690819031 + s_sq * ((S) 0.57707792795545433085 + s_sq * ((S) 0.41220350720549666793 + s_sq * ((S) 0.32045405259149731183 + s_sq * ((S) 0.26470633970241329009 + s_sq * ((S) 0.19970209122563985152 + s_sq * (S) 0.29744638152526913194)))))));
+                    else
+                        return s * ((S) 2.8853900817779758841 + s_sq * ((S) 0.96179669389976894837 + s_sq * ((S) 0.57707802045820813045 + s_sq * ((S) 0.41219829163417835107 + s_sq * ((S) 0.32061008365868092897 + s_sq * ((S) 0.26205725445475878116 + s_sq * ((S) 0.22532566706191228084 + s_sq * ((S) 0.16590054622955020165 + s_sq * (S) 0.27813672501250078264))))))));
+                }
                 else
                 {
                     return {};
@@ -105,6 +121,10 @@ namespace log_detail
             }
         }
     };
+
+    /** log(Base, x), with the saturate or ieee special_value_policy (see below) */
+    template <typename Base, int order, bool C1_continuous, typename Log2ProviderType, special_value_policy policy, typename T>
+    T log_with_special_values (T x);
 }
 
 #if defined(__GNUC__)
@@ -114,9 +134,12 @@ namespace log_detail
 #endif
 
 /** approximation for log(Base, x) (32-bit) */
-template <typename Base, int order, bool C1_continuous, typename Log2ProviderType = log_detail::Log2Provider>
+template <typename Base, int order, bool C1_continuous, typename Log2ProviderType = log_detail::Log2Provider, special_value_policy policy = special_value_policy::unchecked>
 constexpr float log (float x)
 {
+    if constexpr (policy != special_value_policy::unchecked)
+        return log_detail::log_with_special_values<Base, order, C1_continuous, Log2ProviderType, policy> (x);
+
     const auto vi = bit_cast<int32_t> (x);
     const auto ex = vi & 0x7f800000;
     const auto e = (ex >> 23) - 127;
@@ -124,13 +147,20 @@ constexpr float log (float x)
     const auto vf = bit_cast<float> (vfi);
 
     constexpr auto log2_base_r = 1.0f / Base::log2_base;
-    return log2_base_r * ((float) e + Log2ProviderType::template log2_approx<float, order, C1_continuous> (vf));
+    const auto y = log2_base_r * ((float) e + Log2ProviderType::template log2_approx<float, order, C1_continuous> (vf));
+    if constexpr (pow_detail::has_offset<Base>::value)
+        return y - Base::offset * log2_base_r;
+    else
+        return y;
 }
 
 /** approximation for log(x) (64-bit) */
-template <typename Base, int order, bool C1_continuous, typename Log2ProviderType = log_detail::Log2Provider>
+template <typename Base, int order, bool C1_continuous, typename Log2ProviderType = log_detail::Log2Provider, special_value_policy policy = special_value_policy::unchecked>
 constexpr double log (double x)
 {
+    if constexpr (policy != special_value_policy::unchecked)
+        return log_detail::log_with_special_values<Base, order, C1_continuous, Log2ProviderType, policy> (x);
+
     const auto vi = bit_cast<int64_t> (x);
     const auto ex = vi & 0x7ff0000000000000;
     const auto e = (ex >> 52) - 1023;
@@ -138,14 +168,21 @@ constexpr double log (double x)
     const auto vf = bit_cast<double> (vfi);
 
     constexpr auto log2_base_r = 1.0 / Base::log2_base;
-    return log2_base_r * ((double) e + Log2ProviderType::template log2_approx<double, order, C1_continuous> (vf));
+    const auto y = log2_base_r * ((double) e + Log2ProviderType::template log2_approx<double, order, C1_continuous> (vf));
+    if constexpr (pow_detail::has_offset<Base>::value)
+        return y - Base::offset * log2_base_r;
+    else
+        return y;
 }
 
 #if defined(XSIMD_HPP)
 /** approximation for pow(Base, x) (32-bit SIMD) */
-template <typename Base, int order, bool C1_continuous, typename Log2ProviderType = log_detail::Log2Provider>
+template <typename Base, int order, bool C1_continuous, typename Log2ProviderType = log_detail::Log2Provider, special_value_policy policy = special_value_policy::unchecked>
 xsimd::batch<float> log (xsimd::batch<float> x)
 {
+    if constexpr (policy != special_value_policy::unchecked)
+        return log_detail::log_with_special_values<Base, order, C1_continuous, Log2ProviderType, policy> (x);
+
     const auto vi = xsimd::bit_cast<xsimd::batch<int32_t>> (x);
     const auto ex = vi & 0x7f800000;
     const auto e = (ex >> 23) - 127;
@@ -153,13 +190,20 @@ xsimd::batch<float> log (xsimd::batch<float> x)
     const auto vf = xsimd::bit_cast<xsimd::batch<float>> (vfi);
 
     static constexpr auto log2_base_r = 1.0f / Base::log2_base;
-    return log2_base_r * (xsimd::to_float (e) + Log2ProviderType::template log2_approx<xsimd::batch<float>, order, C1_continuous> (vf));
+    const auto y = log2_base_r * (xsimd::to_float (e) + Log2ProviderType::template log2_approx<xsimd::batch<float>, order, C1_continuous> (vf));
+    if constexpr (pow_detail::has_offset<Base>::value)
+        return y - Base::offset * log2_base_r;
+    else
+        return y;
 }
 
 /** approximation for pow(Base, x) (64-bit SIMD) */
-template <typename Base, int order, bool C1_continuous, typename Log2ProviderType = log_detail::Log2Provider>
+template <typename Base, int order, bool C1_continuous, typename Log2ProviderType = log_detail::Log2Provider, special_value_policy policy = special_value_policy::unchecked>
 xsimd::batch<double> log (xsimd::batch<double> x)
 {
+    if constexpr (policy != special_value_policy::unchecked)
+        return log_detail::log_with_special_values<Base, order, C1_continuous, Log2ProviderType, policy> (x);
+
     const auto vi = xsimd::bit_cast<xsimd::batch<int64_t>> (x);
     const auto ex = vi & 0x7ff0000000000000;
     const auto e = (ex >> 52) - 1023;
@@ -167,7 +211,11 @@ xsimd::batch<double> log (xsimd::batch<double> x)
     const auto vf = xsimd::bit_cast<xsimd::batch<double>> (vfi);
 
     static constexpr auto log2_base_r = 1.0 / Base::log2_base;
-    return log2_base_r * (xsimd::to_float (e) + Log2ProviderType::template log2_approx<xsimd::batch<double>, order, C1_continuous> (vf));
+    const auto y = log2_base_r * (xsimd::to_float (e) + Log2ProviderType::template log2_approx<xsimd::batch<double>, order, C1_continuous> (vf));
+    if constexpr (pow_detail::has_offset<Base>::value)
+        return y - Base::offset * log2_base_r;
+    else
+        return y;
 }
 #endif
 
@@ -175,40 +223,79 @@ xsimd::batch<double> log (xsimd::batch<double> x)
 #pragma GCC diagnostic pop // end ignore strict-aliasing warnings
 #endif
 
+namespace log_detail
+{
+    /**
+     * With the saturate policy, x is clamped to the (normal) floating-point range,
+     * so that the result is always finite. With the ieee policy, subnormal inputs
+     * are scaled by 2^64 (which is then subtracted from the result), and zero,
+     * negative, infinite, and NaN inputs give -Inf, NaN, +Inf, and NaN. The
+     * flush_denormals policy is the same, except that subnormal inputs are
+     * treated as zero.
+     */
+    template <typename Base, int order, bool C1_continuous, typename Log2ProviderType, special_value_policy policy, typename T>
+    T log_with_special_values (T x)
+    {
+        using S = scalar_of_t<T>;
+        using limits = std::numeric_limits<S>;
+
+        if constexpr (policy == special_value_policy::saturate)
+        {
+            return log<Base, order, C1_continuous, Log2ProviderType> (clamp_nan_to_low (x, limits::min(), limits::max()));
+        }
+        else if constexpr (policy == special_value_policy::flush_denormals)
+        {
+            const auto y = log<Base, order, C1_continuous, Log2ProviderType> (x);
+            return select (x >= limits::min(),
+                           select (x < limits::infinity(), y, T { limits::infinity() }),
+                           select (x >= (S) 0, T { -limits::infinity() }, T { limits::quiet_NaN() }));
+        }
+        else
+        {
+            const auto is_subnormal = x < limits::min();
+            const auto y = log<Base, order, C1_continuous, Log2ProviderType> (select (is_subnormal, x * (S) 18446744073709551616.0, x)) // 2^64
+                           - select (is_subnormal, T { (S) 64 / Base::log2_base }, T { (S) 0 });
+            return select (x > (S) 0,
+                           select (x < limits::infinity(), y, T { limits::infinity() }),
+                           select (x == (S) 0, T { -limits::infinity() }, T { limits::quiet_NaN() }));
+        }
+    }
+} // namespace log_detail
+
 /**
  * Approximation of log(x), using
  * log(x) = (1 / log2(e)) * (Exponent(x) + log2(1 + Mantissa(x))
  */
-template <int order, bool C1_continuous = false, typename T>
+template <int order, bool C1_continuous = false, typename T, special_value_policy policy = special_value_policy::unchecked>
 constexpr T log (T x)
 {
-    return log<pow_detail::BaseE<scalar_of_t<T>>, order, C1_continuous> (x);
+    return log<pow_detail::BaseE<scalar_of_t<T>>, order, C1_continuous, log_detail::Log2Provider, policy> (x);
 }
 
 /**
  * Approximation of log2(x), using
  * log2(x) = Exponent(x) + log2(1 + Mantissa(x)
  */
-template <int order, bool C1_continuous = false, typename T>
+template <int order, bool C1_continuous = false, typename T, special_value_policy policy = special_value_policy::unchecked>
 constexpr T log2 (T x)
 {
-    return log<pow_detail::Base2<scalar_of_t<T>>, order, C1_continuous> (x);
+    return log<pow_detail::Base2<scalar_of_t<T>>, order, C1_continuous, log_detail::Log2Provider, policy> (x);
 }
 
 /**
  * Approximation of log10(x), using
  * log10(x) = (1 / log2(10)) * (Exponent(x) + log2(1 + Mantissa(x))
  */
-template <int order, bool C1_continuous = false, typename T>
+template <int order, bool C1_continuous = false, typename T, special_value_policy policy = special_value_policy::unchecked>
 constexpr T log10 (T x)
 {
-    return log<pow_detail::Base10<scalar_of_t<T>>, order, C1_continuous> (x);
+    return log<pow_detail::Base10<scalar_of_t<T>>, order, C1_continuous, log_detail::Log2Provider, policy> (x);
 }
 
 /** Approximation of log(1 + x), using math_approx::log(x) */
-template <int order, bool C1_continuous = false, typename T>
+template <int order, bool C1_continuous = false, typename T, special_value_policy policy = special_value_policy::unchecked>
 constexpr T log1p (T x)
 {
-    return log<pow_detail::BaseE<scalar_of_t<T>>, order, C1_continuous> ((T) 1 + x);
+    return log<pow_detail::BaseE<scalar_of_t<T>>, order, C1_continuous, log_detail::Log2Provider, policy> ((T) 1 + x);
 }
 }
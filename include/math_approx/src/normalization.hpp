@@ -0,0 +1,187 @@
+#pragma once
+
+#include "basic_math.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace math_approx
+{
+namespace normalization_detail
+{
+    /**
+     * Computes sum(x - shift) and sum((x - shift)^2) in a single pass.
+     * Shifting by a value close to the mean (e.g. the first element)
+     * avoids the catastrophic cancellation of the naive one-pass variance.
+     */
+    template <typename T>
+    void accumulate (const T* x, size_t N, T shift, T& sum, T& sum_sq)
+    {
+        sum = (T) 0;
+        sum_sq = (T) 0;
+
+        size_t n = 0;
+#if defined(XSIMD_HPP)
+        using B = xsimd::batch<T>;
+        auto acc = B ((T) 0);
+        auto acc_sq = B ((T) 0);
+        for (; n + B::size <= N; n += B::size)
+        {
+            const auto v = B::load_unaligned (x + n) - shift;
+            acc += v;
+            acc_sq = xsimd::fma (v, v, acc_sq);
+        }
+        sum = xsimd::reduce_add (acc);
+        sum_sq = xsimd::reduce_add (acc_sq);
+#endif
+
+        for (; n < N; ++n)
+        {
+            const auto v = x[n] - shift;
+            sum += v;
+            sum_sq += v * v;
+        }
+    }
+
+    /** Computes y = (x - mean) * inv_std * scale + bias */
+    template <bool has_scale, bool has_bias, typename T>
+    void apply (const T* x, T* y, size_t N, T mean, T inv_std, const T* scale, const T* bias)
+    {
+        const auto process = [mean, inv_std] (auto v, auto s, auto b)
+        {
+            auto out = (v - mean) * inv_std;
+            if constexpr (has_scale)
+                out *= s;
+            if constexpr (has_bias)
+                out += b;
+            return out;
+        };
+
+        size_t n = 0;
+#if defined(XSIMD_HPP)
+        using B = xsimd::batch<T>;
+        for (; n + B::size <= N; n += B::size)
+        {
+            const auto s = has_scale ? B::load_unaligned (scale + n) : B ((T) 1);
+            const auto b = has_bias ? B::load_unaligned (bias + n) : B ((T) 0);
+            process (B::load_unaligned (x + n), s, b).store_unaligned (y + n);
+        }
+#endif
+
+        for (; n < N; ++n)
+            y[n] = process (x[n], has_scale ? scale[n] : (T) 1, has_bias ? bias[n] : (T) 0);
+    }
+
+    template <typename T>
+    void apply (const T* x, T* y, size_t N, T mean, T inv_std, const T* scale, const T* bias)
+    {
+        if (scale != nullptr && bias != nullptr)
+            apply<true, true> (x, y, N, mean, inv_std, scale, bias);
+        else if (scale != nullptr)
+            apply<true, false> (x, y, N, mean, inv_std, scale, bias);
+        else if (bias != nullptr)
+            apply<false, true> (x, y, N, mean, inv_std, scale, bias);
+        else
+            apply<false, false> (x, y, N, mean, inv_std, scale, bias);
+    }
+
+    /**
+     * Normalizes a matrix row-by-row. The per-row statistics are
+     * computed for a group of rows at a time, so that the inverse
+     * square roots for the whole group can be computed with a single
+     * SIMD rsqrt (or, for double, a single SIMD sqrt and divide).
+     */
+    template <bool subtract_mean, typename T>
+    void normalize_rows (const T* x, T* y, size_t num_rows, size_t num_cols, size_t row_stride, const T* scale, const T* bias, T epsilon)
+    {
+#if defined(XSIMD_HPP)
+        using B = xsimd::batch<T>;
+        constexpr auto group_size = B::size;
+        constexpr auto group_alignment = B::arch_type::alignment();
+#else
+        constexpr size_t group_size = 1;
+        constexpr size_t group_alignment = alignof (T);
+#endif
+
+        // empty rows have nothing to normalize (and no statistics)
+        if (num_rows == 0 || num_cols == 0)
+            return;
+
+        const auto inv_num_cols = (T) 1 / (T) num_cols;
+        T means[group_size] {};
+        alignas (group_alignment) T vars[group_size] {};
+        alignas (group_alignment) T inv_stds[group_size] {};
+
+        for (size_t row_start = 0; row_start < num_rows; row_start += group_size)
+        {
+            const auto rows_in_group = std::min (group_size, num_rows - row_start);
+            for (size_t i = 0; i < rows_in_group; ++i)
+            {
+                const auto* x_row = x + (row_start + i) * row_stride;
+                const auto shift = subtract_mean ? x_row[0] : (T) 0;
+
+                T sum, sum_sq;
+                accumulate (x_row, num_cols, shift, sum, sum_sq);
+
+                const auto shifted_mean = sum * inv_num_cols;
+                means[i] = subtract_mean ? shift + shifted_mean : (T) 0;
+                vars[i] = sum_sq * inv_num_cols - (subtract_mean ? shifted_mean * shifted_mean : (T) 0);
+            }
+
+#if defined(XSIMD_HPP)
+            // rsqrt() for doubles goes through the single-precision rsqrtps, so its
+            // Newton-Raphson step only reaches ~1e-7 relative accuracy
+            if constexpr (std::is_same_v<T, double>)
+                ((T) 1 / xsimd::sqrt (B::load_aligned (vars) + epsilon)).store_aligned (inv_stds);
+            else
+                rsqrt (B::load_aligned (vars) + epsilon).store_aligned (inv_stds);
+#else
+            inv_stds[0] = rsqrt (vars[0] + epsilon);
+#endif
+
+            for (size_t i = 0; i < rows_in_group; ++i)
+                apply (x + (row_start + i) * row_stride, y + (row_start + i) * row_stride, num_cols, means[i], inv_stds[i], scale, bias);
+        }
+    }
+} // namespace normalization_detail
+
+/**
+ * RMS normalization of a vector: y = x / sqrt(mean(x^2) + epsilon) * scale.
+ * The scale pointer may be null, in which case no scaling is applied.
+ */
+template <typename T>
+void rms_norm (const T* x, T* y, size_t N, const T* scale = nullptr, T epsilon = (T) 1.0e-6)
+{
+    normalization_detail::normalize_rows<false> (x, y, 1, N, N, scale, (const T*) nullptr, epsilon);
+}
+
+/**
+ * Layer normalization of a vector: y = (x - mean(x)) / sqrt(var(x) + epsilon) * scale + bias.
+ * The scale and bias pointers may be null, in which case they are not applied.
+ */
+template <typename T>
+void layer_norm (const T* x, T* y, size_t N, const T* scale = nullptr, const T* bias = nullptr, T epsilon = (T) 1.0e-5)
+{
+    normalization_detail::normalize_rows<true> (x, y, 1, N, N, scale, bias, epsilon);
+}
+
+/**
+ * RMS normalization of each row of a row-major matrix.
+ * The scale vector (length num_cols) is shared by all rows, and may be null.
+ */
+template <typename T>
+void rms_norm_rows (const T* x, T* y, size_t num_rows, size_t num_cols, const T* scale = nullptr, T epsilon = (T) 1.0e-6)
+{
+    normalization_detail::normalize_rows<false> (x, y, num_rows, num_cols, num_cols, scale, (const T*) nullptr, epsilon);
+}
+
+/**
+ * Layer normalization of each row of a row-major matrix.
+ * The scale and bias vectors (length num_cols) are shared by all rows, and may be null.
+ */
+template <typename T>
+void layer_norm_rows (const T* x, T* y, size_t num_rows, size_t num_cols, const T* scale = nullptr, const T* bias = nullptr, T epsilon = (T) 1.0e-5)
+{
+    normalization_detail::normalize_rows<true> (x, y, num_rows, num_cols, num_cols, scale, bias, epsilon);
+}
+} // namespace math_approx
@@ -0,0 +1,202 @@
+#pragma once
+
+#include "bulk_approx.hpp"
+#include "oscillators.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace math_approx
+{
+namespace oscillator_bank_detail
+{
+#if defined(XSIMD_HPP)
+    using vector_type = xsimd::batch<float>;
+    static constexpr size_t vector_size = vector_type::size;
+
+    inline float reduce_add (vector_type x)
+    {
+        return xsimd::reduce_add (x);
+    }
+#else
+    using vector_type = float;
+    static constexpr size_t vector_size = 1;
+#endif
+
+    inline float reduce_add (float x)
+    {
+        return x;
+    }
+
+    inline size_t round_up_to_vector (size_t n)
+    {
+        return (n + vector_size - 1) / vector_size * vector_size;
+    }
+} // namespace oscillator_bank_detail
+
+/**
+ * A bank of sine oscillators (partials), for additive or modal synthesis.
+ *
+ * The partials' phases, increments, and amplitudes are stored as
+ * structure-of-arrays, and are advanced one SIMD batch of partials
+ * at a time (when XSIMD is available), with uint32 phases as in
+ * sine_oscillator. The partials are then summed into the output.
+ *
+ * Amplitude changes are smoothed per-partial with a one-pole filter,
+ * and partials at or above the band-limit (Nyquist by default) are
+ * faded out. Partials at the end of the bank with zero amplitude are
+ * skipped entirely, so when the partials are sorted by frequency (e.g.
+ * a harmonic series), band-limiting also reduces the amount of work.
+ */
+template <int order = 9>
+class oscillator_bank
+{
+public:
+    /**
+     * Prepares the bank for a given sample rate and number of partials,
+     * with all partials silent. This is the only method that allocates memory.
+     */
+    void prepare (float sample_rate, size_t num_partials, float smoothing_time_seconds = 0.01f)
+    {
+        fs = sample_rate;
+        band_limit = 0.5f * sample_rate;
+        smoothing_coeff = (float) (1.0 - std::exp (-1.0 / ((double) smoothing_time_seconds * (double) sample_rate)));
+
+        size = num_partials;
+        const auto capacity = oscillator_bank_detail::round_up_to_vector (num_partials);
+        phases.assign (capacity, 0u);
+        increments.assign (capacity, 0u);
+        frequencies.assign (capacity, 0.0f);
+        gains.assign (capacity, 0.0f);
+        target_amplitudes.assign (capacity, 0.0f);
+        amplitudes.assign (capacity, 0.0f);
+        num_active = 0;
+    }
+
+    /** Returns the number of partials in the bank */
+    [[nodiscard]] size_t num_partials() const noexcept { return size; }
+
+    /** Returns the number of partials currently being computed (including SIMD padding) */
+    [[nodiscard]] size_t num_active_partials() const noexcept { return num_active; }
+
+    /** Sets the frequency (in Hz) of a partial */
+    void set_frequency (size_t partial, float frequency)
+    {
+        frequencies[partial] = frequency;
+        increments[partial] = phase_increment ((double) frequency, (double) fs);
+        update_target (partial);
+    }
+
+    /** Sets the (target) amplitude of a partial */
+    void set_amplitude (size_t partial, float amplitude)
+    {
+        gains[partial] = amplitude;
+        update_target (partial);
+    }
+
+    /** Sets the frequency (in Hz) and (target) amplitude of a partial */
+    void set_partial (size_t partial, float frequency, float amplitude)
+    {
+        gains[partial] = amplitude;
+        set_frequency (partial, frequency);
+    }
+
+    /** Sets the phase (in turns) of a partial */
+    void set_phase (size_t partial, float turns)
+    {
+        phases[partial] = oscillator_detail::to_phase ((double) turns);
+    }
+
+    /** Sets the frequency (in Hz) at or above which partials are culled */
+    void set_band_limit (float frequency)
+    {
+        band_limit = frequency;
+        for (size_t i = 0; i < size; ++i)
+            update_target (i);
+    }
+
+    /** Resets all phases to zero, and jumps the amplitudes to their targets */
+    void reset()
+    {
+        std::fill (phases.begin(), phases.end(), 0u);
+        std::copy (target_amplitudes.begin(), target_amplitudes.end(), amplitudes.begin());
+        update_num_active();
+    }
+
+    /**
+     * Generates a block of samples, and adds them to the output buffer
+     * (so that several banks/voices can be mixed into the same buffer).
+     */
+    void process_block (float* output, size_t N)
+    {
+        using namespace bulk_detail;
+        using V = oscillator_bank_detail::vector_type;
+        using P = phase_of_t<V>;
+        static constexpr auto step = oscillator_bank_detail::vector_size;
+
+        auto* phase_data = phases.data();
+        const auto* increment_data = increments.data();
+        const auto* target_data = target_amplitudes.data();
+        auto* amplitude_data = amplitudes.data();
+
+        for (size_t n = 0; n < N; ++n)
+        {
+            auto sum = V (0.0f);
+            for (size_t k = 0; k < num_active; k += step)
+            {
+                auto amplitude = load<V> (amplitude_data + k);
+                amplitude += smoothing_coeff * (load<V> (target_data + k) - amplitude);
+                store (amplitude_data + k, amplitude);
+
+                const auto phase = load<P> (phase_data + k);
+                sum += amplitude * sin_phase<order> (phase);
+                store (phase_data + k, phase + load<P> (increment_data + k));
+            }
+            output[n] += oscillator_bank_detail::reduce_add (sum);
+        }
+
+        update_num_active();
+    }
+
+private:
+    void update_target (size_t partial)
+    {
+        const auto target = std::abs (frequencies[partial]) < band_limit ? gains[partial] : 0.0f;
+        target_amplitudes[partial] = target;
+        if (target != 0.0f)
+            num_active = std::max (num_active, oscillator_bank_detail::round_up_to_vector (partial + 1));
+    }
+
+    void update_num_active()
+    {
+        // snap amplitudes that have (nearly) reached their target, so that
+        // faded-out partials reach exactly zero, rather than decaying into denormals
+        static constexpr float snap_threshold = 1.0e-6f;
+
+        size_t last_active = 0;
+        for (size_t i = 0; i < num_active; ++i)
+        {
+            if (std::abs (amplitudes[i] - target_amplitudes[i]) < snap_threshold)
+                amplitudes[i] = target_amplitudes[i];
+
+            if (amplitudes[i] != 0.0f || target_amplitudes[i] != 0.0f)
+                last_active = i + 1;
+        }
+        num_active = oscillator_bank_detail::round_up_to_vector (last_active);
+    }
+
+    float fs = 48000.0f;
+    float band_limit = 24000.0f;
+    float smoothing_coeff = 1.0f;
+
+    size_t size = 0;
+    size_t num_active = 0;
+    std::vector<uint32_t> phases;
+    std::vector<uint32_t> increments;
+    std::vector<float> frequencies;
+    std::vector<float> gains;
+    std::vector<float> target_amplitudes;
+    std::vector<float> amplitudes;
+};
+} // namespace math_approx
@@ -0,0 +1,202 @@
+#pragma once
+
+#include "basic_math.hpp"
+#include "trig_approx.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+namespace math_approx
+{
+namespace oscillator_detail
+{
+    template <typename T>
+    struct phase_of
+    {
+        using type = uint32_t;
+    };
+
+#if defined(XSIMD_HPP)
+    template <typename T, typename Arch>
+    struct phase_of<xsimd::batch<T, Arch>>
+    {
+        using type = xsimd::batch<uint32_t, Arch>;
+    };
+#endif
+
+    /** Converts a value in turns (or a fraction of 2^32) to a phase, with round-to-nearest and wrapping */
+    inline uint32_t to_phase (double turns)
+    {
+        return static_cast<uint32_t> (std::llround (turns * 4294967296.0));
+    }
+
+    /** Applies to_phase() to each lane of x (which may be a scalar or a SIMD batch) */
+    template <typename P, typename T, typename Func>
+    P to_phase_lanes (T x, Func&& turns_of)
+    {
+        if constexpr (std::is_arithmetic_v<T>)
+        {
+            return to_phase (turns_of ((double) x));
+        }
+#if defined(XSIMD_HPP)
+        else
+        {
+            alignas (T::arch_type::alignment()) scalar_of_t<T> x_lanes[T::size];
+            alignas (T::arch_type::alignment()) uint32_t phase_lanes[T::size];
+            x.store_aligned (x_lanes);
+            for (size_t i = 0; i < T::size; ++i)
+                phase_lanes[i] = to_phase (turns_of ((double) x_lanes[i]));
+            return P::load_aligned (phase_lanes);
+        }
+#endif
+    }
+} // namespace oscillator_detail
+
+/** The phase type for an oscillator computing values of type T (uint32_t, or an XSIMD batch of uint32_t) */
+template <typename T>
+using phase_of_t = typename oscillator_detail::phase_of<T>::type;
+
+/**
+ * Converts a phase (where 2^32 is one full turn) to turns in the range [-1/2, 1/2),
+ * by re-interpreting the phase as a signed integer, and scaling by 2^-32.
+ */
+inline float phase_to_turns (uint32_t phase)
+{
+    return (float) bit_cast<int32_t> (phase) * 0x1p-32f;
+}
+
+#if defined(XSIMD_HPP)
+/**
+ * Converts a phase (where 2^32 is one full turn) to turns in the range [-1/2, 1/2),
+ * by re-interpreting the phase as a signed integer, and scaling by 2^-32.
+ */
+template <typename Arch>
+xsimd::batch<float, Arch> phase_to_turns (xsimd::batch<uint32_t, Arch> phase)
+{
+    return xsimd::to_float (xsimd::bit_cast<xsimd::batch<int32_t, Arch>> (phase)) * 0x1p-32f;
+}
+#endif
+
+/** Approximation of sin(2*pi*phase / 2^32), without any floating-point range reduction */
+template <int order, typename P>
+auto sin_phase (P phase)
+{
+    return sin_turns_mhalfpi_halfpi<order> (phase_to_turns (phase));
+}
+
+/** Approximation of cos(2*pi*phase / 2^32), without any floating-point range reduction */
+template <int order, typename P>
+auto cos_phase (P phase)
+{
+    return cos_turns_mhalfpi_halfpi<order> (phase_to_turns (phase));
+}
+
+/** Returns the phase increment per sample, for a given frequency and sample rate */
+inline uint32_t phase_increment (double frequency, double sample_rate)
+{
+    return oscillator_detail::to_phase (frequency / sample_rate);
+}
+
+/**
+ * A sine oscillator, driven by a uint32 phase accumulator.
+ *
+ * The phase wraps for free with unsigned integer overflow, and is
+ * mapped to [-1/2, 1/2) turns with a signed conversion and a scale,
+ * so there's no floating-point rounding in the loop, and the phase
+ * never drifts, no matter how long the oscillator runs.
+ *
+ * T may be float, or an XSIMD batch of floats, in which case each lane
+ * is an independent voice, with its own frequency and phase.
+ */
+template <int order = 9, typename T = float>
+class sine_oscillator
+{
+public:
+    using S = scalar_of_t<T>;
+    using P = phase_of_t<T>;
+
+    /** Prepares the oscillator for a given sample rate (needed for frequency modulation) */
+    void prepare (S sample_rate)
+    {
+        fs = sample_rate;
+        phase_per_hz = (S) (4294967296.0 / (double) sample_rate);
+    }
+
+    /** Sets the oscillator frequency (in Hz), which should be within (-fs/2, fs/2) */
+    void set_frequency (T frequency)
+    {
+        const auto sample_rate = (double) fs;
+        increment = oscillator_detail::to_phase_lanes<P> (frequency, [sample_rate] (double f)
+                                                          { return f / sample_rate; });
+    }
+
+    /** Sets the oscillator phase (in turns) */
+    void set_phase (T turns)
+    {
+        phase = oscillator_detail::to_phase_lanes<P> (turns, [] (double t)
+                                                      { return t; });
+    }
+
+    /** Resets the oscillator phase to zero */
+    void reset()
+    {
+        phase = P (0u);
+    }
+
+    /** Returns the next sample */
+    T process()
+    {
+        const auto y = sin_phase<order> (phase);
+        phase += increment;
+        return y;
+    }
+
+    /** Returns the next sample, with the frequency (in Hz) set for this sample only */
+    T process (T frequency)
+    {
+        const auto y = sin_phase<order> (phase);
+        phase += frequency_to_increment (frequency);
+        return y;
+    }
+
+    /** Generates a block of samples */
+    void process_block (T* output, size_t N)
+    {
+        for (size_t n = 0; n < N; ++n)
+            output[n] = process();
+    }
+
+    /** Generates a block of samples, with per-sample frequency modulation (in Hz) */
+    void process_block (T* output, const T* frequency, size_t N)
+    {
+        auto block_phase = phase;
+        for (size_t n = 0; n < N; ++n)
+        {
+            output[n] = sin_phase<order> (block_phase);
+            block_phase += frequency_to_increment (frequency[n]);
+        }
+        phase = block_phase;
+    }
+
+private:
+    P frequency_to_increment (T frequency) const
+    {
+        // clamp to the range of int32, so the conversion never overflows
+        constexpr auto max_increment = (S) 2147483520.0f;
+        const auto increment_f = frequency * phase_per_hz;
+
+        if constexpr (std::is_arithmetic_v<T>)
+            return bit_cast<uint32_t> ((int32_t) std::clamp (increment_f, -max_increment, max_increment));
+#if defined(XSIMD_HPP)
+        else
+            return xsimd::bit_cast<P> (xsimd::to_int (xsimd::clip (increment_f, T (-max_increment), T (max_increment))));
+#endif
+    }
+
+    S fs = (S) 48000;
+    S phase_per_hz = (S) (4294967296.0 / 48000.0);
+    P phase = P (0u);
+    P increment = P (0u);
+};
+} // namespace math_approx
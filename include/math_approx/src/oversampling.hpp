@@ -0,0 +1,425 @@
+#pragma once
+
+#include "bulk_approx.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace math_approx
+{
+/**
+ * The half-band filters used by oversampled_nonlinearity:
+ *
+ * linear: polyphase Kaiser-windowed FIR filters (linear phase, ~90 dB stopband)
+ * low_latency: polyphase IIR filters, made of two allpass chains (~90 dB stopband). These
+ *              aren't minimum phase, but have a much lower latency than the FIR filters,
+ *              at the cost of some phase distortion.
+ */
+enum class oversampling_phase
+{
+    linear,
+    low_latency,
+};
+
+namespace oversampling_detail
+{
+    /** The maximum number of 2x stages (i.e. 8x oversampling) */
+    static constexpr size_t max_stages = 3;
+
+    /**
+     * The stage's passband edge is at 0.22x the base sample rate, so the first stage
+     * (between 1x and 2x) needs a narrow transition band. Later stages run at higher
+     * rates, so they have wider transition bands, and need much shorter filters.
+     */
+    static constexpr int fir_half_lengths[max_stages] = { 28, 7, 5 };
+    static constexpr int iir_num_coefficients[max_stages] = { 7, 3, 2 };
+    static constexpr double iir_transition_bandwidths[max_stages] = { 0.06, 0.25, 0.375 };
+
+    inline double bessel_i0 (double x)
+    {
+        double sum = 1.0;
+        double term = 1.0;
+        for (int k = 1; term > 1.0e-20 * sum; ++k)
+        {
+            const auto y = x / (2.0 * (double) k);
+            term *= y * y;
+            sum += term;
+        }
+        return sum;
+    }
+
+    /**
+     * Designs a Kaiser-windowed half-band lowpass filter with 4M - 1 taps, and returns
+     * its even-indexed taps (the odd-indexed taps are zero, except the center tap, which is 1/2).
+     * The taps are scaled by 2, and normalized so that they sum to 1 (i.e. so that each
+     * polyphase branch has unity gain at DC).
+     */
+    inline std::vector<double> design_half_band_fir (int M, double beta = 9.0)
+    {
+        const auto length = 4 * M - 1;
+        std::vector<double> taps ((size_t) (2 * M));
+        double sum = 0.0;
+        for (int i = 0; i < 2 * M; ++i)
+        {
+            const auto n = 2 * i;
+            const auto k = (double) (n - (2 * M - 1));
+            const auto r = 2.0 * (double) n / (double) (length - 1) - 1.0;
+            const auto window = bessel_i0 (beta * std::sqrt (std::max (0.0, 1.0 - r * r))) / bessel_i0 (beta);
+            taps[(size_t) i] = std::sin (M_PI * k / 2.0) / (M_PI * k) * window;
+            sum += taps[(size_t) i];
+        }
+
+        for (auto& tap : taps)
+            tap /= sum;
+        return taps;
+    }
+
+    /**
+     * Designs the allpass coefficients for a polyphase IIR half-band filter, with
+     * the elliptic design from Laurent de Soras' HIIR library. The transition
+     * bandwidth is relative to the sample rate at which the filter runs. Even-indexed
+     * coefficients belong to the first allpass chain, and odd-indexed coefficients to the second.
+     */
+    inline std::vector<double> design_half_band_iir (int num_coefficients, double transition_bandwidth)
+    {
+        auto k = std::tan ((1.0 - transition_bandwidth * 2.0) * M_PI / 4.0);
+        k *= k;
+        const auto kk = std::pow (1.0 - k * k, 0.25);
+        const auto e = 0.5 * (1.0 - kk) / (1.0 + kk);
+        const auto e4 = e * e * e * e;
+        const auto q = e * (1.0 + e4 * (2.0 + e4 * (15.0 + 150.0 * e4)));
+
+        const auto order = num_coefficients * 2 + 1;
+        std::vector<double> coefficients ((size_t) num_coefficients);
+        for (int index = 0; index < num_coefficients; ++index)
+        {
+            const auto c = (double) (index + 1);
+
+            double num = 0.0;
+            for (int i = 0, sign = 1;; ++i, sign = -sign)
+            {
+                const auto term = std::pow (q, (double) (i * (i + 1))) * std::sin ((double) (i * 2 + 1) * c * M_PI / (double) order) * (double) sign;
+                num += term;
+                if (std::abs (term) <= 1.0e-100)
+                    break;
+            }
+            num *= std::pow (q, 0.25);
+
+            double den = 0.5;
+            for (int i = 1, sign = -1;; ++i, sign = -sign)
+            {
+                const auto term = std::pow (q, (double) (i * i)) * std::cos ((double) (i * 2) * c * M_PI / (double) order) * (double) sign;
+                den += term;
+                if (std::abs (term) <= 1.0e-100)
+                    break;
+            }
+
+            const auto ww = num / den;
+            const auto ww_sq = ww * ww;
+            const auto x = std::sqrt ((1.0 - ww_sq * k) * (1.0 - ww_sq / k)) / (1.0 + ww_sq);
+            coefficients[(size_t) index] = (1.0 - x) / (1.0 + x);
+        }
+        return coefficients;
+    }
+
+    /** A 2x polyphase FIR half-band up/down-sampler */
+    template <typename T>
+    struct fir_half_band
+    {
+        void prepare (size_t stage, size_t max_base_rate_block_size)
+        {
+            M = (size_t) fir_half_lengths[stage];
+            const auto taps = design_half_band_fir ((int) M);
+            coefficients.assign (taps.begin(), taps.end());
+
+            const auto history_size = 2 * M - 1 + max_base_rate_block_size;
+            up_history.assign (history_size, (T) 0);
+            down_even_history.assign (history_size, (T) 0);
+            down_odd_history.assign (history_size, (T) 0);
+            scratch.assign (max_base_rate_block_size, (T) 0);
+        }
+
+        void reset()
+        {
+            std::fill (up_history.begin(), up_history.end(), (T) 0);
+            std::fill (down_even_history.begin(), down_even_history.end(), (T) 0);
+            std::fill (down_odd_history.begin(), down_odd_history.end(), (T) 0);
+        }
+
+        /** The latency of upsampling and then downsampling, at the higher sample rate */
+        [[nodiscard]] double latency() const noexcept { return (double) (2 * (2 * M - 1)); }
+
+        /**
+         * Applies the even-indexed taps to history[D + n - i], for n in [0, N),
+         * using the symmetry of the taps to halve the number of multiplies.
+         */
+        void convolve (const T* history, size_t N)
+        {
+            using namespace bulk_detail;
+            const auto D = 2 * M - 1;
+            for_each_chunk<T> (N,
+                               [&] (size_t n, auto tag)
+                               {
+                                   using V = typename decltype (tag)::type;
+                                   const auto* h = history + n;
+                                   auto y = (load<V> (h + D) + load<V> (h)) * coefficients[0];
+                                   for (size_t i = 1; i < M; ++i)
+                                       y += (load<V> (h + D - i) + load<V> (h + i)) * coefficients[i];
+                                   store (scratch.data() + n, y);
+                               });
+        }
+
+        /** Upsamples N samples from x to 2N samples in y */
+        void upsample (const T* x, T* y, size_t N)
+        {
+            const auto D = 2 * M - 1;
+            std::copy (x, x + N, up_history.begin() + (std::ptrdiff_t) D);
+
+            // even outputs are filtered, and odd outputs only see the center tap (i.e. a delay)
+            convolve (up_history.data(), N);
+            for (size_t n = 0; n < N; ++n)
+            {
+                y[2 * n] = scratch[n];
+                y[2 * n + 1] = up_history[M + n];
+            }
+
+            std::copy (up_history.begin() + (std::ptrdiff_t) N, up_history.begin() + (std::ptrdiff_t) (N + D), up_history.begin());
+        }
+
+        /** Downsamples 2N samples from x to N samples in y */
+        void downsample (const T* x, T* y, size_t N)
+        {
+            const auto D = 2 * M - 1;
+            for (size_t n = 0; n < N; ++n)
+            {
+                down_even_history[D + n] = x[2 * n];
+                down_odd_history[D + n] = x[2 * n + 1];
+            }
+
+            convolve (down_even_history.data(), N);
+            for (size_t n = 0; n < N; ++n)
+                y[n] = (T) 0.5 * (scratch[n] + down_odd_history[M - 1 + n]);
+
+            std::copy (down_even_history.begin() + (std::ptrdiff_t) N, down_even_history.begin() + (std::ptrdiff_t) (N + D), down_even_history.begin());
+            std::copy (down_odd_history.begin() + (std::ptrdiff_t) N, down_odd_history.begin() + (std::ptrdiff_t) (N + D), down_odd_history.begin());
+        }
+
+        size_t M = 0;
+        std::vector<T> coefficients;
+        std::vector<T> up_history;
+        std::vector<T> down_even_history;
+        std::vector<T> down_odd_history;
+        std::vector<T> scratch;
+    };
+
+    /** A chain of first-order allpass filters, (a + z^-1) / (1 + a z^-1) */
+    template <typename T>
+    struct allpass_chain
+    {
+        T process (T x)
+        {
+            for (size_t k = 0; k < coefficients.size(); ++k)
+            {
+                const auto y = coefficients[k] * (x - y1[k]) + x1[k];
+                x1[k] = x;
+                y1[k] = y;
+                x = y;
+            }
+            return x;
+        }
+
+        void reset()
+        {
+            std::fill (x1.begin(), x1.end(), (T) 0);
+            std::fill (y1.begin(), y1.end(), (T) 0);
+        }
+
+        std::vector<T> coefficients;
+        std::vector<T> x1;
+        std::vector<T> y1;
+    };
+
+    /**
+     * A 2x polyphase IIR half-band up/down-sampler, where the half-band filter is
+     * H(z) = (A0(z^2) + z^-1 A1(z^2)) / 2, so each allpass chain runs at the lower sample rate.
+     */
+    template <typename T>
+    struct iir_half_band
+    {
+        void prepare (size_t stage, size_t)
+        {
+            const auto coefficients = design_half_band_iir (iir_num_coefficients[stage], iir_transition_bandwidths[stage]);
+            for (auto* chains : { up, down })
+            {
+                for (size_t path = 0; path < 2; ++path)
+                {
+                    auto& chain = chains[path];
+                    chain.coefficients.clear();
+                    for (size_t k = path; k < coefficients.size(); k += 2)
+                        chain.coefficients.push_back ((T) coefficients[k]);
+                    chain.x1.assign (chain.coefficients.size(), (T) 0);
+                    chain.y1.assign (chain.coefficients.size(), (T) 0);
+                }
+            }
+
+            // each allpass section has a group delay of (1 - a) / (1 + a) at DC (at the lower rate)
+            double delay[2] {};
+            for (size_t k = 0; k < coefficients.size(); ++k)
+                delay[k % 2] += 2.0 * (1.0 - coefficients[k]) / (1.0 + coefficients[k]);
+            const auto filter_delay = 0.5 * (delay[0] + delay[1] + 1.0);
+
+            // the downsampler keeps the odd outputs of the filter, which saves one sample of delay
+            dc_latency = 2.0 * filter_delay - 1.0;
+        }
+
+        void reset()
+        {
+            for (auto* chains : { up, down })
+            {
+                chains[0].reset();
+                chains[1].reset();
+            }
+        }
+
+        /** The latency (group delay at DC) of upsampling and then downsampling, at the higher sample rate */
+        [[nodiscard]] double latency() const noexcept { return dc_latency; }
+
+        void upsample (const T* x, T* y, size_t N)
+        {
+            for (size_t n = 0; n < N; ++n)
+            {
+                y[2 * n] = up[0].process (x[n]);
+                y[2 * n + 1] = up[1].process (x[n]);
+            }
+        }
+
+        void downsample (const T* x, T* y, size_t N)
+        {
+            for (size_t n = 0; n < N; ++n)
+                y[n] = (T) 0.5 * (down[0].process (x[2 * n + 1]) + down[1].process (x[2 * n]));
+        }
+
+        allpass_chain<T> up[2];
+        allpass_chain<T> down[2];
+        double dc_latency = 0.0;
+    };
+} // namespace oversampling_detail
+
+/**
+ * Applies a static nonlinearity (e.g. a math_approx tanh(), or a soft clipper) at
+ * 2x, 4x, or 8x oversampling, using cascaded polyphase half-band filters for the
+ * upsampling and downsampling, to reduce aliasing.
+ *
+ * The nonlinearity is evaluated on the whole upsampled block at once, using SIMD
+ * batches when XSIMD is available, so it must be callable with T, and with
+ * XSIMD batches of T, e.g. `[] (auto x) { return math_approx::tanh<5> (x); }`.
+ *
+ * Each instance processes one channel.
+ */
+template <typename T = float>
+class oversampled_nonlinearity
+{
+public:
+    /**
+     * Prepares the processor for a given oversampling factor (which is rounded up
+     * to 1, 2, 4, or 8), and a maximum block size (at the base sample rate).
+     * This is the only method that allocates memory.
+     */
+    void prepare (int oversampling_factor, size_t max_block_size, oversampling_phase phase_type = oversampling_phase::linear)
+    {
+        phase = phase_type;
+        max_block = std::max (max_block_size, (size_t) 1);
+
+        num_stages = 0;
+        while (num_stages < oversampling_detail::max_stages && (1 << num_stages) < oversampling_factor)
+            ++num_stages;
+
+        for (size_t s = 0; s < num_stages; ++s)
+        {
+            fir_stages[s].prepare (s, max_block << s);
+            iir_stages[s].prepare (s, max_block << s);
+            buffers[s].assign (max_block << (s + 1), (T) 0);
+        }
+
+        reset();
+    }
+
+    /** Clears the filter states */
+    void reset()
+    {
+        for (size_t s = 0; s < num_stages; ++s)
+        {
+            fir_stages[s].reset();
+            iir_stages[s].reset();
+        }
+    }
+
+    /** Returns the oversampling factor */
+    [[nodiscard]] int oversampling_factor() const noexcept { return 1 << num_stages; }
+
+    /**
+     * Returns the latency of the up/down-sampling filters, in samples at the base
+     * sample rate. For the low-latency (IIR) filters, this is the group delay at DC.
+     */
+    [[nodiscard]] T latency() const noexcept
+    {
+        double total = 0.0;
+        for (size_t s = 0; s < num_stages; ++s)
+        {
+            const auto stage_latency = phase == oversampling_phase::linear ? fir_stages[s].latency() : iir_stages[s].latency();
+            total += stage_latency / (double) (2 << s);
+        }
+        return (T) total;
+    }
+
+    /**
+     * Processes N samples from x into y (which may be the same buffer), applying func at the oversampled rate.
+     * If the processor hasn't been prepared, func is applied at the base sample rate, without chunking.
+     */
+    template <typename Func>
+    void process (const T* x, T* y, size_t N, Func&& func)
+    {
+        const auto chunk_size = max_block == 0 ? N : max_block;
+        for (size_t n = 0; n < N; n += chunk_size)
+        {
+            const auto block_size = std::min (chunk_size, N - n);
+            if (phase == oversampling_phase::linear)
+                process_block (fir_stages, x + n, y + n, block_size, func);
+            else
+                process_block (iir_stages, x + n, y + n, block_size, func);
+        }
+    }
+
+private:
+    template <typename Stages, typename Func>
+    void process_block (Stages& stages, const T* x, T* y, size_t N, Func& func)
+    {
+        if (num_stages == 0)
+        {
+            process_bulk (x, y, N, func);
+            return;
+        }
+
+        const T* stage_input = x;
+        for (size_t s = 0; s < num_stages; ++s)
+        {
+            stages[s].upsample (stage_input, buffers[s].data(), N << s);
+            stage_input = buffers[s].data();
+        }
+
+        auto* upsampled = buffers[num_stages - 1].data();
+        process_bulk (upsampled, upsampled, N << num_stages, func);
+
+        for (size_t s = num_stages; s-- > 0;)
+            stages[s].downsample (buffers[s].data(), s == 0 ? y : buffers[s - 1].data(), N << s);
+    }
+
+    oversampling_phase phase = oversampling_phase::linear;
+    size_t max_block = 0;
+    size_t num_stages = 0;
+    oversampling_detail::fir_half_band<T> fir_stages[oversampling_detail::max_stages];
+    oversampling_detail::iir_half_band<T> iir_stages[oversampling_detail::max_stages];
+    std::vector<T> buffers[oversampling_detail::max_stages];
+};
+} // namespace math_approx
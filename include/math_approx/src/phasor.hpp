@@ -0,0 +1,287 @@
+#pragma once
+
+#include "basic_math.hpp"
+#include "trig_approx.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+namespace math_approx
+{
+namespace phasor_detail
+{
+    template <typename V>
+    constexpr size_t num_lanes()
+    {
+        if constexpr (std::is_arithmetic_v<V>)
+            return 1;
+#if defined(XSIMD_HPP)
+        else
+            return V::size;
+#endif
+    }
+
+    /**
+     * The phase (in turns) of a quadratic phase grid, phi(n) = a + b n + c n^2,
+     * wrapped to [-1/2, 1/2]. This is computed in double-precision, since it's
+     * only needed when the rotation is (re-)seeded, and the phase of a long grid
+     * may have many more whole turns than a float can represent accurately.
+     */
+    struct quadratic_phase
+    {
+        double a;
+        double b;
+        double c;
+
+        double operator() (double n) const
+        {
+            const auto phi = a + n * (b + c * n);
+            return phi - std::nearbyint (phi);
+        }
+    };
+
+    /** Returns phase (n0 + i) for each lane i, as type V */
+    template <typename V, typename PhaseFunc>
+    V phase_lanes (PhaseFunc&& phase, size_t n0)
+    {
+        if constexpr (std::is_arithmetic_v<V>)
+        {
+            return (V) phase ((double) n0);
+        }
+#if defined(XSIMD_HPP)
+        else
+        {
+            using S = scalar_of_t<V>;
+            alignas (V::arch_type::alignment()) S lanes[V::size];
+            for (size_t i = 0; i < V::size; ++i)
+                lanes[i] = (S) phase ((double) (n0 + i));
+            return V::load_aligned (lanes);
+        }
+#endif
+    }
+
+    /**
+     * Renormalizes a complex number that is already close to unit magnitude,
+     * using one Newton-Raphson step for 1 / |z|.
+     *
+     * The error in the rotation's magnitude compounds with every step (and for
+     * chirps, the rotation is itself rotated), so the rotations are normalized
+     * after they are seeded. Near zero phase, the cos approximations' error is
+     * almost entirely magnitude error, so this removes most of the drift.
+     */
+    template <typename V>
+    void normalize (V& re, V& im)
+    {
+        using S = scalar_of_t<V>;
+        const auto scale = (S) 1.5 - (S) 0.5 * (re * re + im * im);
+        re *= scale;
+        im *= scale;
+    }
+
+    /**
+     * Generates num_steps * L values of exp(2 pi i phi(n)) for n starting at n0,
+     * where L is the number of lanes in V, and lane j holds the offset n0 + j.
+     *
+     * The grid is seeded with the polynomial sin/cos approximations, and then each step
+     * rotates all the lanes forward by L samples with one complex multiply. For a chirp
+     * (c != 0) the rotation itself changes each step, by a constant rotation that is
+     * the same for every lane.
+     */
+    template <int order, bool is_chirp, typename V, typename Store>
+    void rotate_segment (const quadratic_phase& phase, size_t n0, size_t num_steps, Store&& store)
+    {
+        using S = scalar_of_t<V>;
+        constexpr auto L = num_lanes<V>();
+
+        const auto z_phase = phase_lanes<V> (phase, n0);
+        auto z_re = cos_turns_mhalfpi_halfpi<order> (z_phase);
+        auto z_im = sin_turns_mhalfpi_halfpi<order> (z_phase);
+
+        // phi(n + L) - phi(n) = b L + c L^2 + 2 c L n
+        const auto w_phase = phase_lanes<V> (quadratic_phase { phase.b * (double) L + phase.c * (double) (L * L), 2.0 * phase.c * (double) L, 0.0 },
+                                             n0);
+        auto w_re = cos_turns_mhalfpi_halfpi<order> (w_phase);
+        auto w_im = sin_turns_mhalfpi_halfpi<order> (w_phase);
+        normalize (w_re, w_im);
+
+        [[maybe_unused]] S d_re {}, d_im {};
+        if constexpr (is_chirp)
+        {
+            const auto d_phase = (S) quadratic_phase { 0.0, 2.0 * phase.c * (double) (L * L), 0.0 }(1.0);
+            d_re = cos_turns_mhalfpi_halfpi<order> (d_phase);
+            d_im = sin_turns_mhalfpi_halfpi<order> (d_phase);
+            normalize (d_re, d_im);
+        }
+
+        for (size_t s = 0; s < num_steps; ++s)
+        {
+            store (n0 + s * L, z_re, z_im);
+
+            const auto next_re = z_re * w_re - z_im * w_im;
+            z_im = z_re * w_im + z_im * w_re;
+            z_re = next_re;
+
+            if constexpr (is_chirp)
+            {
+                const auto next_w_re = w_re * d_re - w_im * d_im;
+                w_im = w_re * d_im + w_im * d_re;
+                w_re = next_w_re;
+            }
+        }
+    }
+
+    /**
+     * Generates N values of exp(2 pi i phi(n)), re-seeding the rotation
+     * every reseed_interval rotation steps, so the error can't accumulate.
+     */
+    template <int order, bool is_chirp, typename T, typename Store>
+    void generate (const quadratic_phase& phase, size_t N, size_t reseed_interval, Store&& store)
+    {
+        reseed_interval = std::max (reseed_interval, (size_t) 1);
+
+        size_t n = 0;
+#if defined(XSIMD_HPP)
+        using B = xsimd::batch<T>;
+        while (n + B::size <= N)
+        {
+            const auto num_steps = std::min (reseed_interval, (N - n) / B::size);
+            rotate_segment<order, is_chirp, B> (phase, n, num_steps, store);
+            n += num_steps * B::size;
+        }
+#endif
+        while (n < N)
+        {
+            const auto num_steps = std::min (reseed_interval, N - n);
+            rotate_segment<order, is_chirp, T> (phase, n, num_steps, store);
+            n += num_steps;
+        }
+    }
+
+    template <typename T>
+    auto split_store (T* re, T* im)
+    {
+        return [re, im] (size_t n, auto z_re, auto z_im)
+        {
+            if constexpr (std::is_same_v<decltype (z_re), T>)
+            {
+                re[n] = z_re;
+                im[n] = z_im;
+            }
+#if defined(XSIMD_HPP)
+            else
+            {
+                z_re.store_unaligned (re + n);
+                z_im.store_unaligned (im + n);
+            }
+#endif
+        };
+    }
+
+    template <typename T>
+    auto interleaved_store (T* re_im)
+    {
+        return [re_im] (size_t n, auto z_re, auto z_im)
+        {
+            if constexpr (std::is_same_v<decltype (z_re), T>)
+            {
+                re_im[2 * n] = z_re;
+                re_im[2 * n + 1] = z_im;
+            }
+#if defined(XSIMD_HPP)
+            else
+            {
+                using B = decltype (z_re);
+                xsimd::zip_lo (z_re, z_im).store_unaligned (re_im + 2 * n);
+                xsimd::zip_hi (z_re, z_im).store_unaligned (re_im + 2 * n + B::size);
+            }
+#endif
+        };
+    }
+
+    inline quadratic_phase chirp_phase (double start_turns, double start_step_turns, double step_increment_turns)
+    {
+        // phi(n) = start + n * start_step + n (n - 1) / 2 * step_increment
+        return { start_turns, start_step_turns - 0.5 * step_increment_turns, 0.5 * step_increment_turns };
+    }
+} // namespace phasor_detail
+
+/**
+ * Computes cos(2 pi phi(n)) and sin(2 pi phi(n)) on a linear phase grid,
+ * phi(n) = start_turns + n * step_turns, for n in [0, N).
+ *
+ * Rather than evaluating the polynomial approximations at every point, the
+ * grid is seeded with cos/sin_turns_mhalfpi_halfpi<order>, and then computed
+ * with a complex rotation (one complex multiply per SIMD batch of consecutive
+ * points). The rotation is re-seeded every reseed_interval rotation steps (i.e.
+ * every reseed_interval SIMD batches), which bounds both the magnitude and
+ * the phase error to roughly reseed_interval roundings.
+ */
+template <int order = 9, typename T>
+void phasor_grid (T* re, T* im, size_t N, T start_turns, T step_turns, size_t reseed_interval = 16)
+{
+    phasor_detail::generate<order, false, T> ({ (double) start_turns, (double) step_turns, 0.0 },
+                                              N,
+                                              reseed_interval,
+                                              phasor_detail::split_store (re, im));
+}
+
+/** Same as phasor_grid(), but writing interleaved (re, im) pairs */
+template <int order = 9, typename T>
+void phasor_grid_interleaved (T* re_im, size_t N, T start_turns, T step_turns, size_t reseed_interval = 16)
+{
+    phasor_detail::generate<order, false, T> ({ (double) start_turns, (double) step_turns, 0.0 },
+                                              N,
+                                              reseed_interval,
+                                              phasor_detail::interleaved_store (re_im));
+}
+
+/**
+ * Computes cos(2 pi phi(n)) and sin(2 pi phi(n)) for a linear chirp, where the
+ * phase step starts at start_step_turns, and increases by step_increment_turns
+ * for each point: phi(n) = start_turns + n * start_step_turns + n (n - 1) / 2 * step_increment_turns.
+ *
+ * The chirp uses the same rotation as phasor_grid(), but with the rotation
+ * itself rotated forward for each SIMD batch (i.e. two complex multiplies).
+ * Since the rotation's rounding errors then accumulate twice, the error grows
+ * with reseed_interval^2, so chirps may need a smaller re-seed interval.
+ */
+template <int order = 9, typename T>
+void chirp_grid (T* re, T* im, size_t N, T start_turns, T start_step_turns, T step_increment_turns, size_t reseed_interval = 4)
+{
+    phasor_detail::generate<order, true, T> (phasor_detail::chirp_phase ((double) start_turns, (double) start_step_turns, (double) step_increment_turns),
+                                             N,
+                                             reseed_interval,
+                                             phasor_detail::split_store (re, im));
+}
+
+/** Same as chirp_grid(), but writing interleaved (re, im) pairs */
+template <int order = 9, typename T>
+void chirp_grid_interleaved (T* re_im, size_t N, T start_turns, T start_step_turns, T step_increment_turns, size_t reseed_interval = 4)
+{
+    phasor_detail::generate<order, true, T> (phasor_detail::chirp_phase ((double) start_turns, (double) start_step_turns, (double) step_increment_turns),
+                                             N,
+                                             reseed_interval,
+                                             phasor_detail::interleaved_store (re_im));
+}
+
+/** Computes the fft_size / 2 forward FFT twiddle factors, exp(-2 pi i k / fft_size) */
+template <int order = 9, typename T>
+void fft_twiddles (T* re, T* im, size_t fft_size, size_t reseed_interval = 16)
+{
+    phasor_detail::generate<order, false, T> ({ 0.0, -1.0 / (double) fft_size, 0.0 },
+                                              fft_size / 2,
+                                              reseed_interval,
+                                              phasor_detail::split_store (re, im));
+}
+
+/** Same as fft_twiddles(), but writing interleaved (re, im) pairs */
+template <int order = 9, typename T>
+void fft_twiddles_interleaved (T* re_im, size_t fft_size, size_t reseed_interval = 16)
+{
+    phasor_detail::generate<order, false, T> ({ 0.0, -1.0 / (double) fft_size, 0.0 },
+                                              fft_size / 2,
+                                              reseed_interval,
+                                              phasor_detail::interleaved_store (re_im));
+}
+} // namespace math_approx
@@ -2,6 +2,8 @@
 
 #include "basic_math.hpp"
 
+#include <type_traits>
+
 namespace math_approx
 {
 namespace pow_detail
@@ -66,7 +68,7 @@ namespace pow_detail
         }
         else
         {
-            static_assert (order >= 1 && order <= 7);
+            static_assert (order >= 1 && order <= 10);
             if constexpr (order == 1)
             {
                 return (S) 1 + x;
@@ -106,9 +108,9 @@ namespace pow_detail
                 const auto x_1_2_3_4_5_6 = x_1_2 + x_3_4_5_6 * x_sq;
                 return (S) 1 + x_1_2_3_4_5_6 * x;
             }
-            else if constexpr (order == 7)
+            else if constexpr (order == 7 && std::is_same_v<S, float>)
             {
-                // doesn't seem to help at single-precision
+                // the original single-precision fit (no more accurate than order 6 at single-precision)
                 const auto x_6_7 = (S) 0.000136898688977877 + (S) 0.0000234440812713967 * x;
                 const auto x_4_5 = (S) 0.00960825566419915 + (S) 0.00135107295099880 * x;
                 const auto x_2_3 = (S) 0.240226092549669 + (S) 0.0555070350342468 * x;
@@ -117,6 +119,55 @@ namespace pow_detail
                 const auto x_0_1_2_3 = x_0_1 + x_2_3 * x_sq;
                 return x_0_1_2_3 + x_4_5_6_7 * x_sq * x_sq;
             }
+            else if constexpr (order == 7)
+            {
+                // minimax relative error fit for double-precision (as are orders 8 and above)
+                const auto x_6_7 = (S) 0.00014377207692441445397 + (S) 2.1430615065001940897e-5 * x;
+                const auto x_4_5 = (S) 0.0096142831765647971746 + (S) 0.0013419015655507533426 * x;
+                const auto x_2_3 = (S) 0.24022640511644582853 + (S) 0.055505023018849290201 * x;
+                const auto x_0_1 = (S) 1 + (S) 0.69314718434421528347 * x;
+                const auto x_4_5_6_7 = x_4_5 + x_6_7 * x_sq;
+                const auto x_0_1_2_3 = x_0_1 + x_2_3 * x_sq;
+                return x_0_1_2_3 + x_4_5_6_7 * x_sq * x_sq;
+            }
+            else if constexpr (order == 8)
+            {
+                const auto x_7_8 = (S) 1.4217324267712208017e-5 + (S) 1.8586587004093218529e-6 * x;
+                const auto x_5_6 = (S) 0.0013327602250721192894 + (S) 0.00015507427159533671832 * x;
+                const auto x_3_4 = (S) 0.055504072975322519201 + (S) 0.0096183260165875030342 * x;
+                const auto x_1_2 = (S) 0.69314718046901101246 + (S) 0.24022651005779208521 * x;
+                const auto x_q = x_sq * x_sq;
+                const auto x_5_6_7_8 = x_5_6 + x_7_8 * x_sq;
+                const auto x_1_2_3_4 = x_1_2 + x_3_4 * x_sq;
+                return (S) 1 + (x_1_2_3_4 + x_5_6_7_8 * x_q) * x;
+            }
+            else if constexpr (order == 9)
+            {
+                const auto x_8_9 = (S) 1.2305669252626071158e-6 + (S) 1.4325368263589357515e-7 * x;
+                const auto x_6_7 = (S) 0.00015396078209884769451 + (S) 1.5359580569806501893e-5 * x;
+                const auto x_4_5 = (S) 0.0096181210118073192153 + (S) 0.0013333875397550064464 * x;
+                const auto x_2_3 = (S) 0.24022650687822636606 + (S) 0.055504109825037798393 * x;
+                const auto x_0_1 = (S) 1 + (S) 0.69314718056186850874 * x;
+                const auto x_q = x_sq * x_sq;
+                const auto x_4_5_6_7 = x_4_5 + x_6_7 * x_sq;
+                const auto x_4_5_6_7_8_9 = x_4_5_6_7 + x_8_9 * x_q;
+                const auto x_0_1_2_3 = x_0_1 + x_2_3 * x_sq;
+                return x_0_1_2_3 + x_4_5_6_7_8_9 * x_q;
+            }
+            else if constexpr (order == 10)
+            {
+                // reaches the limits of double-precision
+                const auto x_9_10 = (S) 9.4696515950240513124e-8 + (S) 9.9353262999541068256e-9 * x;
+                const auto x_7_8 = (S) 1.5244895767158783513e-5 + (S) 1.3310800887933880932e-6 * x;
+                const auto x_5_6 = (S) 0.0013333544569885571575 + (S) 0.00015403939740710618418 * x;
+                const auto x_3_4 = (S) 0.05550410863258579818 + (S) 0.0096181293844642120507 * x;
+                const auto x_1_2 = (S) 0.69314718055990899958 + (S) 0.24022650696094667848 * x;
+                const auto x_q = x_sq * x_sq;
+                const auto x_5_6_7_8 = x_5_6 + x_7_8 * x_sq;
+                const auto x_5_6_7_8_9_10 = x_5_6_7_8 + x_9_10 * x_q;
+                const auto x_1_2_3_4 = x_1_2 + x_3_4 * x_sq;
+                return (S) 1 + (x_1_2_3_4 + x_5_6_7_8_9_10 * x_q) * x;
+            }
             else
             {
                 return {};
@@ -141,6 +192,26 @@ namespace pow_detail
     {
         static constexpr auto log2_base = (T) 3.3219280948873623479;
     };
+
+    /**
+     * A Base may also define an offset, so that pow<Base> computes 2^(x * log2_base + offset),
+     * and log<Base> computes the inverse, (log2(x) - offset) / log2_base. This lets affine
+     * conversions (e.g. decibels, or MIDI note numbers) fold their constants into the
+     * scaling that's already being done, rather than needing an extra pass.
+     */
+    template <typename Base, typename = void>
+    struct has_offset : std::false_type
+    {
+    };
+
+    template <typename Base>
+    struct has_offset<Base, std::void_t<decltype (Base::offset)>> : std::true_type
+    {
+    };
+
+    /** pow(Base, x), with the saturate or ieee special_value_policy (see below) */
+    template <typename Base, int order, bool C1_continuous, special_value_policy policy, typename T>
+    T pow_with_special_values (T x);
 }
 
 #if defined(__GNUC__)
@@ -150,10 +221,15 @@ namespace pow_detail
 #endif
 
 /** approximation for pow(Base, x) (32-bit) */
-template <typename Base, int order, bool C1_continuous, bool clamp_range>
+template <typename Base, int order, bool C1_continuous, bool clamp_range, special_value_policy policy = special_value_policy::unchecked>
 constexpr float pow (float x)
 {
+    if constexpr (policy != special_value_policy::unchecked)
+        return pow_detail::pow_with_special_values<Base, order, C1_continuous, policy> (x);
+
     x *= Base::log2_base;
+    if constexpr (pow_detail::has_offset<Base>::value)
+        x += Base::offset;
 
     if constexpr (clamp_range)
         x = std::max (-126.0f, x);
@@ -167,10 +243,15 @@ constexpr float pow (float x)
 }
 
 /** approximation for pow(Base, x) (64-bit) */
-template <typename Base, int order, bool C1_continuous, bool clamp_range>
+template <typename Base, int order, bool C1_continuous, bool clamp_range, special_value_policy policy = special_value_policy::unchecked>
 constexpr double pow (double x)
 {
+    if constexpr (policy != special_value_policy::unchecked)
+        return pow_detail::pow_with_special_values<Base, order, C1_continuous, policy> (x);
+
     x *= Base::log2_base;
+    if constexpr (pow_detail::has_offset<Base>::value)
+        x += Base::offset;
 
     if constexpr (clamp_range)
         x = std::max (-1022.0, x);
@@ -185,10 +266,15 @@ constexpr double pow (double x)
 
 #if defined(XSIMD_HPP)
 /** approximation for pow(Base, x) (32-bit SIMD) */
-template <typename Base, int order, bool C1_continuous, bool clamp_range>
+template <typename Base, int order, bool C1_continuous, bool clamp_range, special_value_policy policy = special_value_policy::unchecked>
 xsimd::batch<float> pow (xsimd::batch<float> x)
 {
+    if constexpr (policy != special_value_policy::unchecked)
+        return pow_detail::pow_with_special_values<Base, order, C1_continuous, policy> (x);
+
     x *= Base::log2_base;
+    if constexpr (pow_detail::has_offset<Base>::value)
+        x += Base::offset;
 
     if constexpr (clamp_range)
         x = xsimd::max (xsimd::broadcast (-126.0f), x);
@@ -202,10 +288,15 @@ xsimd::batch<float> pow (xsimd::batch<float> x)
 }
 
 /** approximation for pow(Base, x) (64-bit SIMD) */
-template <typename Base, int order, bool C1_continuous, bool clamp_range>
+template <typename Base, int order, bool C1_continuous, bool clamp_range, special_value_policy policy = special_value_policy::unchecked>
 xsimd::batch<double> pow (xsimd::batch<double> x)
 {
+    if constexpr (policy != special_value_policy::unchecked)
+        return pow_detail::pow_with_special_values<Base, order, C1_continuous, policy> (x);
+
     x *= Base::log2_base;
+    if constexpr (pow_detail::has_offset<Base>::value)
+        x += Base::offset;
 
     if constexpr (clamp_range)
         x = xsimd::max (xsimd::broadcast (-1022.0), x);
@@ -223,31 +314,83 @@ xsimd::batch<double> pow (xsimd::batch<double> x)
 #pragma GCC diagnostic pop // end ignore strict-aliasing warnings
 #endif
 
+namespace pow_detail
+{
+    /**
+     * With the saturate policy, the base-2 exponent is clamped so that the result is
+     * finite (and normal, or zero). With the ieee policy, results that overflow are +Inf,
+     * NaN inputs give NaN, and for subnormal results, 2^(x + 64) * 2^-64 is computed
+     * instead, so that the result is only rounded once. With the flush_denormals policy,
+     * results below FLT_MIN/DBL_MIN are zero, and are never built as denormals.
+     * Since the exponent is clamped either way, clamp_range is only used with the
+     * unchecked policy.
+     */
+    template <typename Base, int order, bool C1_continuous, special_value_policy policy, typename T>
+    T pow_with_special_values (T x)
+    {
+        using S = scalar_of_t<T>;
+        constexpr auto is_float = std::is_same_v<S, float>;
+        constexpr auto min_exponent = is_float ? (S) -126 : (S) -1022;
+        constexpr auto max_exponent = is_float ? (S) 128 : (S) 1024;
+        constexpr auto mantissa_bits = is_float ? (S) 23 : (S) 52;
+
+        auto x2 = x * Base::log2_base;
+        if constexpr (has_offset<Base>::value)
+            x2 += Base::offset;
+
+        if constexpr (policy == special_value_policy::saturate)
+        {
+            return pow<Base2<S>, order, C1_continuous, false> (clamp_nan_to_low (x2, min_exponent + (S) 0.01, max_exponent - (S) 0.01));
+        }
+        else if constexpr (policy == special_value_policy::flush_denormals)
+        {
+            // 2^min_exponent * p(f) is normal for f in (0, 1), but 2^min_exponent itself comes out
+            // as 0 * p(1), since the kernel floors negative integers to the next integer down,
+            // so the result is raised to the smallest normal number.
+            using std::max;
+#if defined(XSIMD_HPP)
+            using xsimd::max;
+#endif
+            constexpr auto min_normal = std::numeric_limits<S>::min();
+            const auto y = pow<Base2<S>, order, C1_continuous, false> (clamp_nan_to_low (x2, min_exponent, max_exponent));
+            return select (x2 != x2, x2, select (x2 >= min_exponent, max (y, T { min_normal }), T { (S) 0 }));
+        }
+        else
+        {
+            const auto x2_clamped = clamp_nan_to_low (x2, min_exponent - mantissa_bits - (S) 2, max_exponent);
+            const auto is_subnormal = x2_clamped < min_exponent + (S) 1;
+            const auto y = pow<Base2<S>, order, C1_continuous, false> (select (is_subnormal, x2_clamped + (S) 64, x2_clamped))
+                           * select (is_subnormal, T { (S) 5.42101086242752217e-20 }, T { (S) 1 }); // 2^-64
+            return select (x2 != x2, x2, y);
+        }
+    }
+} // namespace pow_detail
+
 /** Approximation of exp(x), using exp(x) = 2^floor(x * log2(e)) * 2^frac(x * log2(e)) */
-template <int order, bool C1_continuous = false, bool clamp_range = true, typename T>
+template <int order, bool C1_continuous = false, bool clamp_range = true, typename T, special_value_policy policy = special_value_policy::unchecked>
 constexpr T exp (T x)
 {
-    return pow<pow_detail::BaseE<scalar_of_t<T>>, order, C1_continuous, clamp_range> (x);
+    return pow<pow_detail::BaseE<scalar_of_t<T>>, order, C1_continuous, clamp_range, policy> (x);
 }
 
 /** Approximation of exp2(x), using exp(x) = 2^floor(x) * 2^frac(x) */
-template <int order, bool C1_continuous = false, bool clamp_range = true, typename T>
+template <int order, bool C1_continuous = false, bool clamp_range = true, typename T, special_value_policy policy = special_value_policy::unchecked>
 constexpr T exp2 (T x)
 {
-    return pow<pow_detail::Base2<scalar_of_t<T>>, order, C1_continuous, clamp_range> (x);
+    return pow<pow_detail::Base2<scalar_of_t<T>>, order, C1_continuous, clamp_range, policy> (x);
 }
 
 /** Approximation of exp(x), using exp10(x) = 2^floor(x * log2(10)) * 2^frac(x * log2(10)) */
-template <int order, bool C1_continuous = false, bool clamp_range = true, typename T>
+template <int order, bool C1_continuous = false, bool clamp_range = true, typename T, special_value_policy policy = special_value_policy::unchecked>
 constexpr T exp10 (T x)
 {
-    return pow<pow_detail::Base10<scalar_of_t<T>>, order, C1_continuous, clamp_range> (x);
+    return pow<pow_detail::Base10<scalar_of_t<T>>, order, C1_continuous, clamp_range, policy> (x);
 }
 
 /** Approximation of exp(1) - 1, using math_approx::exp(x) */
-template <int order, bool C1_continuous = false, bool clamp_range = true, typename T>
+template <int order, bool C1_continuous = false, bool clamp_range = true, typename T, special_value_policy policy = special_value_policy::unchecked>
 constexpr T expm1 (T x)
 {
-    return pow<pow_detail::BaseE<scalar_of_t<T>>, order, C1_continuous, clamp_range> (x) - (T) 1;
+    return pow<pow_detail::BaseE<scalar_of_t<T>>, order, C1_continuous, clamp_range, policy> (x) - (T) 1;
 }
 }
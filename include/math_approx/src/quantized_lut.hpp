@@ -0,0 +1,182 @@
+#pragma once
+
+#include "bulk_approx.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__AVX512VBMI__)
+#include <immintrin.h>
+#endif
+
+namespace math_approx
+{
+/**
+ * Affine quantization parameters, such that
+ * real_value = scale * (quantized_value - zero_point).
+ */
+struct quantization_params
+{
+    float scale = 1.0f;
+    int32_t zero_point = 0;
+};
+
+namespace quantized_lut_detail
+{
+    template <typename Q>
+    using unsigned_index_t = std::make_unsigned_t<Q>;
+
+    template <typename Q>
+    Q quantize (float x, quantization_params params)
+    {
+        constexpr auto q_min = (double) std::numeric_limits<Q>::min();
+        constexpr auto q_max = (double) std::numeric_limits<Q>::max();
+
+        // clamp before converting to an integer, since the conversion is undefined for Inf, NaN, or out-of-range values
+        const auto q = (double) x / (double) params.scale + (double) params.zero_point;
+        if (std::isnan (q))
+            return static_cast<Q> (std::clamp (params.zero_point, (int32_t) q_min, (int32_t) q_max));
+        return static_cast<Q> ((int32_t) std::nearbyint (std::clamp (q, q_min, q_max)));
+    }
+
+#if defined(__AVX2__)
+    // 256-entry byte lookups with pshufb, using one 16-byte table slice per high nibble.
+    // For slice h, (x - 16h) lands in [0, 15] only for the matching bytes; the saturating
+    // add of 0x70 keeps those indices below 0x80, and pushes every other byte to >= 0x80,
+    // which pshufb maps to zero. So the slices can be OR-ed together without any masking.
+    inline __m256i lookup_bytes_avx2 (const __m256i (&table)[16], __m256i x)
+    {
+        const auto slice_step = _mm256_set1_epi8 (0x10);
+        const auto bias = _mm256_set1_epi8 (0x70);
+
+        auto result = _mm256_setzero_si256();
+        for (int h = 0; h < 16; ++h)
+        {
+            const auto idx = _mm256_adds_epu8 (x, bias);
+            result = _mm256_or_si256 (result, _mm256_shuffle_epi8 (table[h], idx));
+            x = _mm256_sub_epi8 (x, slice_step);
+        }
+        return result;
+    }
+
+    // 65536-entry 16-bit lookups with 32-bit gathers. Each gather reads the 4 bytes
+    // starting at table[x], so index 65535 would read 2 bytes past the end of the
+    // table. That lane reads table[65534] instead, and takes the upper half-word.
+    inline __m256i lookup_halfwords_avx2 (const void* table, __m256i x)
+    {
+        const auto last_index = _mm256_set1_epi32 (0xFFFF);
+        const auto is_last = _mm256_cmpeq_epi32 (x, last_index);
+        const auto gathered = _mm256_i32gather_epi32 (static_cast<const int*> (table), _mm256_add_epi32 (x, is_last), 2);
+        const auto shifted = _mm256_srlv_epi32 (gathered, _mm256_and_si256 (is_last, _mm256_set1_epi32 (16)));
+        return _mm256_and_si256 (shifted, last_index);
+    }
+#endif
+} // namespace quantized_lut_detail
+
+/**
+ * Builds a lookup table for an activation function operating on
+ * quantized values. The table has one entry for each possible value
+ * of Q (256 entries for 8-bit types, 65536 entries for 16-bit types),
+ * and is indexed by the bit-pattern of the quantized input, i.e.
+ * `table[(std::make_unsigned_t<Q>) x]`.
+ *
+ * The activation function is evaluated with process_bulk(), so it
+ * must be callable with float and SIMD batches, e.g.
+ * `[] (auto x) { return math_approx::tanh<5> (x); }`.
+ *
+ * Outputs outside of the quantized range (including ±Inf) saturate,
+ * and NaN outputs are quantized as zero (i.e. to the zero point).
+ */
+template <typename Q, typename Func>
+void build_activation_table (Q* table, quantization_params input_params, quantization_params output_params, Func&& func)
+{
+    static_assert (std::is_integral_v<Q> && (sizeof (Q) == 1 || sizeof (Q) == 2), "Only 8-bit and 16-bit quantized types are supported!");
+    using U = quantized_lut_detail::unsigned_index_t<Q>;
+    constexpr size_t table_size = (size_t) std::numeric_limits<U>::max() + 1;
+    constexpr size_t chunk_size = 256;
+
+    float buffer[chunk_size];
+    for (size_t start = 0; start < table_size; start += chunk_size)
+    {
+        for (size_t i = 0; i < chunk_size; ++i)
+        {
+            const auto q = static_cast<Q> (static_cast<U> (start + i));
+            buffer[i] = input_params.scale * (float) ((int32_t) q - input_params.zero_point);
+        }
+
+        process_bulk (buffer, buffer, chunk_size, func);
+
+        for (size_t i = 0; i < chunk_size; ++i)
+            table[start + i] = quantized_lut_detail::quantize<Q> (buffer[i], output_params);
+    }
+}
+
+/**
+ * Applies an activation table (see build_activation_table()) to a buffer of quantized values.
+ *
+ * For 8-bit types, the table lookups are done with byte shuffles
+ * (vpermb with AVX-512 VBMI, otherwise vpshufb with AVX2). With only
+ * 128-bit shuffles available, the 16 shuffles per vector have measured
+ * slower than scalar loads from the (L1-resident) table, so scalar
+ * loads are used instead.
+ *
+ * For 16-bit types, the lookups are done with AVX2 32-bit gathers,
+ * and scalar loads are used on targets without AVX2.
+ */
+template <typename Q>
+void apply_activation_table (const Q* table, const Q* x, Q* y, size_t N)
+{
+    static_assert (std::is_integral_v<Q> && (sizeof (Q) == 1 || sizeof (Q) == 2), "Only 8-bit and 16-bit quantized types are supported!");
+    using U = quantized_lut_detail::unsigned_index_t<Q>;
+
+    size_t n = 0;
+    if constexpr (sizeof (Q) == 1)
+    {
+#if defined(__AVX512VBMI__) && defined(__AVX512BW__)
+        const auto table_lo = _mm512_loadu_si512 (table);
+        const auto table_hi = _mm512_loadu_si512 (table + 64);
+        const auto table_lo2 = _mm512_loadu_si512 (table + 128);
+        const auto table_hi2 = _mm512_loadu_si512 (table + 192);
+        for (; n + 64 <= N; n += 64)
+        {
+            const auto idx = _mm512_loadu_si512 (x + n);
+            const auto y_0_127 = _mm512_permutex2var_epi8 (table_lo, idx, table_hi);
+            const auto y_128_255 = _mm512_permutex2var_epi8 (table_lo2, idx, table_hi2);
+            const auto upper_half = _mm512_movepi8_mask (idx);
+            _mm512_storeu_si512 (y + n, _mm512_mask_blend_epi8 (upper_half, y_0_127, y_128_255));
+        }
+#elif defined(__AVX2__)
+        __m256i table_vecs[16];
+        for (int h = 0; h < 16; ++h)
+            table_vecs[h] = _mm256_broadcastsi128_si256 (_mm_loadu_si128 (reinterpret_cast<const __m128i*> (table + 16 * h)));
+
+        for (; n + 32 <= N; n += 32)
+        {
+            const auto x_vec = _mm256_loadu_si256 (reinterpret_cast<const __m256i*> (x + n));
+            _mm256_storeu_si256 (reinterpret_cast<__m256i*> (y + n), quantized_lut_detail::lookup_bytes_avx2 (table_vecs, x_vec));
+        }
+#endif
+    }
+    else
+    {
+#if defined(__AVX2__)
+        for (; n + 16 <= N; n += 16)
+        {
+            const auto x_vec = _mm256_loadu_si256 (reinterpret_cast<const __m256i*> (x + n));
+            const auto y_lo = quantized_lut_detail::lookup_halfwords_avx2 (table, _mm256_cvtepu16_epi32 (_mm256_castsi256_si128 (x_vec)));
+            const auto y_hi = quantized_lut_detail::lookup_halfwords_avx2 (table, _mm256_cvtepu16_epi32 (_mm256_extracti128_si256 (x_vec, 1)));
+
+            // packus works within 128-bit lanes, so the 64-bit quarters need to be put back in order
+            const auto y_vec = _mm256_permute4x64_epi64 (_mm256_packus_epi32 (y_lo, y_hi), 0xD8);
+            _mm256_storeu_si256 (reinterpret_cast<__m256i*> (y + n), y_vec);
+        }
+#endif
+    }
+
+    for (; n < N; ++n)
+        y[n] = table[static_cast<U> (x[n])];
+}
+} // namespace math_approx
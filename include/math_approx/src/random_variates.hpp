@@ -0,0 +1,230 @@
+#pragma once
+
+#include "basic_math.hpp"
+#include "log_approx.hpp"
+#include "trig_approx.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace math_approx
+{
+namespace random_detail
+{
+#if defined(XSIMD_HPP)
+    using uint_vector = xsimd::batch<uint32_t>;
+    using float_vector = xsimd::batch<float>;
+    static_assert (uint_vector::size == float_vector::size);
+    static constexpr size_t num_lanes = float_vector::size;
+#else
+    using uint_vector = uint32_t;
+    using float_vector = float;
+    static constexpr size_t num_lanes = 1;
+#endif
+
+    /** SplitMix64, for seeding the per-lane generator states */
+    inline uint64_t splitmix64 (uint64_t& x)
+    {
+        auto z = (x += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    inline uint_vector load_lanes (const uint32_t* lanes)
+    {
+#if defined(XSIMD_HPP)
+        return uint_vector::load_unaligned (lanes);
+#else
+        return lanes[0];
+#endif
+    }
+
+    inline void store (float* p, float_vector x)
+    {
+#if defined(XSIMD_HPP)
+        x.store_unaligned (p);
+#else
+        *p = x;
+#endif
+    }
+
+    /**
+     * Converts 32 random bits to a float in [1, 2), by writing the top 23 bits
+     * into the mantissa of 1.0f (the same way pow() constructs its exponent).
+     */
+    inline float_vector one_to_two (uint_vector r)
+    {
+        const auto bits = (r >> 9) | (uint_vector) 0x3f800000u;
+#if defined(XSIMD_HPP)
+        return xsimd::bit_cast<float_vector> (bits);
+#else
+        return bit_cast<float> (bits);
+#endif
+    }
+
+    /**
+     * Converts 32 random bits to a float in the open interval (-1/2, 1/2), as
+     * (k + 1/2) 2^-23 - 1/2, where k is the top 23 bits. Every step is exact,
+     * so the endpoints can't be reached by rounding.
+     */
+    inline float_vector minus_half_to_half (uint_vector r)
+    {
+        const auto k = r >> 9;
+#if defined(XSIMD_HPP)
+        const auto k_float = xsimd::to_float (xsimd::bit_cast<xsimd::batch<int32_t>> (k));
+#else
+        const auto k_float = (float) k;
+#endif
+        return (k_float + 0.5f) * 0x1.0p-23f - 0.5f;
+    }
+
+    /** xoshiro128+ (Blackman & Vigna), with an independent state in each SIMD lane */
+    struct xoshiro128_plus
+    {
+        uint_vector s0 {}, s1 {}, s2 {}, s3 {};
+
+        uint_vector next()
+        {
+            const auto result = s0 + s3;
+            const auto t = s1 << 9;
+
+            s2 ^= s0;
+            s3 ^= s1;
+            s1 ^= s2;
+            s0 ^= s3;
+            s2 ^= t;
+            s3 = (s3 << 11) | (s3 >> 21);
+
+            return result;
+        }
+    };
+
+    /** Fills y[0, N) with values from next(), which returns one float_vector at a time */
+    template <typename Next>
+    void fill (float* y, size_t N, Next&& next)
+    {
+        size_t n = 0;
+        for (; n + num_lanes <= N; n += num_lanes)
+            store (y + n, next());
+
+        if (n < N)
+        {
+            float lanes[num_lanes];
+            store (lanes, next());
+            std::copy (lanes, lanes + (N - n), y + n);
+        }
+    }
+} // namespace random_detail
+
+/**
+ * A SIMD random variate engine, with an independent xoshiro128+ generator in
+ * each SIMD lane (seeded with SplitMix64), which transforms uniform variates into
+ * normal, exponential, and Cauchy variates using the math_approx approximations
+ * of log(), sin/cos_turns(), and tan(), rather than libm.
+ *
+ * Since each lane has its own generator, the sequence for a given seed
+ * depends on the SIMD width (and the sequence of calls), but not on N.
+ * Variates are generated as float.
+ */
+class random_variate_engine
+{
+public:
+    explicit random_variate_engine (uint64_t seed_value = 0x853c49e6748fea9bULL)
+    {
+        seed (seed_value);
+    }
+
+    /** Re-seeds the generators in all the lanes */
+    void seed (uint64_t seed_value)
+    {
+        uint32_t lanes[4][random_detail::num_lanes];
+        for (size_t i = 0; i < random_detail::num_lanes; ++i)
+        {
+            const auto a = random_detail::splitmix64 (seed_value);
+            const auto b = random_detail::splitmix64 (seed_value);
+            lanes[0][i] = (uint32_t) a;
+            lanes[1][i] = (uint32_t) (a >> 32);
+            lanes[2][i] = (uint32_t) b;
+            lanes[3][i] = (uint32_t) (b >> 32);
+        }
+        state.s0 = random_detail::load_lanes (lanes[0]);
+        state.s1 = random_detail::load_lanes (lanes[1]);
+        state.s2 = random_detail::load_lanes (lanes[2]);
+        state.s3 = random_detail::load_lanes (lanes[3]);
+    }
+
+    /** Generates N uniform variates in [low, high) (with 23 bits of resolution) */
+    void uniform (float* y, size_t N, float low = 0.0f, float high = 1.0f)
+    {
+        const auto scale = high - low;
+        const auto offset = low - scale;
+        random_detail::fill (y, N, [this, scale, offset]
+                             { return random_detail::one_to_two (state.next()) * scale + offset; });
+    }
+
+    /**
+     * Generates N normal variates with the Box-Muller transform,
+     * sqrt(-2 ln(u1)) * (cos(2 pi u2), sin(2 pi u2)), where each
+     * pair of uniform variates gives two normal variates.
+     *
+     * Since u1 only has 23 bits of resolution (u1 >= 2^-23), the
+     * tails are truncated at sqrt(46 ln(2)) ~= 5.65 standard deviations.
+     */
+    template <int log_order = 5, int trig_order = 9>
+    void normal (float* y, size_t N, float mean = 0.0f, float stddev = 1.0f)
+    {
+        bool has_sin = false;
+        random_detail::float_vector sin_part {};
+        random_detail::fill (y, N, [&]
+                             {
+                                 if (has_sin)
+                                 {
+                                     has_sin = false;
+                                     return sin_part;
+                                 }
+
+                                 using std::sqrt;
+#if defined(XSIMD_HPP)
+                                 using xsimd::sqrt;
+#endif
+                                 // u1 in (0, 1], and the phase (in turns) in [-1/2, 1/2)
+                                 const auto u1 = 2.0f - random_detail::one_to_two (state.next());
+                                 const auto phase = random_detail::one_to_two (state.next()) - 1.5f;
+                                 const auto r = stddev * sqrt (-2.0f * log<log_order> (u1));
+
+                                 has_sin = true;
+                                 sin_part = r * sin_turns_mhalfpi_halfpi<trig_order> (phase) + mean;
+                                 return r * cos_turns_mhalfpi_halfpi<trig_order> (phase) + mean;
+                             });
+    }
+
+    /** Generates N exponential variates with the given rate (lambda), as -ln(u) / rate */
+    template <int log_order = 5>
+    void exponential (float* y, size_t N, float rate = 1.0f)
+    {
+        const auto minus_one_over_rate = -1.0f / rate;
+        random_detail::fill (y, N, [this, minus_one_over_rate]
+                             {
+                                 const auto u = 2.0f - random_detail::one_to_two (state.next()); // (0, 1]
+                                 return minus_one_over_rate * log<log_order> (u);
+                             });
+    }
+
+    /** Generates N Cauchy variates, as location + scale * tan(pi (u - 1/2)) */
+    template <int tan_order = 9>
+    void cauchy (float* y, size_t N, float location = 0.0f, float scale = 1.0f)
+    {
+        random_detail::fill (y, N, [this, location, scale]
+                             {
+                                 // u - 1/2 in (-1/2, 1/2), so that tan() stays finite (and has the right sign)
+                                 const auto u = random_detail::minus_half_to_half (state.next());
+                                 return location + scale * tan_mhalfpi_halfpi<tan_order> ((float) M_PI * u);
+                             });
+    }
+
+private:
+    random_detail::xoshiro128_plus state;
+};
+} // namespace math_approx
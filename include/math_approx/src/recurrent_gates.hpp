@@ -0,0 +1,75 @@
+#pragma once
+
+#include "bulk_approx.hpp"
+#include "hyperbolic_trig_approx.hpp"
+#include "sigmoid_approx.hpp"
+
+namespace math_approx
+{
+/**
+ * Fused LSTM cell update, for a hidden state of size N.
+ *
+ * Takes the pre-activations of the input, forget, cell, and output gates
+ * (i.e. W x + U h + b for each gate), and computes:
+ *   c = sigmoid(f) * c + sigmoid(i) * tanh(g)
+ *   h = sigmoid(o) * tanh(c)
+ * in a single pass, updating the cell state c and writing the hidden state h.
+ */
+template <int sigmoid_order = 7, int tanh_order = 7, typename T>
+void lstm_cell (const T* pre_i, const T* pre_f, const T* pre_g, const T* pre_o, T* c, T* h, size_t N)
+{
+    using namespace bulk_detail;
+    for_each_chunk<T> (N,
+                       [&] (size_t n, auto tag)
+                       {
+                           using V = typename decltype (tag)::type;
+                           const auto i_gate = sigmoid<sigmoid_order> (load<V> (pre_i + n));
+                           const auto f_gate = sigmoid<sigmoid_order> (load<V> (pre_f + n));
+                           const auto g_gate = tanh<tanh_order> (load<V> (pre_g + n));
+                           const auto o_gate = sigmoid<sigmoid_order> (load<V> (pre_o + n));
+
+                           const auto c_next = f_gate * load<V> (c + n) + i_gate * g_gate;
+                           store (c + n, c_next);
+                           store (h + n, o_gate * tanh<tanh_order> (c_next));
+                       });
+}
+
+/**
+ * Fused LSTM cell update, with the gate pre-activations packed
+ * into a single buffer of size 4N, in the order [i, f, g, o]
+ * (the same order used by PyTorch and ONNX Runtime).
+ */
+template <int sigmoid_order = 7, int tanh_order = 7, typename T>
+void lstm_cell (const T* gates, T* c, T* h, size_t N)
+{
+    lstm_cell<sigmoid_order, tanh_order> (gates, gates + N, gates + 2 * N, gates + 3 * N, c, h, N);
+}
+
+/**
+ * Fused GRU cell update, for a hidden state of size N.
+ *
+ * Takes the input projections (W x + b_W) and hidden projections (U h + b_U),
+ * each packed into a buffer of size 3N in the order [r, z, n], and computes:
+ *   r = sigmoid(x_r + h_r)
+ *   z = sigmoid(x_z + h_z)
+ *   n = tanh(x_n + r * h_n)
+ *   h = (1 - z) * n + z * h
+ * in a single pass, updating the hidden state h.
+ */
+template <int sigmoid_order = 7, int tanh_order = 7, typename T>
+void gru_cell (const T* x_gates, const T* h_gates, T* h, size_t N)
+{
+    using namespace bulk_detail;
+    for_each_chunk<T> (N,
+                       [&] (size_t n, auto tag)
+                       {
+                           using V = typename decltype (tag)::type;
+                           const auto r_gate = sigmoid<sigmoid_order> (load<V> (x_gates + n) + load<V> (h_gates + n));
+                           const auto z_gate = sigmoid<sigmoid_order> (load<V> (x_gates + N + n) + load<V> (h_gates + N + n));
+                           const auto n_gate = tanh<tanh_order> (load<V> (x_gates + 2 * N + n) + r_gate * load<V> (h_gates + 2 * N + n));
+
+                           const auto h_prev = load<V> (h + n);
+                           store (h + n, n_gate + z_gate * (h_prev - n_gate));
+                       });
+}
+} // namespace math_approx
@@ -0,0 +1,145 @@
+#pragma once
+
+#include "bulk_approx.hpp"
+#include "pow_approx.hpp"
+#include "trig_approx.hpp"
+
+#include <cmath>
+#include <cstdint>
+
+namespace math_approx
+{
+/**
+ * The memory layout of the rotated pairs within each head.
+ *
+ * split: element i is paired with element i + head_dim / 2 (GPT-NeoX, LLaMA in HF Transformers)
+ * interleaved: element 2i is paired with element 2i + 1 (GPT-J, the original RoFormer)
+ */
+enum class rope_layout
+{
+    split,
+    interleaved,
+};
+
+/**
+ * Computes the rotary embedding frequencies for a head of size head_dim,
+ * i.e. base^(-2i / head_dim) for i in [0, head_dim / 2).
+ *
+ * The frequencies are returned in turns per position (i.e. divided by 2 pi),
+ * since that's what rope_angles() expects.
+ */
+template <int order = 6, typename T>
+void rope_frequencies (T* freqs, size_t head_dim, T base = (T) 10000)
+{
+    using std::log2;
+    const auto num_freqs = head_dim / 2;
+    const auto log2_base_over_dim = log2 (base) / (T) head_dim;
+    for (size_t i = 0; i < num_freqs; ++i)
+        freqs[i] = -(T) (2 * i) * log2_base_over_dim;
+
+    process_bulk (freqs, freqs, num_freqs, [] (auto x)
+                  { return exp2<order> (x) * (T) (0.5 / M_PI); });
+}
+
+/**
+ * Computes the cos and sin of the rotary embedding angles for a single position.
+ *
+ * This is the incremental mode used for autoregressive decoding: only the
+ * angles for the new token's position are computed, with the angle wrapped
+ * to [-1/2, 1/2] turns before the polynomial sin/cos approximations.
+ */
+template <int order = 9, typename T>
+void rope_angles (const T* freqs, T* cos_row, T* sin_row, size_t num_freqs, size_t position)
+{
+    using namespace bulk_detail;
+    const auto pos = (T) position;
+    for_each_chunk<T> (num_freqs,
+                       [&] (size_t n, auto tag)
+                       {
+                           using V = typename decltype (tag)::type;
+                           const auto turns = trig_turns_detail::fast_mod_mhalf_half (pos * load<V> (freqs + n));
+                           store (cos_row + n, cos_turns_mhalfpi_halfpi<order> (turns));
+                           store (sin_row + n, sin_turns_mhalfpi_halfpi<order> (turns));
+                       });
+}
+
+/**
+ * Computes the cos and sin tables (num_positions rows of num_freqs values)
+ * for the positions [start_position, start_position + num_positions).
+ *
+ * Growing an existing table (e.g. a KV-cache's angle table) only requires
+ * computing the new rows, by passing the current table length as start_position.
+ */
+template <int order = 9, typename T>
+void rope_table (const T* freqs, T* cos_table, T* sin_table, size_t num_freqs, size_t start_position, size_t num_positions)
+{
+    for (size_t p = 0; p < num_positions; ++p)
+        rope_angles<order> (freqs, cos_table + p * num_freqs, sin_table + p * num_freqs, num_freqs, start_position + p);
+}
+
+/**
+ * Applies the rotary embedding (in-place) to num_heads consecutive heads of size head_dim,
+ * all at the same position, using one row of the cos/sin tables (head_dim / 2 values).
+ */
+template <rope_layout layout = rope_layout::split, typename T>
+void apply_rope (T* x, const T* cos_row, const T* sin_row, size_t head_dim, size_t num_heads = 1)
+{
+    using namespace bulk_detail;
+    const auto half_dim = head_dim / 2;
+
+    for (size_t h = 0; h < num_heads; ++h)
+    {
+        auto* x_head = x + h * head_dim;
+        if constexpr (layout == rope_layout::split)
+        {
+            for_each_chunk<T> (half_dim,
+                               [&] (size_t n, auto tag)
+                               {
+                                   using V = typename decltype (tag)::type;
+                                   const auto c = load<V> (cos_row + n);
+                                   const auto s = load<V> (sin_row + n);
+                                   const auto x1 = load<V> (x_head + n);
+                                   const auto x2 = load<V> (x_head + half_dim + n);
+                                   store (x_head + n, x1 * c - x2 * s);
+                                   store (x_head + half_dim + n, x2 * c + x1 * s);
+                               });
+        }
+        else
+        {
+            size_t n = 0;
+#if defined(XSIMD_HPP)
+            if constexpr (std::is_same_v<T, float>)
+            {
+                // Each 64-bit lane holds one (x0, x1) pair, so rotating the lanes by 32 bits swaps the pair.
+                using B = xsimd::batch<float>;
+                using U = xsimd::batch<uint64_t, typename B::arch_type>;
+                const auto rotate_pair = [] (const B& v, const B& c, const B& s_signed)
+                {
+                    const auto u = xsimd::bit_cast<U> (v);
+                    const auto v_swapped = xsimd::bit_cast<B> ((u << 32) | (u >> 32));
+                    return xsimd::fma (v, c, v_swapped * s_signed);
+                };
+
+                for (; n + B::size <= half_dim; n += B::size)
+                {
+                    const auto c = B::load_unaligned (cos_row + n);
+                    const auto s = B::load_unaligned (sin_row + n);
+                    auto* x_pairs = x_head + 2 * n;
+                    const auto x_lo = rotate_pair (B::load_unaligned (x_pairs), xsimd::zip_lo (c, c), xsimd::zip_lo (-s, s));
+                    const auto x_hi = rotate_pair (B::load_unaligned (x_pairs + B::size), xsimd::zip_hi (c, c), xsimd::zip_hi (-s, s));
+                    x_lo.store_unaligned (x_pairs);
+                    x_hi.store_unaligned (x_pairs + B::size);
+                }
+            }
+#endif
+            for (; n < half_dim; ++n)
+            {
+                const auto x1 = x_head[2 * n];
+                const auto x2 = x_head[2 * n + 1];
+                x_head[2 * n] = x1 * cos_row[n] - x2 * sin_row[n];
+                x_head[2 * n + 1] = x2 * cos_row[n] + x1 * sin_row[n];
+            }
+        }
+    }
+}
+} // namespace math_approx
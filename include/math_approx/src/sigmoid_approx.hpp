@@ -7,6 +7,84 @@ namespace math_approx
 namespace sigmoid_detail
 {
     // for polynomial derivations, see notebooks/sigmoid_approx.nb
+    // Orders 11 and above are intended for double-precision, and are rescaled
+    // versions of the double-precision tanh() fits (p(x) ≈ sinh(x)),
+    // since sigmoid(x) = (1/2) tanh(x/2) + (1/2).
+
+    template <typename T>
+    constexpr T sig_poly_19 (T x)
+    {
+        using S = scalar_of_t<T>;
+        const auto x_sq = x * x;
+        const auto y_17_19 = (S) 1.8122092702183604625e-20 + (S) 2.5666876124425675159e-23 * x_sq;
+        const auto y_15_17_19 = (S) 2.3854753793376775345e-17 + y_17_19 * x_sq;
+        const auto y_13_15_17_19 = (S) 1.9561644937437564849e-14 + y_15_17_19 * x_sq;
+        const auto y_11_13_15_17_19 = (S) 1.2234250786395554753e-11 + y_13_15_17_19 * x_sq;
+        const auto y_9_11_13_15_17_19 = (S) 5.3822499482319447947e-9 + y_11_13_15_17_19 * x_sq;
+        const auto y_7_9_11_13_15_17_19 = (S) 1.5500996142005625983e-6 + y_9_11_13_15_17_19 * x_sq;
+        const auto y_5_7_9_11_13_15_17_19 = (S) 0.00026041666492445935094 + y_7_9_11_13_15_17_19 * x_sq;
+        const auto y_3_5_7_9_11_13_15_17_19 = (S) 0.020833333335433110966 + y_5_7_9_11_13_15_17_19 * x_sq;
+        const auto y_1_3_5_7_9_11_13_15_17_19 = (S) 0.5 + y_3_5_7_9_11_13_15_17_19 * x_sq;
+        return x * y_1_3_5_7_9_11_13_15_17_19;
+    }
+
+    template <typename T>
+    constexpr T sig_poly_17 (T x)
+    {
+        using S = scalar_of_t<T>;
+        const auto x_sq = x * x;
+        const auto y_15_17 = (S) 2.0504024001118636101e-17 + (S) 3.3484104029491809495e-20 * x_sq;
+        const auto y_13_15_17 = (S) 1.990304889449967438e-14 + y_15_17 * x_sq;
+        const auto y_11_13_15_17 = (S) 1.2216894074635479434e-11 + y_13_15_17 * x_sq;
+        const auto y_9_11_13_15_17 = (S) 5.3826871538337100987e-9 + y_11_13_15_17 * x_sq;
+        const auto y_7_9_11_13_15_17 = (S) 1.5500945028593320074e-6 + y_9_11_13_15_17 * x_sq;
+        const auto y_5_7_9_11_13_15_17 = (S) 0.00026041668879710180354 + y_7_9_11_13_15_17 * x_sq;
+        const auto y_3_5_7_9_11_13_15_17 = (S) 0.020833333304507994362 + y_5_7_9_11_13_15_17 * x_sq;
+        const auto y_1_3_5_7_9_11_13_15_17 = (S) 0.5 + y_3_5_7_9_11_13_15_17 * x_sq;
+        return x * y_1_3_5_7_9_11_13_15_17;
+    }
+
+    template <typename T>
+    constexpr T sig_poly_15 (T x)
+    {
+        using S = scalar_of_t<T>;
+        const auto x_sq = x * x;
+        const auto y_13_15 = (S) 1.7789981362460780905e-14 + (S) 3.4734409303934842012e-17 * x_sq;
+        const auto y_11_13_15 = (S) 1.2355676842927313331e-11 + y_13_15 * x_sq;
+        const auto y_9_11_13_15 = (S) 5.3784651651566365303e-9 + y_11_13_15 * x_sq;
+        const auto y_7_9_11_13_15 = (S) 1.550151559868064222e-6 + y_9_11_13_15 * x_sq;
+        const auto y_5_7_9_11_13_15 = (S) 0.00026041639024312959104 + y_7_9_11_13_15 * x_sq;
+        const auto y_3_5_7_9_11_13_15 = (S) 0.020833333727575805101 + y_5_7_9_11_13_15 * x_sq;
+        const auto y_1_3_5_7_9_11_13_15 = (S) 0.5 + y_3_5_7_9_11_13_15 * x_sq;
+        return x * y_1_3_5_7_9_11_13_15;
+    }
+
+    template <typename T>
+    constexpr T sig_poly_13 (T x)
+    {
+        using S = scalar_of_t<T>;
+        const auto x_sq = x * x;
+        const auto y_11_13 = (S) 1.13999951746139693e-11 + (S) 2.7810584373222346811e-14 * x_sq;
+        const auto y_9_11_13 = (S) 5.4158611366705650194e-9 + y_11_13 * x_sq;
+        const auto y_7_9_11_13 = (S) 1.5495443225937882478e-6 + y_9_11_13 * x_sq;
+        const auto y_5_7_9_11_13 = (S) 0.00026042004171932765947 + y_7_9_11_13 * x_sq;
+        const auto y_3_5_7_9_11_13 = (S) 0.020833327968421409109 + y_5_7_9_11_13 * x_sq;
+        const auto y_1_3_5_7_9_11_13 = (S) 0.5 + y_3_5_7_9_11_13 * x_sq;
+        return x * y_1_3_5_7_9_11_13;
+    }
+
+    template <typename T>
+    constexpr T sig_poly_11 (T x)
+    {
+        using S = scalar_of_t<T>;
+        const auto x_sq = x * x;
+        const auto y_9_11 = (S) 5.1254854363135538369e-9 + (S) 1.6534359232507609513e-11 * x_sq;
+        const auto y_7_9_11 = (S) 1.5555746831964553636e-6 + y_9_11 * x_sq;
+        const auto y_5_7_9_11 = (S) 0.00026037676168870551922 + y_7_9_11 * x_sq;
+        const auto y_3_5_7_9_11 = (S) 0.020833405823789737722 + y_5_7_9_11 * x_sq;
+        const auto y_1_3_5_7_9_11 = (S) 0.5 + y_3_5_7_9_11 * x_sq;
+        return x * y_1_3_5_7_9_11;
+    }
 
     template <typename T>
     constexpr T sig_poly_9 (T x)
@@ -59,10 +137,20 @@ namespace sigmoid_detail
 template <int order, typename T>
 T sigmoid (T x)
 {
-    static_assert (order % 2 == 1 && order <= 9 && order >= 3, "Order must e an odd number within [3, 9]");
+    static_assert (order % 2 == 1 && order <= 19 && order >= 3, "Order must e an odd number within [3, 19]");
 
     T x_poly {};
-    if constexpr (order == 9)
+    if constexpr (order == 19)
+        x_poly = sigmoid_detail::sig_poly_19 (x);
+    else if constexpr (order == 17)
+        x_poly = sigmoid_detail::sig_poly_17 (x);
+    else if constexpr (order == 15)
+        x_poly = sigmoid_detail::sig_poly_15 (x);
+    else if constexpr (order == 13)
+        x_poly = sigmoid_detail::sig_poly_13 (x);
+    else if constexpr (order == 11)
+        x_poly = sigmoid_detail::sig_poly_11 (x);
+    else if constexpr (order == 9)
         x_poly = sigmoid_detail::sig_poly_9 (x);
     else if constexpr (order == 7)
         x_poly = sigmoid_detail::sig_poly_7 (x);
@@ -72,7 +160,19 @@ T sigmoid (T x)
         x_poly = sigmoid_detail::sig_poly_3 (x);
 
     using S = scalar_of_t<T>;
-    return (S) 0.5 * x_poly * rsqrt (x_poly * x_poly + (S) 1) + (S) 0.5;
+    if constexpr (order >= 11)
+    {
+        // the SIMD rsqrt() is only accurate to single-precision
+        using std::sqrt;
+#if defined(XSIMD_HPP)
+        using xsimd::sqrt;
+#endif
+        return (S) 0.5 * x_poly / sqrt (x_poly * x_poly + (S) 1) + (S) 0.5;
+    }
+    else
+    {
+        return (S) 0.5 * x_poly * rsqrt (x_poly * x_poly + (S) 1) + (S) 0.5;
+    }
 }
 
 
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "bulk_approx.hpp"
+#include "inverse_trig_approx.hpp"
+#include "log_approx.hpp"
+
+#include <cmath>
+
+namespace math_approx
+{
+namespace spectrum_detail
+{
+    /** dB = 10 * log10(power) = log2(power) / (log2(10) / 10) */
+    template <typename T>
+    struct PowerDecibelBase
+    {
+        static constexpr auto log2_base = (T) (3.3219280948873623479 / 10.0);
+    };
+
+    /**
+     * Loads one chunk of interleaved (re, im) pairs (one pair per lane of V),
+     * starting at pair n, and splits them into separate real and imaginary values.
+     *
+     * For XSIMD batches, the split is done in registers: zip_lo/zip_hi is a perfect
+     * shuffle of the two batches, and for 2L values (with L a power of two) log2(2L)
+     * perfect shuffles return the original order, so log2(L) zips undo the interleaving.
+     */
+    template <typename V, typename T>
+    void load_deinterleaved (const T* re_im, size_t n, V& re, V& im)
+    {
+        if constexpr (std::is_arithmetic_v<V>)
+        {
+            re = re_im[2 * n];
+            im = re_im[2 * n + 1];
+        }
+#if defined(XSIMD_HPP)
+        else
+        {
+            re = V::load_unaligned (re_im + 2 * n);
+            im = V::load_unaligned (re_im + 2 * n + V::size);
+            for (size_t k = 1; k < V::size; k *= 2)
+            {
+                const auto lo = xsimd::zip_lo (re, im);
+                const auto hi = xsimd::zip_hi (re, im);
+                re = lo;
+                im = hi;
+            }
+        }
+#endif
+    }
+
+    template <typename T>
+    T floor_power (T floor_db)
+    {
+        return (T) std::pow (10.0, (double) floor_db / 10.0);
+    }
+} // namespace spectrum_detail
+
+/**
+ * Approximation of 10 * log10(re^2 + im^2), i.e. the magnitude in dB of a complex
+ * value, clamped at floor_db. Since this works from the power (the squared magnitude),
+ * it doesn't need a square root, and clamping the power first avoids log(0).
+ *
+ * Note that the floor is converted to a power with std::pow() on every call,
+ * so for many values, the bulk version should be preferred.
+ */
+template <int order, typename T>
+T complex_to_db (T re, T im, scalar_of_t<T> floor_db = (scalar_of_t<T>) -120)
+{
+    using std::max;
+#if defined(XSIMD_HPP)
+    using xsimd::max;
+#endif
+
+    using S = scalar_of_t<T>;
+    const auto power = max (re * re + im * im, T { spectrum_detail::floor_power (floor_db) });
+    return log<spectrum_detail::PowerDecibelBase<S>, order, false> (power);
+}
+
+/**
+ * Converts N interleaved complex values (e.g. FFT output) to magnitudes in dB,
+ * clamped at floor_db (see complex_to_db()). This is a single pass: the values
+ * are de-interleaved in registers, and the power, logarithm, and clamp are fused.
+ */
+template <int order, typename T>
+void complex_to_db (const T* re_im, T* db, size_t N, T floor_db = (T) -120)
+{
+    using namespace bulk_detail;
+    using std::max;
+#if defined(XSIMD_HPP)
+    using xsimd::max;
+#endif
+
+    const auto floor_power = spectrum_detail::floor_power (floor_db);
+    for_each_chunk<T> (N,
+                       [&] (size_t n, auto tag)
+                       {
+                           using V = typename decltype (tag)::type;
+                           V re, im;
+                           spectrum_detail::load_deinterleaved (re_im, n, re, im);
+                           const auto power = max (re * re + im * im, V { floor_power });
+                           store (db + n, log<spectrum_detail::PowerDecibelBase<T>, order, false> (power));
+                       });
+}
+
+/**
+ * Same as complex_to_db(), but also writes the phase of each complex value
+ * (in radians, in [-pi, pi]), using atan2<atan_order>().
+ */
+template <int order, int atan_order, typename T>
+void complex_to_db (const T* re_im, T* db, T* phase, size_t N, T floor_db = (T) -120)
+{
+    using namespace bulk_detail;
+    using std::max;
+#if defined(XSIMD_HPP)
+    using xsimd::max;
+#endif
+
+    const auto floor_power = spectrum_detail::floor_power (floor_db);
+    for_each_chunk<T> (N,
+                       [&] (size_t n, auto tag)
+                       {
+                           using V = typename decltype (tag)::type;
+                           V re, im;
+                           spectrum_detail::load_deinterleaved (re_im, n, re, im);
+                           const auto power = max (re * re + im * im, V { floor_power });
+                           store (db + n, log<spectrum_detail::PowerDecibelBase<T>, order, false> (power));
+                           store (phase + n, atan2<atan_order> (im, re));
+                       });
+}
+} // namespace math_approx
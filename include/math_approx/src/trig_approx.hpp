@@ -2,6 +2,10 @@
 
 #include "basic_math.hpp"
 
+#if defined(__SSE4_1__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
 namespace math_approx
 {
 namespace trig_detail
@@ -48,9 +52,142 @@ namespace trig_detail
         return select (x >= (T) 0, mod, mod + pi) - half_pi;
     }
 
+    /** Rounds to the nearest integer, without converting to an integer type */
+    template <typename T>
+    T round_nearest (T x)
+    {
+        if constexpr (std::is_same_v<T, float>)
+        {
+#if defined(__SSE4_1__) || defined(_M_X64) || defined(_M_IX86)
+            const auto x_vec = _mm_set_ss (x);
+            return _mm_cvtss_f32 (_mm_round_ss (x_vec, x_vec, _MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC));
+#else
+            return std::nearbyint (x);
+#endif
+        }
+        else
+        {
+            using std::nearbyint;
+#if defined(XSIMD_HPP)
+            using xsimd::nearbyint;
+#endif
+            return nearbyint (x);
+        }
+    }
+
+    /**
+     * Cody-Waite range reduction, computing x - k * period, with k = round(x / period),
+     * and period = 2pi (or pi, if half_period is true).
+     *
+     * The period is split into a sum of constants, where the leading constants have
+     * few enough significant bits that their products with k are exact, so that the
+     * leading subtractions are exact as well. To keep the products exact for large k,
+     * k is also split as k_hi + k_lo, where k_hi is a multiple of 2^12 (float) or
+     * 2^26 (double), so |k_lo| <= 2^11 (or 2^25).
+     *
+     * For float, c1 = 3217/512 and c2 both have 12 significant bits, so the products
+     * with k_lo always fit in 24 bits, and the products with k_hi fit as long as
+     * |k_hi| / 2^12 <= 2^12, i.e. |k| <= 2^24. That's |x| up to about 1.05e8 for the
+     * 2pi period, or about 5.3e7 for the pi period. For double, c1 and c2 have 26 and
+     * 23 significant bits, so the products are exact for |k| <= 2^53 (|x| up to about
+     * 5.7e16, or 2.8e16 for the pi period). Beyond that, the products with k_hi are
+     * rounded, and the error grows with |x|.
+     */
+    template <bool half_period, typename T>
+    T cody_waite_mod (T x)
+    {
+        using S = scalar_of_t<T>;
+        constexpr auto scale = half_period ? (S) 0.5 : (S) 1;
+        constexpr auto recip_period = (S) (1.0 / (2.0 * M_PI)) / scale;
+        constexpr auto is_float = std::is_same_v<S, float>;
+
+        // 12 + 12 + 24 significant bits for float, 26 + 23 + 53 for double
+        constexpr auto c1 = scale * (is_float ? (S) 6.283203125 : (S) 6.28318536281585693359375);
+        constexpr auto c2 = scale * (is_float ? (S) -1.7814338207244873046875e-5 : (S) -5.563627070159782306291163e-8);
+        constexpr auto c3 = scale * (is_float ? (S) -3.482206301086421262880322e-9 : (S) 2.449293598294706414347528e-16);
+        constexpr auto k_split = is_float ? (S) 4096 : (S) 67108864; // 2^12 or 2^26
+
+        const auto k = round_nearest (x * recip_period);
+        const auto k_hi = round_nearest (k * ((S) 1 / k_split)) * k_split;
+        const auto k_lo = k - k_hi;
+
+        auto r = x - k_hi * c1;
+        r -= k_lo * c1;
+        r -= k_hi * c2;
+        r -= k_lo * c2;
+        r -= k_hi * c3;
+        r -= k_lo * c3;
+
+        // x * recip_period is rounded before it is rounded to an integer, so for
+        // large x, k can be off by one, leaving r slightly outside the period.
+        // One more (exact) reduction of the small remainder folds it back in.
+        const auto k_fold = round_nearest (r * recip_period);
+        r -= k_fold * c1;
+        r -= k_fold * c2;
+        r -= k_fold * c3;
+        return r;
+    }
+
     // Polynomials were derived using the method presented in
     // https://mooooo.ooo/chebyshev-sine-approximation/
     // and then adapted for various (odd) orders.
+    // Orders 11 and above are minimax fits (at extended precision) intended for
+    // double-precision, where the lower-order fits reach their limits. (For
+    // sin_turns, only orders 13 and above are; its order 11 is a single-precision fit.)
+
+    template <typename T>
+    constexpr T sin_poly_17 (T x, T x_sq)
+    {
+        using S = scalar_of_t<T>;
+        const auto x_15_17 = (S) -2.7187684725836332305e-15 + (S) 7.2590111141657147759e-18 * x_sq;
+        const auto x_13_15_17 = (S) 7.376228683328679045e-13 + x_15_17 * x_sq;
+        const auto x_11_13_15_17 = (S) -1.5330841015950509423e-10 + x_13_15_17 * x_sq;
+        const auto x_9_11_13_15_17 = (S) 2.3539005476303977082e-8 + x_11_13_15_17 * x_sq;
+        const auto x_7_9_11_13_15_17 = (S) -2.5234112214867261386e-6 + x_9_11_13_15_17 * x_sq;
+        const auto x_5_7_9_11_13_15_17 = (S) 0.00017350762786287148992 + x_7_9_11_13_15_17 * x_sq;
+        const auto x_3_5_7_9_11_13_15_17 = (S) -0.0066208816857028886599 + x_5_7_9_11_13_15_17 * x_sq;
+        const auto x_1_3_5_7_9_11_13_15_17 = (S) 0.10132118364233744209 + x_3_5_7_9_11_13_15_17 * x_sq;
+        return x * x_1_3_5_7_9_11_13_15_17;
+    }
+
+    template <typename T>
+    constexpr T sin_poly_15 (T x, T x_sq)
+    {
+        using S = scalar_of_t<T>;
+        const auto x_13_15 = (S) 7.3349097992777997562e-13 + (S) -2.4478733495350519267e-15 * x_sq;
+        const auto x_11_13_15 = (S) -1.5327525016770307743e-10 + x_13_15 * x_sq;
+        const auto x_9_11_13_15 = (S) 2.3538855366757819713e-8 + x_11_13_15 * x_sq;
+        const auto x_7_9_11_13_15 = (S) -2.5234108402821714742e-6 + x_9_11_13_15 * x_sq;
+        const auto x_5_7_9_11_13_15 = (S) 0.00017350762735613590794 + x_7_9_11_13_15 * x_sq;
+        const auto x_3_5_7_9_11_13_15 = (S) -0.006620881685405077441 + x_5_7_9_11_13_15 * x_sq;
+        const auto x_1_3_5_7_9_11_13_15 = (S) 0.10132118364228733022 + x_3_5_7_9_11_13_15 * x_sq;
+        return x * x_1_3_5_7_9_11_13_15;
+    }
+
+    template <typename T>
+    constexpr T sin_poly_13 (T x, T x_sq)
+    {
+        using S = scalar_of_t<T>;
+        const auto x_11_13 = (S) -1.5225607134571207585e-10 + (S) 6.5413419123459683084e-13 * x_sq;
+        const auto x_9_11_13 = (S) 2.3532263385475818858e-8 + x_11_13 * x_sq;
+        const auto x_7_9_11_13 = (S) -2.5233883022520945002e-6 + x_9_11_13 * x_sq;
+        const auto x_5_7_9_11_13 = (S) 0.00017350758840509489766 + x_7_9_11_13 * x_sq;
+        const auto x_3_5_7_9_11_13 = (S) -0.0066208816562694590825 + x_5_7_9_11_13 * x_sq;
+        const auto x_1_3_5_7_9_11_13 = (S) 0.10132118363612448331 + x_3_5_7_9_11_13 * x_sq;
+        return x * x_1_3_5_7_9_11_13;
+    }
+
+    template <typename T>
+    constexpr T sin_poly_11 (T x, T x_sq)
+    {
+        using S = scalar_of_t<T>;
+        const auto x_9_11 = (S) 2.3344079181311242176e-8 + (S) -1.3424904224248279282e-10 * x_sq;
+        const auto x_7_9_11 = (S) -2.5224587755652847406e-6 + x_9_11 * x_sq;
+        const auto x_5_7_9_11 = (S) 0.00017350539756112357025 + x_7_9_11 * x_sq;
+        const auto x_3_5_7_9_11 = (S) -0.006620879493073296492 + x_5_7_9_11 * x_sq;
+        const auto x_1_3_5_7_9_11 = (S) 0.1013211830430624619 + x_3_5_7_9_11 * x_sq;
+        return x * x_1_3_5_7_9_11;
+    }
 
     template <typename T>
     constexpr T sin_poly_9 (T x, T x_sq)
@@ -83,11 +220,54 @@ namespace trig_detail
     }
 } // namespace trig_detail
 
+/**
+ * Range reduction for the full-range trig functions, which truncates through an
+ * integer conversion. This is the fastest option, but the accuracy degrades as |x|
+ * grows, and the integer conversion overflows for |x| > 2^31 * pi.
+ */
+struct FastTrigRangeReduction
+{
+    template <typename T>
+    static constexpr T mod_mpi_pi (T x)
+    {
+        return trig_detail::fast_mod_mpi_pi (x);
+    }
+
+    template <typename T>
+    static constexpr T mod_mhalfpi_halfpi (T x)
+    {
+        return trig_detail::fast_mod_mhalfpi_halfpi (x);
+    }
+};
+
+/**
+ * Range reduction for the full-range trig functions, using a Cody-Waite
+ * multi-constant reduction (see trig_detail::cody_waite_mod()). This is a
+ * little bit slower than FastTrigRangeReduction, but stays accurate for large
+ * arguments (e.g. long-running phase accumulators), and is branch-free for SIMD.
+ * For float, the reduction is exact up to about 1e8 (or 5e7 for the pi period
+ * used by tan), and for double, up to about 5.7e16.
+ */
+struct CodyWaiteTrigRangeReduction
+{
+    template <typename T>
+    static T mod_mpi_pi (T x)
+    {
+        return trig_detail::cody_waite_mod<false> (x);
+    }
+
+    template <typename T>
+    static T mod_mhalfpi_halfpi (T x)
+    {
+        return trig_detail::cody_waite_mod<true> (x);
+    }
+};
+
 /** Polynomial approximation of sin(x) on the range [-pi, pi] */
 template <int order, typename T>
 constexpr T sin_mpi_pi (T x)
 {
-    static_assert (order % 2 == 1 && order <= 9 && order >= 5, "Order must be an odd number within [5, 9]");
+    static_assert (order % 2 == 1 && order <= 17 && order >= 5, "Order must be an odd number within [5, 17]");
 
     using S = scalar_of_t<T>;
     constexpr auto pi = static_cast<S> (M_PI);
@@ -95,7 +275,15 @@ constexpr T sin_mpi_pi (T x)
     const auto x_sq = x * x;
 
     T x_poly {};
-    if constexpr (order == 9)
+    if constexpr (order == 17)
+        x_poly = trig_detail::sin_poly_17 (x, x_sq);
+    else if constexpr (order == 15)
+        x_poly = trig_detail::sin_poly_15 (x, x_sq);
+    else if constexpr (order == 13)
+        x_poly = trig_detail::sin_poly_13 (x, x_sq);
+    else if constexpr (order == 11)
+        x_poly = trig_detail::sin_poly_11 (x, x_sq);
+    else if constexpr (order == 9)
         x_poly = trig_detail::sin_poly_9 (x, x_sq);
     else if constexpr (order == 7)
         x_poly = trig_detail::sin_poly_7 (x, x_sq);
@@ -105,11 +293,11 @@ constexpr T sin_mpi_pi (T x)
     return (pi_sq - x_sq) * x_poly;
 }
 
-/** Full range approximation of sin(x) */
-template <int order, typename T>
+/** Full range approximation of sin(x), with a configurable range reduction (see FastTrigRangeReduction) */
+template <int order, typename T, typename RangeReduction = FastTrigRangeReduction>
 constexpr T sin (T x)
 {
-    return sin_mpi_pi<order, T> (trig_detail::fast_mod_mpi_pi (x));
+    return sin_mpi_pi<order, T> (RangeReduction::mod_mpi_pi (x));
 }
 
 /**
@@ -119,7 +307,7 @@ constexpr T sin (T x)
 template <int order, typename T>
 constexpr T cos_mpi_pi (T x)
 {
-    static_assert (order % 2 == 1 && order <= 9 && order >= 5, "Order must be an odd number within [5, 9]");
+    static_assert (order % 2 == 1 && order <= 17 && order >= 5, "Order must be an odd number within [5, 17]");
 
     using S = scalar_of_t<T>;
     constexpr auto pi = static_cast<S> (M_PI);
@@ -136,7 +324,15 @@ constexpr T cos_mpi_pi (T x)
     const auto hpmx_sq = hpmx * hpmx;
 
     T x_poly {};
-    if constexpr (order == 9)
+    if constexpr (order == 17)
+        x_poly = trig_detail::sin_poly_17 (hpmx, hpmx_sq);
+    else if constexpr (order == 15)
+        x_poly = trig_detail::sin_poly_15 (hpmx, hpmx_sq);
+    else if constexpr (order == 13)
+        x_poly = trig_detail::sin_poly_13 (hpmx, hpmx_sq);
+    else if constexpr (order == 11)
+        x_poly = trig_detail::sin_poly_11 (hpmx, hpmx_sq);
+    else if constexpr (order == 9)
         x_poly = trig_detail::sin_poly_9 (hpmx, hpmx_sq);
     else if constexpr (order == 7)
         x_poly = trig_detail::sin_poly_7 (hpmx, hpmx_sq);
@@ -146,11 +342,11 @@ constexpr T cos_mpi_pi (T x)
     return (pi_sq - hpmx_sq) * x_poly;
 }
 
-/** Full range approximation of cos(x) */
-template <int order, typename T>
+/** Full range approximation of cos(x), with a configurable range reduction (see FastTrigRangeReduction) */
+template <int order, typename T, typename RangeReduction = FastTrigRangeReduction>
 constexpr T cos (T x)
 {
-    return cos_mpi_pi<order, T> (trig_detail::fast_mod_mpi_pi (x));
+    return cos_mpi_pi<order, T> (RangeReduction::mod_mpi_pi (x));
 }
 
 /** Polynomial approximation of tan(x) on the range [-pi/4, pi/4] */
@@ -244,14 +440,14 @@ constexpr T tan_mhalfpi_halfpi (T x)
 }
 
 /**
- * Full-range approximation of tan(x)
+ * Full-range approximation of tan(x), with a configurable range reduction (see FastTrigRangeReduction)
  *
  * Accuracy may suffer as x approaches values for which tan(x) approaches ±Inf.
  */
-template <int order, typename T>
+template <int order, typename T, typename RangeReduction = FastTrigRangeReduction>
 constexpr T tan (T x)
 {
-    return tan_mhalfpi_halfpi<order> (trig_detail::fast_mod_mhalfpi_halfpi (x));
+    return tan_mhalfpi_halfpi<order> (RangeReduction::mod_mhalfpi_halfpi (x));
 }
 
 //===============================================================================
@@ -291,12 +487,48 @@ namespace trig_turns_detail
 template <int order, typename T>
 constexpr T sin_turns_mhalfpi_halfpi (T x)
 {
-    static_assert (order % 2 == 1 && order <= 11 && order >= 5, "Order must be an odd number within [5, 11]");
+    static_assert (order % 2 == 1 && order <= 17 && order >= 5, "Order must be an odd number within [5, 17]");
 
     using S = scalar_of_t<T>;
     const auto x_sq = x * x;
     T y;
-    if constexpr (order == 11)
+    if constexpr (order == 17)
+    {
+        // orders 13 and above are minimax fits intended for double-precision (see the comment
+        // above trig_detail::sin_poly_17), but unlike sin/cos, order 11 here keeps the
+        // original single-precision coefficients
+        const auto x_15_17 = (S) 0.10079291075732999964 + (S) -0.010624168747878370605 * x_sq;
+        const auto x_13_15_17 = (S) -0.69267960073558401417 + x_15_17 * x_sq;
+        const auto x_11_13_15_17 = (S) 3.6467355318191187587 + x_13_15_17 * x_sq;
+        const auto x_9_11_13_15_17 = (S) -14.182952940007515073 + x_11_13_15_17 * x_sq;
+        const auto x_7_9_11_13_15_17 = (S) 38.512955269340497374 + x_9_11_13_15_17 * x_sq;
+        const auto x_5_7_9_11_13_15_17 = (S) -67.077620915436364129 + x_7_9_11_13_15_17 * x_sq;
+        const auto x_3_5_7_9_11_13_15_17 = (S) 64.835844046702108724 + x_5_7_9_11_13_15_17 * x_sq;
+        const auto x_1_3_5_7_9_11_13_15_17 = (S) -25.132741228718264212 + x_3_5_7_9_11_13_15_17 * x_sq;
+        y = x * x_1_3_5_7_9_11_13_15_17;
+    }
+    else if constexpr (order == 15)
+    {
+        const auto x_13_15 = (S) -0.68879946776575216797 + (S) 0.090750015145816443431 * x_sq;
+        const auto x_11_13_15 = (S) 3.6459467576076229131 + x_13_15 * x_sq;
+        const auto x_9_11_13_15 = (S) -14.182862494528366047 + x_11_13_15 * x_sq;
+        const auto x_7_9_11_13_15 = (S) 38.512949451297905961 + x_9_11_13_15 * x_sq;
+        const auto x_5_7_9_11_13_15 = (S) -67.077620719533638173 + x_7_9_11_13_15 * x_sq;
+        const auto x_3_5_7_9_11_13_15 = (S) 64.835844043785753673 + x_5_7_9_11_13_15 * x_sq;
+        const auto x_1_3_5_7_9_11_13_15 = (S) -25.132741228705833951 + x_3_5_7_9_11_13_15 * x_sq;
+        y = x * x_1_3_5_7_9_11_13_15;
+    }
+    else if constexpr (order == 13)
+    {
+        const auto x_11_13 = (S) 3.6217036282217970768 + (S) -0.6142778781194203744 * x_sq;
+        const auto x_9_11_13 = (S) -14.178890629174999867 + x_11_13 * x_sq;
+        const auto x_7_9_11_13 = (S) 38.512605470048705466 + x_9_11_13 * x_sq;
+        const auto x_5_7_9_11_13 = (S) -67.077605661157269761 + x_7_9_11_13 * x_sq;
+        const auto x_3_5_7_9_11_13 = (S) 64.835843758471425799 + x_5_7_9_11_13 * x_sq;
+        const auto x_1_3_5_7_9_11_13 = (S) -25.13274122717713846 + x_3_5_7_9_11_13 * x_sq;
+        y = x * x_1_3_5_7_9_11_13;
+    }
+    else if constexpr (order == 11)
     {
         // -25.1327411554 x + 64.8358228565 x^3 - 67.0766273790 x^5 + 38.4958788775 x^7 - 14.0496638478 x^9 + 3.16160207407
         const auto x_q = x_sq * x_sq;
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "bulk_approx.hpp"
+#include "log_approx.hpp"
+#include "pow_approx.hpp"
+
+namespace math_approx
+{
+namespace conversion_detail
+{
+    /** gain = 10^(dB / 20) = 2^(dB * log2(10) / 20) */
+    template <typename T>
+    struct DecibelBase
+    {
+        static constexpr auto log2_base = (T) (3.3219280948873623479 / 20.0);
+    };
+
+    /** hz = 440 * 2^((note - 69) / 12) = 2^(note / 12 + log2(440) - 69 / 12) */
+    template <typename T>
+    struct MidiBase
+    {
+        static constexpr auto log2_base = (T) (1.0 / 12.0);
+        static constexpr auto offset = (T) (8.7813597135246599 - 69.0 / 12.0);
+    };
+} // namespace conversion_detail
+
+/** Approximation of 10^(x / 20), i.e. converting decibels to linear gain */
+template <int order, bool C1_continuous = false, bool clamp_range = true, typename T>
+constexpr T db_to_gain (T x)
+{
+    return pow<conversion_detail::DecibelBase<scalar_of_t<T>>, order, C1_continuous, clamp_range> (x);
+}
+
+/** Approximation of 20 * log10(x), i.e. converting linear gain to decibels (x must be positive) */
+template <int order, bool C1_continuous = false, typename T>
+constexpr T gain_to_db (T x)
+{
+    return log<conversion_detail::DecibelBase<scalar_of_t<T>>, order, C1_continuous> (x);
+}
+
+/** Approximation of 440 * 2^((x - 69) / 12), i.e. converting MIDI note numbers to frequency in Hz */
+template <int order, bool C1_continuous = false, bool clamp_range = true, typename T>
+constexpr T midi_to_hz (T x)
+{
+    return pow<conversion_detail::MidiBase<scalar_of_t<T>>, order, C1_continuous, clamp_range> (x);
+}
+
+/** Approximation of 69 + 12 * log2(x / 440), i.e. converting frequency in Hz to MIDI note numbers (x must be positive) */
+template <int order, bool C1_continuous = false, typename T>
+constexpr T hz_to_midi (T x)
+{
+    return log<conversion_detail::MidiBase<scalar_of_t<T>>, order, C1_continuous> (x);
+}
+
+/** Converts a buffer of decibel values to linear gains (see process_bulk) */
+template <int order, bool C1_continuous = false, bool clamp_range = true, typename T>
+void db_to_gain (const T* x, T* y, size_t N)
+{
+    process_bulk (x, y, N, [] (auto v)
+                  { return db_to_gain<order, C1_continuous, clamp_range> (v); });
+}
+
+/** Converts a buffer of linear gains to decibels (see process_bulk) */
+template <int order, bool C1_continuous = false, typename T>
+void gain_to_db (const T* x, T* y, size_t N)
+{
+    process_bulk (x, y, N, [] (auto v)
+                  { return gain_to_db<order, C1_continuous> (v); });
+}
+
+/** Converts a buffer of MIDI note numbers to frequencies in Hz (see process_bulk) */
+template <int order, bool C1_continuous = false, bool clamp_range = true, typename T>
+void midi_to_hz (const T* x, T* y, size_t N)
+{
+    process_bulk (x, y, N, [] (auto v)
+                  { return midi_to_hz<order, C1_continuous, clamp_range> (v); });
+}
+
+/** Converts a buffer of frequencies in Hz to MIDI note numbers (see process_bulk) */
+template <int order, bool C1_continuous = false, typename T>
+void hz_to_midi (const T* x, T* y, size_t N)
+{
+    process_bulk (x, y, N, [] (auto v)
+                  { return hz_to_midi<order, C1_continuous> (v); });
+}
+} // namespace math_approx
@@ -0,0 +1,263 @@
+#pragma once
+
+#include "basic_math.hpp"
+#include "wright_omega_approx.hpp"
+
+#include <cmath>
+
+namespace math_approx
+{
+// Wave digital filter (WDF) diode models, using the closed-form solutions
+// from Werner et al., "An Improved and Generalized Diode Clipper Model for
+// Wave Digital Filters", AES 2015, and D'Angelo et al., "Fast Approximation
+// of the Lambert W Function for Virtual Analog Modelling", DAFx 2019.
+//
+// Each kernel takes incident waves (a) and returns reflected waves (b), and works
+// with scalars or XSIMD batches (where each lane is an independent voice/channel).
+
+/** Wright-Omega provider, using math_approx::wright_omega() */
+template <int num_nr_iters = 1, int poly_order = 3>
+struct WrightOmegaProvider
+{
+    template <typename T>
+    static T omega (T x)
+    {
+        return wright_omega<num_nr_iters, poly_order> (x);
+    }
+};
+
+/** Wright-Omega provider, using math_approx::wright_omega_dangelo() */
+template <int num_nr_iters = 1>
+struct DAngeloOmegaProvider
+{
+    template <typename T>
+    static T omega (T x)
+    {
+        return wright_omega_dangelo<num_nr_iters> (x);
+    }
+};
+
+namespace wdf_detail
+{
+    template <typename T>
+    T log (T x)
+    {
+        using std::log;
+#if defined(XSIMD_HPP)
+        using xsimd::log;
+#endif
+        return log (x);
+    }
+
+    template <typename T>
+    T copysign (T mag, T sign_source)
+    {
+        return select (sign_source < (T) 0, -mag, mag);
+    }
+
+    template <typename T>
+    T abs (T x)
+    {
+        using std::abs;
+#if defined(XSIMD_HPP)
+        using xsimd::abs;
+#endif
+        return abs (x);
+    }
+} // namespace wdf_detail
+
+/**
+ * A single diode, using the Shockley diode model:
+ * i = Is * (exp(v / Vt) - 1)
+ *
+ * Here Vt is the thermal voltage, multiplied by the diode's ideality factor
+ * (and by the number of diodes, when modelling several diodes in series).
+ *
+ * Since the port resistance usually changes much less often than the
+ * incident wave, the constants that depend on it are computed in
+ * prepare(), so that reflected() is just one Wright-Omega evaluation.
+ */
+template <typename T = float, typename OmegaProvider = WrightOmegaProvider<>>
+class wdf_diode
+{
+public:
+    wdf_diode() = default;
+    wdf_diode (T port_resistance, T saturation_current, T thermal_voltage)
+    {
+        prepare (port_resistance, saturation_current, thermal_voltage);
+    }
+
+    /** Sets the port resistance, and diode parameters */
+    void prepare (T port_resistance, T saturation_current, T thermal_voltage)
+    {
+        using S = scalar_of_t<T>;
+        vt = thermal_voltage;
+        one_over_vt = (S) 1 / thermal_voltage;
+        r_is = port_resistance * saturation_current;
+        r_is_over_vt = r_is * one_over_vt;
+        log_r_is_over_vt = wdf_detail::log (r_is_over_vt);
+    }
+
+    /** Computes the reflected wave for a given incident wave */
+    T reflected (T a) const
+    {
+        using S = scalar_of_t<T>;
+        return a + (S) 2 * (r_is - vt * OmegaProvider::omega (log_r_is_over_vt + a * one_over_vt + r_is_over_vt));
+    }
+
+    /** Computes the reflected waves for a block of incident waves */
+    void reflected (const T* a, T* b, size_t N) const
+    {
+        for (size_t n = 0; n < N; ++n)
+            b[n] = reflected (a[n]);
+    }
+
+private:
+    T vt {};
+    T one_over_vt {};
+    T r_is {};
+    T r_is_over_vt {};
+    T log_r_is_over_vt {};
+};
+
+/** Approximations available for the anti-parallel diode pair */
+enum class diode_pair_quality
+{
+    good, // Werner et al., eq. 18: one Wright-Omega evaluation, assumes only one diode conducts
+    best, // Werner et al., eq. 39: two Wright-Omega evaluations, accounts for the other diode's current
+};
+
+/**
+ * A pair of anti-parallel diodes (see wdf_diode for the diode model).
+ *
+ * The diode pair is odd-symmetric, so the reflected wave is computed
+ * for |a|, and then given the sign of a, without branching.
+ */
+template <typename T = float, diode_pair_quality quality = diode_pair_quality::best, typename OmegaProvider = WrightOmegaProvider<>>
+class wdf_diode_pair
+{
+public:
+    wdf_diode_pair() = default;
+    wdf_diode_pair (T port_resistance, T saturation_current, T thermal_voltage)
+    {
+        prepare (port_resistance, saturation_current, thermal_voltage);
+    }
+
+    /** Sets the port resistance, and diode parameters */
+    void prepare (T port_resistance, T saturation_current, T thermal_voltage)
+    {
+        using S = scalar_of_t<T>;
+        vt = thermal_voltage;
+        one_over_vt = (S) 1 / thermal_voltage;
+        r_is = port_resistance * saturation_current;
+        r_is_over_vt = r_is * one_over_vt;
+        log_r_is_over_vt = wdf_detail::log (r_is_over_vt);
+    }
+
+    /** Computes the reflected wave for a given incident wave */
+    T reflected (T a) const
+    {
+        using S = scalar_of_t<T>;
+        const auto abs_a_over_vt = wdf_detail::abs (a) * one_over_vt;
+        if constexpr (quality == diode_pair_quality::good)
+        {
+            const auto omega_1 = OmegaProvider::omega (log_r_is_over_vt + abs_a_over_vt + r_is_over_vt);
+            return a + wdf_detail::copysign ((S) 2 * (r_is - vt * omega_1), a);
+        }
+        else
+        {
+            const auto omega_1 = OmegaProvider::omega (log_r_is_over_vt + abs_a_over_vt);
+            const auto omega_2 = OmegaProvider::omega (log_r_is_over_vt - abs_a_over_vt);
+            return a - wdf_detail::copysign ((S) 2 * vt * (omega_1 - omega_2), a);
+        }
+    }
+
+    /** Computes the reflected waves for a block of incident waves */
+    void reflected (const T* a, T* b, size_t N) const
+    {
+        for (size_t n = 0; n < N; ++n)
+            b[n] = reflected (a[n]);
+    }
+
+private:
+    T vt {};
+    T one_over_vt {};
+    T r_is {};
+    T r_is_over_vt {};
+    T log_r_is_over_vt {};
+};
+
+/**
+ * The classic diode clipper: a resistive voltage source (R) driving a
+ * capacitor (C) in parallel with an anti-parallel diode pair, which is
+ * the root of the WDF tree. The output is the voltage across the capacitor.
+ *
+ * The whole tree (capacitor, parallel adaptor, and diode pair) is
+ * collapsed into a few multiply-adds around the diode pair's
+ * reflected wave, so each sample only needs the diode pair's
+ * Wright-Omega evaluation(s), plus a handful of arithmetic ops.
+ *
+ * Until prepare() is called, the clipper is set up for a 48 kHz sample
+ * rate, with R = 2.2 kOhm, C = 10 nF, and a pair of 1N4148 diodes.
+ */
+template <typename T = float, diode_pair_quality quality = diode_pair_quality::best, typename OmegaProvider = WrightOmegaProvider<>>
+class wdf_diode_clipper
+{
+public:
+    wdf_diode_clipper()
+    {
+        using S = scalar_of_t<T>;
+        prepare (T { (S) 48000 }, T { (S) 2200 }, T { (S) 10.0e-9 }, T { (S) 2.52e-9 }, T { (S) 45.2892e-3 });
+    }
+
+    /**
+     * Prepares the clipper for a given sample rate, resistance, capacitance, and diode parameters.
+     * The capacitor is discretized with the bilinear transform.
+     */
+    void prepare (T sample_rate, T resistance, T capacitance, T saturation_current, T thermal_voltage)
+    {
+        using S = scalar_of_t<T>;
+        const auto capacitor_conductance = (S) 2 * sample_rate * capacitance;
+        const auto source_conductance = (S) 1 / resistance;
+        const auto parallel_conductance = capacitor_conductance + source_conductance;
+
+        source_coeff = source_conductance / parallel_conductance;
+        diodes.prepare ((S) 1 / parallel_conductance, saturation_current, thermal_voltage);
+    }
+
+    /** Resets the capacitor state */
+    void reset()
+    {
+        z = T ((scalar_of_t<T>) 0);
+    }
+
+    /** Processes a single sample, returning the output voltage */
+    T process (T x)
+    {
+        using S = scalar_of_t<T>;
+
+        // parallel adaptor, reflecting up towards the root
+        const auto b_up = z + source_coeff * (x - z);
+
+        // diode pair at the root
+        const auto b_root = diodes.reflected (b_up);
+
+        // parallel adaptor, reflecting down to the capacitor
+        const auto two_v = b_up + b_root;
+        z = two_v - z;
+        return (S) 0.5 * two_v;
+    }
+
+    /** Processes a block of samples in-place */
+    void process_block (T* data, size_t N)
+    {
+        for (size_t n = 0; n < N; ++n)
+            data[n] = process (data[n]);
+    }
+
+private:
+    wdf_diode_pair<T, quality, OmegaProvider> diodes;
+    T source_coeff {};
+    T z = T ((scalar_of_t<T>) 0);
+};
+} // namespace math_approx
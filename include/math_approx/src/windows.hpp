@@ -0,0 +1,177 @@
+#pragma once
+
+#include "bulk_approx.hpp"
+#include "trig_approx.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace math_approx
+{
+/**
+ * The symmetry of a window function:
+ *
+ * symmetric: w[n] = w[N - 1 - n], for filter design (e.g. scipy.signal.get_window(..., fftbins=False))
+ * periodic: w[n] = w[N - n], for spectral analysis (i.e. a symmetric window of length N + 1, without the last point)
+ */
+enum class window_symmetry
+{
+    symmetric,
+    periodic,
+};
+
+namespace window_detail
+{
+    /** Returns (n + i) for each lane i, as type V */
+    template <typename V>
+    V indices (size_t n)
+    {
+        if constexpr (std::is_arithmetic_v<V>)
+        {
+            return (V) n;
+        }
+#if defined(XSIMD_HPP)
+        else
+        {
+            using S = scalar_of_t<V>;
+            alignas (V::arch_type::alignment()) S lanes[V::size];
+            for (size_t i = 0; i < V::size; ++i)
+                lanes[i] = (S) (n + i);
+            return V::load_aligned (lanes);
+        }
+#endif
+    }
+
+    /**
+     * Computes the first half of a window with func (x), where x = n / D is in turns
+     * (and in the range [0, 1/2]), and then mirrors it into the second half.
+     */
+    template <typename T, typename Func>
+    void generate (T* w, size_t N, window_symmetry symmetry, Func&& func)
+    {
+        using namespace bulk_detail;
+        if (N == 0)
+            return;
+        if (N == 1)
+        {
+            w[0] = (T) 1;
+            return;
+        }
+
+        const auto is_symmetric = symmetry == window_symmetry::symmetric;
+        const auto one_over_D = (T) 1 / (T) (is_symmetric ? N - 1 : N);
+        const auto half_length = is_symmetric ? (N + 1) / 2 : N / 2 + 1;
+        for_each_chunk<T> (half_length,
+                           [&] (size_t n, auto tag)
+                           {
+                               using V = typename decltype (tag)::type;
+                               store (w + n, func (indices<V> (n) * one_over_D));
+                           });
+
+        if (is_symmetric)
+            std::reverse_copy (w, w + N / 2, w + half_length);
+        else
+            std::reverse_copy (w + 1, w + (N + 1) / 2, w + half_length);
+    }
+
+    /**
+     * Evaluates sum_k (-1)^k a_k cos(2 pi k x), with cos(2 pi x) from cos_turns_mhalfpi_halfpi<order>,
+     * and the higher harmonics from the Chebyshev recurrence, cos((k + 1) t) = 2 cos(t) cos(k t) - cos((k - 1) t).
+     */
+    template <int order, typename V, typename S, size_t K>
+    V cosine_sum (V x, const std::array<S, K>& a)
+    {
+        static_assert (K >= 2);
+        const auto c_1 = cos_turns_mhalfpi_halfpi<order> (x);
+        const auto two_c_1 = c_1 + c_1;
+
+        auto c_km1 = V ((S) 1);
+        auto c_k = c_1;
+        auto y = a[0] - a[1] * c_1;
+        for (size_t k = 2; k < K; ++k)
+        {
+            const auto c_kp1 = two_c_1 * c_k - c_km1;
+            c_km1 = c_k;
+            c_k = c_kp1;
+            y += (k % 2 == 0 ? a[k] : -a[k]) * c_k;
+        }
+        return y;
+    }
+} // namespace window_detail
+
+/**
+ * Generates a generalized cosine-sum window, w[n] = sum_k (-1)^k a_k cos(2 pi k n / D),
+ * where D = N - 1 for symmetric windows, or N for periodic windows.
+ *
+ * Only the first half of the window is computed (with one cos_turns() approximation
+ * per point, plus the Chebyshev recurrence for the higher harmonics), and the
+ * second half is mirrored from it.
+ */
+template <int order = 9, typename T, size_t K>
+void cosine_sum_window (T* w, size_t N, const std::array<T, K>& coefficients, window_symmetry symmetry = window_symmetry::symmetric)
+{
+    window_detail::generate (w, N, symmetry, [&coefficients] (auto x)
+                             { return window_detail::cosine_sum<order> (x, coefficients); });
+}
+
+/** Generates a Hann window (see cosine_sum_window()). Max error: ~2e-7 (order 9), ~8e-6 (order 7), ~4e-4 (order 5) */
+template <int order = 9, typename T>
+void hann_window (T* w, size_t N, window_symmetry symmetry = window_symmetry::symmetric)
+{
+    cosine_sum_window<order> (w, N, std::array<T, 2> { (T) 0.5, (T) 0.5 }, symmetry);
+}
+
+/** Generates a Hamming window (see cosine_sum_window()). Max error: ~2e-7 (order 9), ~8e-6 (order 7), ~4e-4 (order 5) */
+template <int order = 9, typename T>
+void hamming_window (T* w, size_t N, window_symmetry symmetry = window_symmetry::symmetric)
+{
+    cosine_sum_window<order> (w, N, std::array<T, 2> { (T) 0.54, (T) 0.46 }, symmetry);
+}
+
+/** Generates a Blackman window (see cosine_sum_window()). Max error: ~3e-7 (order 9), ~1.3e-5 (order 7), ~6e-4 (order 5) */
+template <int order = 9, typename T>
+void blackman_window (T* w, size_t N, window_symmetry symmetry = window_symmetry::symmetric)
+{
+    cosine_sum_window<order> (w, N, std::array<T, 3> { (T) 0.42, (T) 0.5, (T) 0.08 }, symmetry);
+}
+
+/** Generates a 4-term Blackman-Harris window (see cosine_sum_window()). Max error: ~4e-7 (order 9), ~1.8e-5 (order 7), ~9e-4 (order 5) */
+template <int order = 9, typename T>
+void blackman_harris_window (T* w, size_t N, window_symmetry symmetry = window_symmetry::symmetric)
+{
+    cosine_sum_window<order> (w, N, std::array<T, 4> { (T) 0.35875, (T) 0.48829, (T) 0.14128, (T) 0.01168 }, symmetry);
+}
+
+/** Generates a flat-top window (see cosine_sum_window()). Max error: ~8e-7 (order 9), ~3.5e-5 (order 7), ~1.8e-3 (order 5) */
+template <int order = 9, typename T>
+void flat_top_window (T* w, size_t N, window_symmetry symmetry = window_symmetry::symmetric)
+{
+    cosine_sum_window<order> (w, N, std::array<T, 5> { (T) 0.21557895, (T) 0.41663158, (T) 0.277263158, (T) 0.083578947, (T) 0.006947368 }, symmetry);
+}
+
+/**
+ * Generates a Tukey (tapered cosine) window, where alpha (in [0, 1]) is the fraction
+ * of the window inside the cosine tapers: alpha = 0 gives a rectangular window,
+ * and alpha = 1 gives a Hann window. Max error: ~2e-7 (order 9), ~8e-6 (order 7), ~4e-4 (order 5).
+ */
+template <int order = 9, typename T>
+void tukey_window (T* w, size_t N, T alpha, window_symmetry symmetry = window_symmetry::symmetric)
+{
+    if (alpha <= (T) 0)
+    {
+        std::fill (w, w + N, (T) 1);
+        return;
+    }
+
+    const auto one_over_alpha = (T) 1 / std::min (alpha, (T) 1);
+    window_detail::generate (w, N, symmetry, [one_over_alpha] (auto x)
+                             {
+                                 using V = decltype (x);
+                                 // within the taper, x / alpha is in [0, 1/2]
+                                 const auto x_taper = x * one_over_alpha;
+                                 const auto in_taper = x_taper < (T) 0.5;
+                                 const auto taper = (T) 0.5 - (T) 0.5 * cos_turns_mhalfpi_halfpi<order> (select (in_taper, x_taper, V ((T) 0.5)));
+                                 return select (in_taper, taper, V ((T) 1));
+                             });
+}
+} // namespace math_approx
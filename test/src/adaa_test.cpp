@@ -0,0 +1,235 @@
+#include "test_helpers.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+
+#include <math_approx/math_approx.hpp>
+
+#include "reference/polylogarithm.hpp"
+
+namespace
+{
+// Exact (double-precision) nonlinearities and antiderivatives
+struct tanh_exact
+{
+    static double func (double x) { return std::tanh (x); }
+    static double ad1 (double x) { return std::abs (x) + std::log1p (std::exp (-2.0 * std::abs (x))) - M_LN2; }
+    static double ad2 (double x)
+    {
+        const auto a = std::abs (x);
+        const auto y = 0.5 * a * a - a * M_LN2 + 0.5 * polylogarithm::Li2 (-std::exp (-2.0 * a)) + M_PI * M_PI / 24.0;
+        return x < 0.0 ? -y : y;
+    }
+};
+
+struct sigmoid_exact
+{
+    static double func (double x) { return 1.0 / (1.0 + std::exp (-x)); }
+    static double ad1 (double x) { return std::log1p (std::exp (x)); }
+    static double ad2 (double x) { return -polylogarithm::Li2 (-std::exp (x)) - M_PI * M_PI / 12.0; }
+};
+
+std::vector<float> make_test_signal (size_t N, float gain)
+{
+    std::vector<float> x (N);
+    for (size_t n = 0; n < N; ++n)
+        x[n] = gain * std::sin (2.0f * (float) M_PI * 0.0123f * (float) n) + 0.3f * std::sin (2.0f * (float) M_PI * 0.271f * (float) n);
+    return x;
+}
+
+/** The limit of second-order ADAA as x[n] -> x[n-2] (x_bar = (x[n] + x[n-2]) / 2) */
+template <typename Shaper>
+double second_order_fallback (double x_bar, double x1, double tolerance)
+{
+    const auto delta = x_bar - x1;
+    if (std::abs (delta) < tolerance)
+        return Shaper::func (x_bar);
+    return 2.0 * (Shaper::ad1 (x_bar) * delta - (Shaper::ad2 (x_bar) - Shaper::ad2 (x1))) / (delta * delta);
+}
+
+template <int adaa_order, typename Shaper>
+std::vector<double> adaa_reference (const std::vector<float>& x, double tolerance)
+{
+    std::vector<double> y (x.size());
+    double x1 = 0.0, x2 = 0.0;
+    double d2 = Shaper::ad1 (0.0);
+    for (size_t n = 0; n < x.size(); ++n)
+    {
+        const auto x0 = (double) x[n];
+        if constexpr (adaa_order == 1)
+        {
+            y[n] = std::abs (x0 - x1) < tolerance ? Shaper::func (0.5 * (x0 + x1)) : (Shaper::ad1 (x0) - Shaper::ad1 (x1)) / (x0 - x1);
+        }
+        else
+        {
+            const auto d1 = std::abs (x0 - x1) < tolerance ? Shaper::ad1 (0.5 * (x0 + x1)) : (Shaper::ad2 (x0) - Shaper::ad2 (x1)) / (x0 - x1);
+            y[n] = std::abs (x0 - x2) < tolerance ? second_order_fallback<Shaper> (0.5 * (x0 + x2), x1, tolerance) : 2.0 * (d1 - d2) / (x0 - x2);
+            d2 = d1;
+        }
+        x2 = x1;
+        x1 = x0;
+    }
+    return y;
+}
+
+template <typename ADAA>
+float max_adaa_error (const std::vector<float>& x, const std::vector<double>& y_exact)
+{
+    ADAA adaa {};
+    auto y = x;
+    adaa.process_block (y.data(), y.size());
+
+    float max_error = 0.0f;
+    for (size_t n = 0; n < x.size(); ++n)
+        max_error = std::max (max_error, (float) std::abs (y_exact[n] - (double) y[n]));
+    return max_error;
+}
+} // namespace
+
+TEST_CASE ("ADAA Antiderivatives Test")
+{
+    // checks that each antiderivative is consistent with the one before it
+    const auto check_derivative = [] (auto&& F, auto&& f, float err_bound)
+    {
+        static constexpr double h = 1.0e-3;
+        for (double x = -8.0; x <= 8.0; x += 0.0625)
+        {
+            const auto dF = ((double) F ((float) (x + h)) - (double) F ((float) (x - h))) / (2.0 * h);
+            REQUIRE (std::abs (dF - (double) f ((float) x)) < err_bound);
+        }
+    };
+
+    using tanh_shaper = math_approx::adaa_tanh<>;
+    using sigmoid_shaper = math_approx::adaa_sigmoid<>;
+    check_derivative ([] (auto x)
+                      { return tanh_shaper::ad1 (x); },
+                      [] (auto x)
+                      { return tanh_shaper::func (x); },
+                      5.0e-3f);
+    check_derivative ([] (auto x)
+                      { return tanh_shaper::ad2 (x); },
+                      [] (auto x)
+                      { return tanh_shaper::ad1 (x); },
+                      5.0e-3f);
+    check_derivative ([] (auto x)
+                      { return sigmoid_shaper::ad1 (x); },
+                      [] (auto x)
+                      { return sigmoid_shaper::func (x); },
+                      5.0e-3f);
+    check_derivative ([] (auto x)
+                      { return sigmoid_shaper::ad2 (x); },
+                      [] (auto x)
+                      { return sigmoid_shaper::ad1 (x); },
+                      5.0e-3f);
+    check_derivative ([] (auto x)
+                      { return math_approx::adaa_hard_clip::ad1 (x); },
+                      [] (auto x)
+                      { return math_approx::adaa_hard_clip::func (x); },
+                      2.0e-3f);
+    check_derivative ([] (auto x)
+                      { return math_approx::adaa_hard_clip::ad2 (x); },
+                      [] (auto x)
+                      { return math_approx::adaa_hard_clip::ad1 (x); },
+                      2.0e-3f);
+    check_derivative ([] (auto x)
+                      { return math_approx::adaa_soft_clip::ad1 (x); },
+                      [] (auto x)
+                      { return math_approx::adaa_soft_clip::func (x); },
+                      2.0e-3f);
+    check_derivative ([] (auto x)
+                      { return math_approx::adaa_soft_clip::ad2 (x); },
+                      [] (auto x)
+                      { return math_approx::adaa_soft_clip::ad1 (x); },
+                      2.0e-3f);
+}
+
+TEST_CASE ("ADAA Tanh Test")
+{
+    const auto x = make_test_signal (2048, 4.0f);
+
+    SECTION ("First Order")
+    {
+        const auto error = max_adaa_error<math_approx::first_order_adaa<math_approx::adaa_tanh<>>> (x, adaa_reference<1, tanh_exact> (x, 1.0e-3));
+        std::cout << error << std::endl;
+        REQUIRE (error < 5.0e-4f);
+    }
+    SECTION ("Second Order")
+    {
+        const auto error = max_adaa_error<math_approx::second_order_adaa<math_approx::adaa_tanh<>>> (x, adaa_reference<2, tanh_exact> (x, 1.0e-3));
+        std::cout << error << std::endl;
+        REQUIRE (error < 5.0e-3f);
+    }
+}
+
+TEST_CASE ("ADAA Sigmoid Test")
+{
+    const auto x = make_test_signal (2048, 6.0f);
+
+    SECTION ("First Order")
+    {
+        const auto error = max_adaa_error<math_approx::first_order_adaa<math_approx::adaa_sigmoid<>>> (x, adaa_reference<1, sigmoid_exact> (x, 1.0e-3));
+        std::cout << error << std::endl;
+        REQUIRE (error < 5.0e-4f);
+    }
+    SECTION ("Second Order")
+    {
+        const auto error = max_adaa_error<math_approx::second_order_adaa<math_approx::adaa_sigmoid<>>> (x, adaa_reference<2, sigmoid_exact> (x, 1.0e-3));
+        std::cout << error << std::endl;
+        REQUIRE (error < 2.0e-3f);
+    }
+}
+
+TEST_CASE ("ADAA Clipper Test")
+{
+    const auto x = make_test_signal (2048, 2.0f);
+
+    SECTION ("Hard Clip")
+    {
+        const auto error = max_adaa_error<math_approx::second_order_adaa<math_approx::adaa_hard_clip>> (x, adaa_reference<2, math_approx::adaa_hard_clip> (x, 1.0e-3));
+        std::cout << error << std::endl;
+        REQUIRE (error < 5.0e-3f);
+    }
+    SECTION ("Soft Clip")
+    {
+        const auto error = max_adaa_error<math_approx::first_order_adaa<math_approx::adaa_soft_clip>> (x, adaa_reference<1, math_approx::adaa_soft_clip> (x, 1.0e-3));
+        std::cout << error << std::endl;
+        REQUIRE (error < 1.0e-4f);
+    }
+}
+
+TEST_CASE ("ADAA Second Order Fallback Test")
+{
+    // x[n] == x[n-2], with x[n-1] far from both (e.g. near Nyquist)
+    SECTION ("Tanh")
+    {
+        math_approx::second_order_adaa<math_approx::adaa_tanh<>> adaa {};
+        adaa.reset (1.0f);
+        adaa.process (-1.0f);
+        const auto y = adaa.process (1.0f);
+        const auto y_exact = second_order_fallback<tanh_exact> (1.0, -1.0, 1.0e-3);
+        std::cout << y << ", " << y_exact << std::endl;
+        REQUIRE (std::abs (y_exact - 0.28) < 0.01);
+        REQUIRE (std::abs ((double) y - y_exact) < 2.0e-3);
+    }
+
+    SECTION ("Hard Clip")
+    {
+        // x[n] is close to (but not exactly) x[n-2]
+        math_approx::second_order_adaa<math_approx::adaa_hard_clip> adaa {};
+        adaa.reset (0.5f);
+        adaa.process (-2.0f);
+        const auto y = adaa.process (0.5002f);
+        const auto y_exact = second_order_fallback<math_approx::adaa_hard_clip> (0.5001, -2.0, 1.0e-3);
+        REQUIRE (std::abs ((double) y - y_exact) < 1.0e-3);
+        REQUIRE (std::abs ((double) y - 0.5) > 0.1);
+    }
+
+    SECTION ("Nyquist")
+    {
+        std::vector<float> x (256);
+        for (size_t n = 0; n < x.size(); ++n)
+            x[n] = (n % 2 == 0 ? 1.5f : -1.5f) + 0.02f * std::sin (0.01f * (float) n);
+        const auto error = max_adaa_error<math_approx::second_order_adaa<math_approx::adaa_tanh<>>> (x, adaa_reference<2, tanh_exact> (x, 1.0e-3));
+        std::cout << error << std::endl;
+        REQUIRE (error < 5.0e-3f);
+    }
+}
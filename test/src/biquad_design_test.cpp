@@ -0,0 +1,131 @@
+#include "test_helpers.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+
+#include <math_approx/math_approx.hpp>
+
+namespace
+{
+using math_approx::biquad_type;
+
+/** The RBJ cookbook formulas, as written (in double-precision) */
+math_approx::biquad_coefficients<double> rbj_reference (biquad_type type, double fc, double q, double gain_db, double fs)
+{
+    const auto w0 = 2.0 * M_PI * fc / fs;
+    const auto cos_w0 = std::cos (w0);
+    const auto alpha = std::sin (w0) / (2.0 * q);
+    const auto A = std::pow (10.0, gain_db / 40.0);
+    const auto two_sqrt_A_alpha = 2.0 * std::sqrt (A) * alpha;
+
+    double b0 {}, b1 {}, b2 {}, a0 {}, a1 {}, a2 {};
+    switch (type)
+    {
+        case biquad_type::lowpass:
+            b0 = (1.0 - cos_w0) / 2.0, b1 = 1.0 - cos_w0, b2 = b0;
+            a0 = 1.0 + alpha, a1 = -2.0 * cos_w0, a2 = 1.0 - alpha;
+            break;
+        case biquad_type::highpass:
+            b0 = (1.0 + cos_w0) / 2.0, b1 = -(1.0 + cos_w0), b2 = b0;
+            a0 = 1.0 + alpha, a1 = -2.0 * cos_w0, a2 = 1.0 - alpha;
+            break;
+        case biquad_type::bandpass:
+            b0 = alpha, b1 = 0.0, b2 = -alpha;
+            a0 = 1.0 + alpha, a1 = -2.0 * cos_w0, a2 = 1.0 - alpha;
+            break;
+        case biquad_type::notch:
+            b0 = 1.0, b1 = -2.0 * cos_w0, b2 = 1.0;
+            a0 = 1.0 + alpha, a1 = -2.0 * cos_w0, a2 = 1.0 - alpha;
+            break;
+        case biquad_type::allpass:
+            b0 = 1.0 - alpha, b1 = -2.0 * cos_w0, b2 = 1.0 + alpha;
+            a0 = 1.0 + alpha, a1 = -2.0 * cos_w0, a2 = 1.0 - alpha;
+            break;
+        case biquad_type::peak:
+            b0 = 1.0 + alpha * A, b1 = -2.0 * cos_w0, b2 = 1.0 - alpha * A;
+            a0 = 1.0 + alpha / A, a1 = -2.0 * cos_w0, a2 = 1.0 - alpha / A;
+            break;
+        case biquad_type::low_shelf:
+            b0 = A * ((A + 1.0) - (A - 1.0) * cos_w0 + two_sqrt_A_alpha);
+            b1 = 2.0 * A * ((A - 1.0) - (A + 1.0) * cos_w0);
+            b2 = A * ((A + 1.0) - (A - 1.0) * cos_w0 - two_sqrt_A_alpha);
+            a0 = (A + 1.0) + (A - 1.0) * cos_w0 + two_sqrt_A_alpha;
+            a1 = -2.0 * ((A - 1.0) + (A + 1.0) * cos_w0);
+            a2 = (A + 1.0) + (A - 1.0) * cos_w0 - two_sqrt_A_alpha;
+            break;
+        case biquad_type::high_shelf:
+            b0 = A * ((A + 1.0) + (A - 1.0) * cos_w0 + two_sqrt_A_alpha);
+            b1 = -2.0 * A * ((A - 1.0) + (A + 1.0) * cos_w0);
+            b2 = A * ((A + 1.0) + (A - 1.0) * cos_w0 - two_sqrt_A_alpha);
+            a0 = (A + 1.0) - (A - 1.0) * cos_w0 + two_sqrt_A_alpha;
+            a1 = 2.0 * ((A - 1.0) - (A + 1.0) * cos_w0);
+            a2 = (A + 1.0) - (A - 1.0) * cos_w0 - two_sqrt_A_alpha;
+            break;
+    }
+    return { b0 / a0, b1 / a0, b2 / a0, a1 / a0, a2 / a0 };
+}
+
+template <biquad_type type>
+void test_biquad_design (float tolerance)
+{
+    static constexpr size_t N = 103;
+    static constexpr float fs = 48000.0f;
+
+    std::vector<float> freq (N), q (N), gain (N);
+    for (size_t i = 0; i < N; ++i)
+    {
+        // log-spaced from 20 Hz to 20 kHz
+        freq[i] = 20.0f * std::pow (1000.0f, (float) i / (float) (N - 1));
+        q[i] = 0.3f + 0.1f * (float) (i % 50);
+        gain[i] = -24.0f + 48.0f * (float) ((i * 7) % N) / (float) N;
+    }
+
+    std::vector<float> b0 (N), b1 (N), b2 (N), a1 (N), a2 (N);
+    math_approx::design_biquads<type> ({ b0.data(), b1.data(), b2.data(), a1.data(), a2.data() }, freq.data(), q.data(), gain.data(), N, fs);
+
+    float max_error = 0.0f;
+    for (size_t i = 0; i < N; ++i)
+    {
+        const auto ref = rbj_reference (type, (double) freq[i], (double) q[i], (double) gain[i], (double) fs);
+        for (auto [actual, expected] : { std::pair { b0[i], ref.b0 }, { b1[i], ref.b1 }, { b2[i], ref.b2 }, { a1[i], ref.a1 }, { a2[i], ref.a2 } })
+            max_error = std::max (max_error, (float) (std::abs ((double) actual - expected) / std::max (1.0, std::abs (expected))));
+    }
+    std::cout << max_error << std::endl;
+    REQUIRE (max_error < tolerance);
+}
+} // namespace
+
+TEST_CASE ("Biquad Design Test")
+{
+    SECTION ("Lowpass")
+    {
+        test_biquad_design<biquad_type::lowpass> (5.0e-5f);
+    }
+    SECTION ("Highpass")
+    {
+        test_biquad_design<biquad_type::highpass> (5.0e-5f);
+    }
+    SECTION ("Bandpass")
+    {
+        test_biquad_design<biquad_type::bandpass> (5.0e-5f);
+    }
+    SECTION ("Notch")
+    {
+        test_biquad_design<biquad_type::notch> (5.0e-5f);
+    }
+    SECTION ("Allpass")
+    {
+        test_biquad_design<biquad_type::allpass> (5.0e-5f);
+    }
+    SECTION ("Peak")
+    {
+        test_biquad_design<biquad_type::peak> (5.0e-5f);
+    }
+    SECTION ("Low Shelf")
+    {
+        test_biquad_design<biquad_type::low_shelf> (5.0e-5f);
+    }
+    SECTION ("High Shelf")
+    {
+        test_biquad_design<biquad_type::high_shelf> (5.0e-5f);
+    }
+}
@@ -0,0 +1,158 @@
+#include "test_helpers.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+
+#include <math_approx/math_approx.hpp>
+
+namespace
+{
+constexpr size_t N = 1003; // not a multiple of any SIMD width, so that the scalar tail gets tested
+
+std::vector<float> make_data()
+{
+    std::vector<float> x (N);
+    for (size_t i = 0; i < N; ++i)
+        x[i] = -5.0f + 10.0f * (float) i / (float) N;
+    return x;
+}
+} // namespace
+
+TEST_CASE ("Bulk Float Test")
+{
+    const auto x = make_data();
+    std::vector<float> y (N);
+
+    math_approx::process_bulk (x.data(), y.data(), N, [] (auto v)
+                               { return math_approx::tanh<7> (v); });
+
+    for (size_t i = 0; i < N; ++i)
+        REQUIRE (std::abs (y[i] - math_approx::tanh<7> (x[i])) < 1.0e-6f);
+}
+
+TEST_CASE ("Bulk Double Test")
+{
+    const auto x_float = make_data();
+    std::vector<double> x (x_float.begin(), x_float.end());
+    std::vector<double> y (N);
+
+    math_approx::process_bulk (x.data(), y.data(), N, [] (auto v)
+                               { return math_approx::sigmoid_exp<6> (v); });
+
+    for (size_t i = 0; i < N; ++i)
+        REQUIRE (std::abs (y[i] - 1.0 / (1.0 + std::exp (-x[i]))) < 1.0e-6);
+}
+
+TEST_CASE ("BFloat16 Test")
+{
+    SECTION ("Conversions")
+    {
+        for (const auto x : { 0.0f, -0.0f, 1.0f, -2.5f, 65504.0f, 1.0e-30f, 3.0e38f })
+        {
+            const auto y = math_approx::to_float (math_approx::to_bfloat16 (x));
+            REQUIRE (std::abs (y - x) <= std::abs (x) * (1.0f / 256.0f));
+        }
+
+        // round-to-nearest-even
+        REQUIRE (math_approx::to_bfloat16 (math_approx::bit_cast<float> (0x3f808000u)).bits == 0x3f80);
+        REQUIRE (math_approx::to_bfloat16 (math_approx::bit_cast<float> (0x3f818000u)).bits == 0x3f82);
+        REQUIRE (math_approx::to_bfloat16 (math_approx::bit_cast<float> (0x3f808001u)).bits == 0x3f81);
+
+        REQUIRE (std::isinf (math_approx::to_float (math_approx::to_bfloat16 (INFINITY))));
+        REQUIRE (std::isnan (math_approx::to_float (math_approx::to_bfloat16 (NAN))));
+    }
+
+    SECTION ("Bulk")
+    {
+        const auto x_float = make_data();
+        std::vector<math_approx::bfloat16> x (N);
+        for (size_t i = 0; i < N; ++i)
+            x[i] = math_approx::to_bfloat16 (x_float[i]);
+
+        std::vector<math_approx::bfloat16> y (N);
+        math_approx::process_bulk (x.data(), y.data(), N, [] (auto v)
+                                   { return math_approx::sigmoid<9> (v); });
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            const auto expected = math_approx::to_bfloat16 (math_approx::sigmoid<9> (math_approx::to_float (x[i])));
+            REQUIRE (y[i].bits == expected.bits);
+        }
+    }
+}
+
+TEST_CASE ("Float16 Test")
+{
+    SECTION ("Conversions")
+    {
+        for (uint32_t bits = 0; bits < (1 << 16); ++bits)
+        {
+            const auto h = math_approx::half_detail::float16_from_bits ((uint16_t) bits);
+            const auto f = math_approx::to_float (h);
+            if (std::isnan (f))
+                continue;
+            REQUIRE (math_approx::half_detail::float16_to_bits (math_approx::to_float16 (f)) == bits);
+        }
+
+        REQUIRE (math_approx::to_float (math_approx::to_float16 (1.0f)) == 1.0f);
+        REQUIRE (math_approx::to_float (math_approx::to_float16 (65504.0f)) == 65504.0f);
+        REQUIRE (std::isinf (math_approx::to_float (math_approx::to_float16 (1.0e6f))));
+        REQUIRE (math_approx::to_float (math_approx::to_float16 (1.0e-9f)) == 0.0f);
+        REQUIRE (math_approx::to_float (math_approx::to_float16 (1.0f + 1.0f / 2048.0f)) == 1.0f); // ties to even
+    }
+
+    SECTION ("Bulk")
+    {
+        const auto x_float = make_data();
+        std::vector<math_approx::float16> x (N);
+        for (size_t i = 0; i < N; ++i)
+            x[i] = math_approx::to_float16 (x_float[i]);
+
+        std::vector<math_approx::float16> y (N);
+        math_approx::process_bulk (x.data(), y.data(), N, [] (auto v)
+                                   { return math_approx::exp<5> (v); });
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            const auto expected = math_approx::to_float16 (math_approx::exp<5> (math_approx::to_float (x[i])));
+            REQUIRE (math_approx::half_detail::float16_to_bits (y[i]) == math_approx::half_detail::float16_to_bits (expected));
+        }
+    }
+}
+
+TEST_CASE ("Bulk Mixed Precision Test")
+{
+    const auto x_float = make_data();
+    std::vector<double> x (N);
+    for (size_t i = 0; i < N; ++i)
+        x[i] = (double) x_float[i] + 1.0e-9; // not exactly representable as float
+
+    SECTION ("Matches float")
+    {
+        std::vector<double> y (N);
+        math_approx::process_bulk_mixed_precision (x.data(), y.data(), N, [] (auto v)
+                                                   { return math_approx::exp<5> (v); });
+
+        for (size_t i = 0; i < N; ++i)
+            REQUIRE (y[i] == (double) math_approx::exp<5> ((float) x[i]));
+    }
+
+    SECTION ("Accuracy")
+    {
+        std::vector<double> y (N);
+        math_approx::process_bulk_mixed_precision (x.data(), y.data(), N, [] (auto v)
+                                                   { return math_approx::tanh<11> (v); });
+
+        for (size_t i = 0; i < N; ++i)
+            REQUIRE (std::abs (y[i] - std::tanh (x[i])) < 1.0e-6);
+    }
+
+    SECTION ("In-place")
+    {
+        auto y = x;
+        math_approx::process_bulk_mixed_precision (y.data(), y.data(), N, [] (auto v)
+                                                   { return math_approx::log<6> (v + 6.0f); });
+
+        for (size_t i = 0; i < N; ++i)
+            REQUIRE (std::abs (y[i] - std::log (x[i] + 6.0)) < 4.0e-6);
+    }
+}
@@ -0,0 +1,261 @@
+#include "test_helpers.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+
+#include <math_approx/math_approx.hpp>
+
+namespace
+{
+// Reference G.711 implementation, following the ITU-T/Sun g711.c
+namespace g711_reference
+{
+    int search (int val, const int* table, int size)
+    {
+        for (int i = 0; i < size; ++i)
+            if (val <= table[i])
+                return i;
+        return size;
+    }
+
+    uint8_t linear_to_ulaw (int16_t pcm_val)
+    {
+        static constexpr int seg_uend[8] = { 0x3F, 0x7F, 0xFF, 0x1FF, 0x3FF, 0x7FF, 0xFFF, 0x1FFF };
+        int pcm = pcm_val >> 2;
+        int mask;
+        if (pcm < 0)
+        {
+            pcm = -pcm;
+            mask = 0x7F;
+        }
+        else
+        {
+            mask = 0xFF;
+        }
+        if (pcm > 8159)
+            pcm = 8159;
+        pcm += 0x84 >> 2;
+
+        const auto seg = search (pcm, seg_uend, 8);
+        if (seg >= 8)
+            return (uint8_t) (0x7F ^ mask);
+        return (uint8_t) (((seg << 4) | ((pcm >> (seg + 1)) & 0xF)) ^ mask);
+    }
+
+    int16_t ulaw_to_linear (uint8_t u_val)
+    {
+        u_val = (uint8_t) ~u_val;
+        int t = ((u_val & 0xF) << 3) + 0x84;
+        t <<= (u_val & 0x70) >> 4;
+        return (int16_t) ((u_val & 0x80) ? (0x84 - t) : (t - 0x84));
+    }
+
+    uint8_t linear_to_alaw (int16_t pcm_val)
+    {
+        static constexpr int seg_aend[8] = { 0x1F, 0x3F, 0x7F, 0xFF, 0x1FF, 0x3FF, 0x7FF, 0xFFF };
+        int pcm = pcm_val >> 3;
+        int mask;
+        if (pcm >= 0)
+        {
+            mask = 0xD5;
+        }
+        else
+        {
+            mask = 0x55;
+            pcm = -pcm - 1;
+        }
+
+        const auto seg = search (pcm, seg_aend, 8);
+        if (seg >= 8)
+            return (uint8_t) (0x7F ^ mask);
+        auto aval = seg << 4;
+        aval |= seg < 2 ? (pcm >> 1) & 0xF : (pcm >> seg) & 0xF;
+        return (uint8_t) (aval ^ mask);
+    }
+
+    int16_t alaw_to_linear (uint8_t a_val)
+    {
+        a_val ^= 0x55;
+        int t = (a_val & 0xF) << 4;
+        const auto seg = (a_val & 0x70) >> 4;
+        if (seg == 0)
+            t += 8;
+        else if (seg == 1)
+            t += 0x108;
+        else
+            t = (t + 0x108) << (seg - 1);
+        return (int16_t) ((a_val & 0x80) ? t : -t);
+    }
+} // namespace g711_reference
+
+template <typename Exact, typename Approx>
+float max_error (float begin, float end, Exact&& f_exact, Approx&& f_approx)
+{
+    static constexpr int num_points = 100'000;
+    float max_error = 0.0f;
+    for (int i = 0; i <= num_points; ++i)
+    {
+        const auto x = begin + (end - begin) * (float) i / (float) num_points;
+        max_error = std::max (max_error, (float) std::abs (f_exact ((double) x) - (double) f_approx (x)));
+    }
+    return max_error;
+}
+
+double mu_law_compress_exact (double x)
+{
+    return std::copysign (std::log1p (255.0 * std::abs (x)) / std::log (256.0), x);
+}
+
+double mu_law_expand_exact (double y)
+{
+    return std::copysign (std::expm1 (std::abs (y) * std::log (256.0)) / 255.0, y);
+}
+
+double a_law_compress_exact (double x)
+{
+    static constexpr double A = 87.6;
+    const auto abs_x = std::abs (x);
+    const auto y = abs_x < 1.0 / A ? A * abs_x / (1.0 + std::log (A)) : (1.0 + std::log (A * abs_x)) / (1.0 + std::log (A));
+    return std::copysign (y, x);
+}
+
+double a_law_expand_exact (double y)
+{
+    static constexpr double A = 87.6;
+    const auto abs_y = std::abs (y);
+    const auto x = abs_y < 1.0 / (1.0 + std::log (A)) ? abs_y * (1.0 + std::log (A)) / A : std::exp (abs_y * (1.0 + std::log (A)) - 1.0) / A;
+    return std::copysign (x, y);
+}
+} // namespace
+
+TEST_CASE ("Continuous Companding Test")
+{
+    SECTION ("mu-law")
+    {
+        const auto compress_error = max_error (-1.0f, 1.0f, mu_law_compress_exact, [] (float x)
+                                               { return math_approx::mu_law_compress<5> (x); });
+        const auto expand_error = max_error (-1.0f, 1.0f, mu_law_expand_exact, [] (float x)
+                                             { return math_approx::mu_law_expand<5> (x); });
+        std::cout << compress_error << ", " << expand_error << std::endl;
+        REQUIRE (compress_error < 3.0e-6f);
+        REQUIRE (expand_error < 5.0e-7f);
+    }
+
+    SECTION ("A-law")
+    {
+        const auto compress_error = max_error (-1.0f, 1.0f, a_law_compress_exact, [] (float x)
+                                               { return math_approx::a_law_compress<5> (x); });
+        const auto expand_error = max_error (-1.0f, 1.0f, a_law_expand_exact, [] (float x)
+                                             { return math_approx::a_law_expand<5> (x); });
+        std::cout << compress_error << ", " << expand_error << std::endl;
+        REQUIRE (compress_error < 1.0e-5f);
+        REQUIRE (expand_error < 3.0e-6f);
+    }
+
+    SECTION ("Bulk")
+    {
+        std::vector<float> x (1001);
+        for (size_t i = 0; i < x.size(); ++i)
+            x[i] = -1.0f + 2.0f * (float) i / (float) (x.size() - 1);
+
+        std::vector<float> y (x.size());
+        std::vector<float> z (x.size());
+        math_approx::mu_law_compress<5> (x.data(), y.data(), x.size());
+        math_approx::mu_law_expand<5> (y.data(), z.data(), y.size());
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            REQUIRE (y[i] == math_approx::mu_law_compress<5> (x[i]));
+            REQUIRE (std::abs (z[i] - x[i]) < 2.0e-5f);
+        }
+
+        math_approx::a_law_compress<5> (x.data(), y.data(), x.size());
+        math_approx::a_law_expand<5> (y.data(), z.data(), y.size());
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            REQUIRE (y[i] == math_approx::a_law_compress<5> (x[i]));
+            REQUIRE (std::abs (z[i] - x[i]) < 2.0e-5f);
+        }
+    }
+}
+
+TEST_CASE ("G.711 Test")
+{
+    std::vector<int16_t> pcm (1 << 16);
+    for (size_t i = 0; i < pcm.size(); ++i)
+        pcm[i] = (int16_t) ((int) i - 32768);
+
+    std::vector<uint8_t> all_codes (256);
+    for (size_t i = 0; i < all_codes.size(); ++i)
+        all_codes[i] = (uint8_t) i;
+
+    SECTION ("mu-law Encode")
+    {
+        std::vector<uint8_t> codes (pcm.size());
+        math_approx::mu_law_encode (pcm.data(), codes.data(), pcm.size());
+        for (size_t i = 0; i < pcm.size(); ++i)
+        {
+            REQUIRE (math_approx::mu_law_encode (pcm[i]) == g711_reference::linear_to_ulaw (pcm[i]));
+            REQUIRE (codes[i] == g711_reference::linear_to_ulaw (pcm[i]));
+        }
+    }
+
+    SECTION ("mu-law Decode")
+    {
+        std::vector<int16_t> decoded (all_codes.size());
+        std::vector<float> decoded_float (all_codes.size());
+        math_approx::mu_law_decode (all_codes.data(), decoded.data(), all_codes.size());
+        math_approx::mu_law_decode (all_codes.data(), decoded_float.data(), all_codes.size());
+        for (size_t i = 0; i < all_codes.size(); ++i)
+        {
+            const auto expected = g711_reference::ulaw_to_linear (all_codes[i]);
+            REQUIRE (math_approx::mu_law_decode (all_codes[i]) == expected);
+            REQUIRE (decoded[i] == expected);
+            REQUIRE (decoded_float[i] == (float) expected / 32768.0f);
+        }
+    }
+
+    SECTION ("A-law Encode")
+    {
+        std::vector<uint8_t> codes (pcm.size());
+        math_approx::a_law_encode (pcm.data(), codes.data(), pcm.size());
+        for (size_t i = 0; i < pcm.size(); ++i)
+        {
+            REQUIRE (math_approx::a_law_encode (pcm[i]) == g711_reference::linear_to_alaw (pcm[i]));
+            REQUIRE (codes[i] == g711_reference::linear_to_alaw (pcm[i]));
+        }
+    }
+
+    SECTION ("A-law Decode")
+    {
+        std::vector<int16_t> decoded (all_codes.size());
+        std::vector<float> decoded_float (all_codes.size());
+        math_approx::a_law_decode (all_codes.data(), decoded.data(), all_codes.size());
+        math_approx::a_law_decode (all_codes.data(), decoded_float.data(), all_codes.size());
+        for (size_t i = 0; i < all_codes.size(); ++i)
+        {
+            const auto expected = g711_reference::alaw_to_linear (all_codes[i]);
+            REQUIRE (math_approx::a_law_decode (all_codes[i]) == expected);
+            REQUIRE (decoded[i] == expected);
+            REQUIRE (decoded_float[i] == (float) expected / 32768.0f);
+        }
+    }
+
+    SECTION ("Float Encode")
+    {
+        std::vector<float> x (pcm.size());
+        for (size_t i = 0; i < pcm.size(); ++i)
+            x[i] = (float) pcm[i] / 32768.0f;
+        x.push_back (1.5f); // saturates to 32767
+        x.push_back (-1.5f); // saturates to -32768
+
+        std::vector<uint8_t> mu_codes (x.size());
+        std::vector<uint8_t> a_codes (x.size());
+        math_approx::mu_law_encode (x.data(), mu_codes.data(), x.size());
+        math_approx::a_law_encode (x.data(), a_codes.data(), x.size());
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            const auto pcm_value = (int16_t) std::clamp (x[i] * 32768.0f, -32768.0f, 32767.0f);
+            REQUIRE (mu_codes[i] == g711_reference::linear_to_ulaw (pcm_value));
+            REQUIRE (a_codes[i] == g711_reference::linear_to_alaw (pcm_value));
+        }
+    }
+}
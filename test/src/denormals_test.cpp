@@ -0,0 +1,78 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <limits>
+#include <math_approx/math_approx.hpp>
+#include <vector>
+
+namespace
+{
+// volatile, so that the compiler can't compute the products at compile-time
+template <typename T>
+T multiply (T a, T b)
+{
+    volatile T va = a;
+    volatile T vb = b;
+    return va * vb;
+}
+} // namespace
+
+TEST_CASE ("Scoped Flush Denormals Test")
+{
+    if (! math_approx::scoped_flush_denormals::is_supported)
+        SKIP ("Flushing denormals is not supported on this target");
+
+    const auto tiny_f = std::numeric_limits<float>::min();
+    const auto tiny_d = std::numeric_limits<double>::min();
+    REQUIRE (multiply (tiny_f, 0.25f) > 0.0f);
+
+    SECTION ("Flushes Within Scope")
+    {
+        {
+            math_approx::scoped_flush_denormals guard {};
+            REQUIRE (multiply (tiny_f, 0.25f) == 0.0f);
+            REQUIRE (multiply (tiny_d, 0.25) == 0.0);
+
+            // nested guards leave the state alone
+            {
+                math_approx::scoped_flush_denormals nested_guard {};
+                REQUIRE (multiply (tiny_f, 0.25f) == 0.0f);
+            }
+            REQUIRE (multiply (tiny_f, 0.25f) == 0.0f);
+        }
+
+        // the previous state is restored
+        REQUIRE (multiply (tiny_f, 0.25f) == tiny_f * 0.25f);
+        REQUIRE (multiply (tiny_d, 0.25) == tiny_d * 0.25);
+    }
+
+    SECTION ("Bulk Processing")
+    {
+        std::vector<float> x { 1.0f, 0.5f, tiny_f, tiny_f * 0.25f, -tiny_f * 0.5f, 0.0f, 2.0f };
+        std::vector<float> y (x.size());
+        const auto func = [] (auto v)
+        { return math_approx::tanh<5> (v) * 0.5f; };
+
+        math_approx::process_bulk (x.data(), y.data(), x.size(), func);
+        REQUIRE (y[3] != 0.0f);
+
+        math_approx::process_bulk<math_approx::denormal_mode::flush> (x.data(), y.data(), x.size(), func);
+        for (size_t n = 0; n < x.size(); ++n)
+        {
+            const auto expected = std::abs (x[n]) < tiny_f ? 0.0f : func (x[n]);
+            REQUIRE ((std::abs (y[n] - expected) < 1.0e-6f || std::abs (expected) < 2.0f * tiny_f));
+            REQUIRE ((y[n] == 0.0f || std::abs (y[n]) >= tiny_f));
+        }
+
+        // the state is restored after processing
+        REQUIRE (multiply (tiny_f, 0.25f) == tiny_f * 0.25f);
+
+        // tanh(FLT_MIN) * 0.5 and (float) 1.0e-39 are denormal as floats
+        std::vector<double> xd { 1.0, (double) tiny_f, 1.0e-39, 0.5 };
+        std::vector<double> yd (xd.size());
+        math_approx::process_bulk_mixed_precision<math_approx::denormal_mode::flush> (xd.data(), yd.data(), xd.size(), func);
+        REQUIRE (yd[0] == (double) func (1.0f));
+        REQUIRE (yd[1] == 0.0);
+        REQUIRE (yd[2] == 0.0);
+        REQUIRE (multiply (tiny_d, 0.25) == tiny_d * 0.25);
+    }
+}
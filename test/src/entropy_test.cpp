@@ -0,0 +1,130 @@
+#include "test_helpers.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+#include <random>
+
+#include <math_approx/math_approx.hpp>
+
+namespace
+{
+std::vector<float> make_distribution (size_t N, unsigned seed, size_t num_zeros = 0)
+{
+    std::minstd_rand rng { seed };
+    std::uniform_real_distribution<float> dist { 0.0f, 1.0f };
+    std::vector<float> p (N);
+    for (auto& v : p)
+        v = dist (rng);
+    for (size_t i = 0; i < num_zeros; ++i)
+        p[(i * 7919) % N] = 0.0f;
+
+    const auto sum = std::accumulate (p.begin(), p.end(), 0.0);
+    for (auto& v : p)
+        v = (float) ((double) v / sum);
+    return p;
+}
+
+double entropy_exact (const std::vector<float>& p)
+{
+    double sum = 0.0;
+    for (auto v : p)
+        sum -= v > 0.0f ? (double) v * std::log ((double) v) : 0.0;
+    return sum;
+}
+} // namespace
+
+TEST_CASE ("Entropy Test")
+{
+    const auto test_entropy = [] (const std::vector<float>& p, auto&& entropy_approx, double scale, double rel_err_bound)
+    {
+        const auto exact = entropy_exact (p) * scale;
+        const auto approx = (double) entropy_approx (p.data(), p.size());
+        const auto rel_error = std::abs (approx - exact) / exact;
+        std::cout << rel_error << std::endl;
+        REQUIRE (std::isfinite (approx));
+        REQUIRE (rel_error < rel_err_bound);
+    };
+
+    SECTION ("Nats")
+    {
+        const auto p = make_distribution (1003, 1, 50);
+        test_entropy (p, [] (auto&&... args)
+                      { return math_approx::entropy<6> (args...); },
+                      1.0,
+                      2.0e-6);
+        test_entropy (p, [] (auto&&... args)
+                      { return math_approx::entropy<4> (args...); },
+                      1.0,
+                      1.0e-4);
+    }
+    SECTION ("Bits")
+    {
+        const auto p = make_distribution (1003, 2, 50);
+        test_entropy (p, [] (auto&&... args)
+                      { return math_approx::entropy_bits<6> (args...); },
+                      1.0 / std::log (2.0),
+                      2.0e-6);
+    }
+    SECTION ("Large Array")
+    {
+        // the compensated accumulation should keep the error at the level of the log approximation
+        const auto p = make_distribution (1 << 20, 3);
+        test_entropy (p, [] (auto&&... args)
+                      { return math_approx::entropy<6> (args...); },
+                      1.0,
+                      2.0e-6);
+    }
+    SECTION ("Degenerate Distribution")
+    {
+        std::vector<float> p (100, 0.0f);
+        p[17] = 1.0f;
+        REQUIRE (std::abs (math_approx::entropy<5> (p.data(), p.size())) < 1.0e-6f);
+    }
+}
+
+TEST_CASE ("Cross-Entropy Test")
+{
+    SECTION ("Categorical")
+    {
+        const auto p = make_distribution (515, 4, 20);
+        const auto q = make_distribution (515, 5);
+
+        double exact = 0.0;
+        for (size_t n = 0; n < p.size(); ++n)
+            exact -= (double) p[n] * std::log ((double) q[n]);
+
+        const auto approx = (double) math_approx::cross_entropy<6> (p.data(), q.data(), p.size());
+        const auto rel_error = std::abs (approx - exact) / exact;
+        std::cout << rel_error << std::endl;
+        REQUIRE (rel_error < 2.0e-6);
+    }
+    SECTION ("Binary")
+    {
+        static constexpr size_t N = 1001;
+        std::minstd_rand rng { 6 };
+        std::uniform_real_distribution<float> dist { 0.0f, 1.0f };
+        std::vector<float> y (N), p (N);
+        for (size_t n = 0; n < N; ++n)
+        {
+            y[n] = n % 3 == 0 ? 1.0f : 0.0f;
+            p[n] = dist (rng);
+        }
+
+        double exact = 0.0;
+        for (size_t n = 0; n < N; ++n)
+            exact -= (double) y[n] * std::log ((double) p[n]) + (1.0 - (double) y[n]) * std::log (1.0 - (double) p[n]);
+
+        const auto approx = (double) math_approx::binary_cross_entropy<6> (y.data(), p.data(), N);
+        const auto rel_error = std::abs (approx - exact) / exact;
+        std::cout << rel_error << std::endl;
+        REQUIRE (rel_error < 2.0e-6);
+    }
+    SECTION ("Binary Saturated")
+    {
+        const float y[] { 1.0f, 0.0f, 1.0f, 0.0f };
+        const float p[] { 1.0f, 0.0f, 0.0f, 1.0f };
+        const auto approx = math_approx::binary_cross_entropy<5> (y, p, 4);
+        REQUIRE (std::isfinite (approx));
+        REQUIRE (approx > 150.0f); // two (clamped) "infinitely wrong" predictions
+        REQUIRE (math_approx::binary_cross_entropy<5> (y, p, 2) < 1.0e-5f);
+    }
+}
@@ -0,0 +1,95 @@
+#include "test_helpers.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+
+#include <math_approx/math_approx.hpp>
+
+namespace
+{
+template <typename Ramp, typename Reference>
+float max_relative_error (Ramp& ramp, Reference&& reference, size_t num_samples, bool use_block)
+{
+    std::vector<float> y (num_samples);
+    if (use_block)
+    {
+        // odd-sized blocks, to test re-anchoring across block boundaries
+        for (size_t n = 0; n < num_samples; n += 37)
+            ramp.process_block (y.data() + n, std::min ((size_t) 37, num_samples - n));
+    }
+    else
+    {
+        for (auto& y_n : y)
+            y_n = ramp.process();
+    }
+
+    float max_error = 0.0f;
+    for (size_t n = 0; n < num_samples; ++n)
+    {
+        const auto expected = reference ((double) n);
+        max_error = std::max (max_error, (float) std::abs ((expected - (double) y[n]) / expected));
+    }
+    return max_error;
+}
+} // namespace
+
+TEST_CASE ("Exponential Ramp Test")
+{
+    static constexpr size_t num_samples = 100'000;
+
+    for (bool use_block : { false, true })
+    {
+        SECTION (use_block ? "Exp (Block)" : "Exp")
+        {
+            math_approx::exp_ramp<6> ramp;
+            ramp.set (-3.0f, 5.0e-5f);
+            const auto error = max_relative_error (ramp, [] (double n)
+                                                   { return std::exp ((double) -3.0f + n * (double) 5.0e-5f); },
+                                                   num_samples,
+                                                   use_block);
+            std::cout << error << std::endl;
+            REQUIRE (error < 1.0e-5f);
+        }
+
+        SECTION (use_block ? "Exp2 (Block)" : "Exp2")
+        {
+            // one-octave frequency glide, over one second at 48 kHz
+            math_approx::exp2_ramp<6> ramp;
+            ramp.set (std::log2 (440.0f), 1.0f / 48000.0f);
+            const auto error = max_relative_error (ramp, [] (double n)
+                                                   { return std::exp2 ((double) std::log2 (440.0f) + n * (double) (1.0f / 48000.0f)); },
+                                                   48000,
+                                                   use_block);
+            std::cout << error << std::endl;
+            REQUIRE (error < 1.0e-5f);
+        }
+
+        SECTION (use_block ? "Exp10 (Block)" : "Exp10")
+        {
+            // gain ramp from -60 dB, rising by 1 dB per 1000 samples
+            math_approx::exp10_ramp<6> ramp;
+            ramp.set (-3.0f, 1.0f / 20000.0f);
+            const auto error = max_relative_error (ramp, [] (double n)
+                                                   { return std::pow (10.0, -3.0 + n * (double) (1.0f / 20000.0f)); },
+                                                   num_samples,
+                                                   use_block);
+            std::cout << error << std::endl;
+            REQUIRE (error < 1.0e-5f);
+        }
+    }
+
+    SECTION ("Multiply Block")
+    {
+        math_approx::exp_ramp<6> ramp_1;
+        math_approx::exp_ramp<6> ramp_2;
+        ramp_1.set (0.0f, -1.0e-3f);
+        ramp_2.set (0.0f, -1.0e-3f);
+
+        std::vector<float> gain (1000);
+        std::vector<float> data (1000, 2.0f);
+        ramp_1.process_block (gain.data(), gain.size());
+        ramp_2.multiply_block (data.data(), data.size());
+        for (size_t n = 0; n < data.size(); ++n)
+            REQUIRE (data[n] == 2.0f * gain[n]);
+        REQUIRE (ramp_1.get_exponent() == ramp_2.get_exponent());
+    }
+}
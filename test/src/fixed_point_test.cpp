@@ -0,0 +1,174 @@
+#include "test_helpers.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+
+#include <math_approx/math_approx.hpp>
+
+namespace
+{
+using math_approx::fixed_point_rounding;
+
+constexpr double q15_scale = 32768.0;
+constexpr double q31_scale = 2147483648.0;
+
+/** Checks a Q1.15 approximation against the exact function, over every 16-bit input */
+template <typename FExact>
+void test_q15_exhaustive (FExact&& f_exact, int16_t (*f_approx) (int16_t), double err_bound_lsb, int min_input = -32768)
+{
+    double max_error = 0.0;
+    for (int i = min_input; i <= 32767; ++i)
+    {
+        const auto x = (int16_t) i;
+        const auto expected = f_exact ((double) x / q15_scale) * q15_scale;
+        max_error = std::max (max_error, std::abs ((double) f_approx (x) - expected));
+    }
+
+    std::cout << max_error << " LSB" << std::endl;
+    REQUIRE (max_error < err_bound_lsb);
+}
+
+/** Checks a Q1.31 approximation against the exact function, over a strided sweep of 32-bit inputs */
+template <typename FExact>
+void test_q31 (FExact&& f_exact, int32_t (*f_approx) (int32_t), double err_bound_lsb, int64_t min_input = INT32_MIN)
+{
+    double max_error = 0.0;
+    for (int64_t i = min_input; i <= INT32_MAX; i += 4099)
+    {
+        const auto x = (int32_t) i;
+        const auto expected = f_exact ((double) x / q31_scale) * q31_scale;
+        max_error = std::max (max_error, std::abs ((double) f_approx (x) - expected));
+    }
+
+    std::cout << max_error << " LSB" << std::endl;
+    REQUIRE (max_error < err_bound_lsb);
+}
+
+/**
+ * Checks that the bulk kernel matches the scalar function, for every Q1.15 input (or a strided
+ * sweep of Q1.31 inputs), plus the extremes, in a buffer with a scalar remainder
+ */
+template <typename T>
+void test_bulk (void (*f_bulk) (const T*, T*, size_t), T (*f_scalar) (T))
+{
+    using limits = std::numeric_limits<T>;
+    std::vector<T> x;
+    for (int64_t i = limits::min(); i <= limits::max(); i += sizeof (T) == 2 ? 1 : 65537)
+        x.push_back ((T) i);
+    for (auto extreme : { limits::min(), (T) (limits::min() + 1), (T) -1, (T) 0, (T) 1, limits::max() })
+        x.push_back (extreme);
+
+    std::vector<T> y (x.size());
+    f_bulk (x.data(), y.data(), x.size());
+    for (size_t i = 0; i < x.size(); ++i)
+        REQUIRE (y[i] == f_scalar (x[i]));
+}
+} // namespace
+
+TEST_CASE ("Fixed-Point Sin/Cos Test")
+{
+    const auto sin_exact = [] (double x)
+    { return std::clamp (std::sin (2.0 * M_PI * x), -1.0, 32767.0 / q15_scale); };
+    const auto cos_exact = [] (double x)
+    { return std::clamp (std::cos (2.0 * M_PI * x), -1.0, 32767.0 / q15_scale); };
+    const auto sin_exact_q31 = [] (double x)
+    { return std::clamp (std::sin (2.0 * M_PI * x), -1.0, (q31_scale - 1.0) / q31_scale); };
+    const auto cos_exact_q31 = [] (double x)
+    { return std::clamp (std::cos (2.0 * M_PI * x), -1.0, (q31_scale - 1.0) / q31_scale); };
+
+    SECTION ("Q15 nearest")
+    {
+        test_q15_exhaustive (sin_exact, math_approx::sin_turns_q15<fixed_point_rounding::nearest>, 2.0);
+        test_q15_exhaustive (cos_exact, math_approx::cos_turns_q15<fixed_point_rounding::nearest>, 2.0);
+    }
+    SECTION ("Q15 truncate")
+    {
+        test_q15_exhaustive (sin_exact, math_approx::sin_turns_q15<fixed_point_rounding::truncate>, 3.5);
+        test_q15_exhaustive (cos_exact, math_approx::cos_turns_q15<fixed_point_rounding::truncate>, 3.5);
+    }
+    SECTION ("Q31")
+    {
+        test_q31 (sin_exact_q31, math_approx::sin_turns_q31<fixed_point_rounding::nearest>, 3.0);
+        test_q31 (cos_exact_q31, math_approx::cos_turns_q31<fixed_point_rounding::nearest>, 3.0);
+        test_q31 (sin_exact_q31, math_approx::sin_turns_q31<fixed_point_rounding::truncate>, 5.5);
+    }
+    SECTION ("Bulk")
+    {
+        test_bulk<int16_t> (math_approx::sin_turns_q15<>, math_approx::sin_turns_q15<>);
+        test_bulk<int16_t> (math_approx::cos_turns_q15<>, math_approx::cos_turns_q15<>);
+        test_bulk<int32_t> (math_approx::sin_turns_q31<>, math_approx::sin_turns_q31<>);
+        test_bulk<int32_t> (math_approx::cos_turns_q31<>, math_approx::cos_turns_q31<>);
+    }
+}
+
+TEST_CASE ("Fixed-Point Pow2 Test")
+{
+    const auto pow2_exact = [] (double x)
+    { return std::exp2 (x - 1.0); };
+
+    SECTION ("Q15")
+    {
+        test_q15_exhaustive (pow2_exact, math_approx::pow2_q15<fixed_point_rounding::nearest>, 1.5);
+        test_q15_exhaustive (pow2_exact, math_approx::pow2_q15<fixed_point_rounding::truncate>, 2.5);
+    }
+    SECTION ("Q31")
+    {
+        test_q31 (pow2_exact, math_approx::pow2_q31<fixed_point_rounding::nearest>, 2.0);
+        test_q31 (pow2_exact, math_approx::pow2_q31<fixed_point_rounding::truncate>, 4.5);
+    }
+    SECTION ("Bulk")
+    {
+        test_bulk<int16_t> (math_approx::pow2_q15<>, math_approx::pow2_q15<>);
+        test_bulk<int32_t> (math_approx::pow2_q31<>, math_approx::pow2_q31<>);
+    }
+}
+
+TEST_CASE ("Fixed-Point Log2 Test")
+{
+    SECTION ("Q15")
+    {
+        const auto log2_exact = [] (double x)
+        { return std::log2 (x) / 16.0; };
+        test_q15_exhaustive (log2_exact, math_approx::log2_q15<fixed_point_rounding::nearest>, 0.75, 1);
+        test_q15_exhaustive (log2_exact, math_approx::log2_q15<fixed_point_rounding::truncate>, 1.25, 1);
+
+        REQUIRE (math_approx::log2_q15 (0) == -32768);
+        REQUIRE (math_approx::log2_q15 (-32768) == -32768);
+    }
+    SECTION ("Q31")
+    {
+        const auto log2_exact = [] (double x)
+        { return std::log2 (x) / 32.0; };
+        test_q31 (log2_exact, math_approx::log2_q31<fixed_point_rounding::nearest>, 0.75, 1);
+        test_q31 (log2_exact, math_approx::log2_q31<fixed_point_rounding::truncate>, 1.25, 1);
+
+        REQUIRE (math_approx::log2_q31 (0) == INT32_MIN);
+        REQUIRE (math_approx::log2_q31 (INT32_MIN) == INT32_MIN);
+    }
+    SECTION ("Bulk")
+    {
+        test_bulk<int16_t> (math_approx::log2_q15<>, math_approx::log2_q15<>);
+        test_bulk<int32_t> (math_approx::log2_q31<>, math_approx::log2_q31<>);
+    }
+}
+
+TEST_CASE ("Fixed-Point Tanh Test")
+{
+    const auto tanh_exact = [] (double x)
+    { return std::tanh (x); };
+
+    SECTION ("Q15")
+    {
+        test_q15_exhaustive (tanh_exact, math_approx::tanh_q15<fixed_point_rounding::nearest>, 2.75);
+        test_q15_exhaustive (tanh_exact, math_approx::tanh_q15<fixed_point_rounding::truncate>, 5.25);
+    }
+    SECTION ("Q31")
+    {
+        test_q31 (tanh_exact, math_approx::tanh_q31<fixed_point_rounding::nearest>, 4.0);
+        test_q31 (tanh_exact, math_approx::tanh_q31<fixed_point_rounding::truncate>, 8.5);
+    }
+    SECTION ("Bulk")
+    {
+        test_bulk<int16_t> (math_approx::tanh_q15<>, math_approx::tanh_q15<>);
+        test_bulk<int32_t> (math_approx::tanh_q31<>, math_approx::tanh_q31<>);
+    }
+}
@@ -216,3 +216,53 @@ TEST_CASE ("Tanh Approx Test")
                      0);
     }
 }
+
+TEST_CASE ("Tanh Approx Test (double)")
+{
+    const auto test_approx = [] (auto&& f_exact, auto&& f_approx, double err_bound)
+    {
+        static constexpr int num_points = 1'000'000;
+        double max_error = 0.0;
+        for (int i = 0; i <= num_points; ++i)
+        {
+            const auto x = -30.0 + (30.0 - -30.0) * (double) i / (double) num_points;
+            max_error = std::max (max_error, std::abs ((f_exact (x) - f_approx (x)) / f_exact (x)));
+        }
+
+        std::cout << max_error << std::endl;
+        REQUIRE (max_error < err_bound);
+    };
+
+    SECTION ("19th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::tanh (x); },
+                     [] (double x)
+                     { return math_approx::tanh<19> (x); },
+                     1.5e-12);
+    }
+    SECTION ("17th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::tanh (x); },
+                     [] (double x)
+                     { return math_approx::tanh<17> (x); },
+                     2.0e-11);
+    }
+    SECTION ("15th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::tanh (x); },
+                     [] (double x)
+                     { return math_approx::tanh<15> (x); },
+                     3.0e-10);
+    }
+    SECTION ("13th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::tanh (x); },
+                     [] (double x)
+                     { return math_approx::tanh<13> (x); },
+                     5.0e-9);
+    }
+}
@@ -183,3 +183,210 @@ TEST_CASE ("Atan Approx Test")
                      0);
     }
 }
+
+TEST_CASE ("Atan2 Approx Test")
+{
+    static constexpr int num_angles = 100'000;
+    const auto test_approx = [] (auto&& f_approx, float err_bound)
+    {
+        float max_error = 0.0f;
+        for (int i = 0; i < num_angles; ++i)
+        {
+            const auto angle = -3.14159f + 6.28318f * (float) i / (float) num_angles;
+            for (const auto radius : { 1.0e-3f, 1.0f, 1.0e3f })
+            {
+                const auto x = radius * std::cos (angle);
+                const auto y = radius * std::sin (angle);
+                max_error = std::max (max_error, std::abs (std::atan2 (y, x) - f_approx (y, x)));
+            }
+        }
+
+        std::cout << max_error << std::endl;
+        REQUIRE (max_error < err_bound);
+    };
+
+    SECTION ("Zero")
+    {
+        REQUIRE (math_approx::atan2<7> (0.0f, 0.0f) == 0.0f);
+        REQUIRE (math_approx::atan2<7> (0.0f, 1.0f) == 0.0f);
+        REQUIRE (std::abs (math_approx::atan2<7> (0.0f, -1.0f) - (float) M_PI) < 1.0e-6f);
+        REQUIRE (std::abs (math_approx::atan2<7> (-0.0f, -1.0f) + (float) M_PI) < 1.0e-6f);
+        REQUIRE (! std::signbit (math_approx::atan2<7> (0.0f, 1.0f)));
+        REQUIRE (std::signbit (math_approx::atan2<7> (-0.0f, 1.0f)));
+    }
+    SECTION ("7th-Order")
+    {
+        test_approx ([] (auto y, auto x)
+                     { return math_approx::atan2<7> (y, x); },
+                     6.0e-7f);
+    }
+    SECTION ("5th-Order")
+    {
+        test_approx ([] (auto y, auto x)
+                     { return math_approx::atan2<5> (y, x); },
+                     2.0e-5f);
+    }
+    SECTION ("2nd-Order")
+    {
+        test_approx ([] (auto y, auto x)
+                     { return math_approx::atan2<2> (y, x); },
+                     7.0e-3f);
+    }
+}
+
+TEST_CASE ("Asin/Acos Approx Test (double)")
+{
+    const auto test_approx = [] (auto&& f_exact, auto&& f_approx, double err_bound)
+    {
+        static constexpr int num_points = 1'000'000;
+        double max_error = 0.0;
+        for (int i = 0; i <= num_points; ++i)
+        {
+            const auto x = -1.0 + (1.0 - -1.0) * (double) i / (double) num_points;
+            max_error = std::max (max_error, std::abs (f_exact (x) - f_approx (x)));
+        }
+
+        std::cout << max_error << std::endl;
+        REQUIRE (max_error < err_bound);
+    };
+
+    SECTION ("10th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::asin (x); },
+                     [] (double x)
+                     { return math_approx::asin<10> (x); },
+                     1.0e-15);
+        test_approx ([] (double x)
+                     { return std::acos (x); },
+                     [] (double x)
+                     { return math_approx::acos<10> (x); },
+                     1.0e-15);
+    }
+    SECTION ("9th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::asin (x); },
+                     [] (double x)
+                     { return math_approx::asin<9> (x); },
+                     3.0e-15);
+        test_approx ([] (double x)
+                     { return std::acos (x); },
+                     [] (double x)
+                     { return math_approx::acos<9> (x); },
+                     3.0e-15);
+    }
+    SECTION ("8th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::asin (x); },
+                     [] (double x)
+                     { return math_approx::asin<8> (x); },
+                     5.0e-14);
+        test_approx ([] (double x)
+                     { return std::acos (x); },
+                     [] (double x)
+                     { return math_approx::acos<8> (x); },
+                     5.0e-14);
+    }
+    SECTION ("7th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::asin (x); },
+                     [] (double x)
+                     { return math_approx::asin<7> (x); },
+                     7.0e-13);
+        test_approx ([] (double x)
+                     { return std::acos (x); },
+                     [] (double x)
+                     { return math_approx::acos<7> (x); },
+                     7.0e-13);
+    }
+    SECTION ("6th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::asin (x); },
+                     [] (double x)
+                     { return math_approx::asin<6> (x); },
+                     1.2e-11);
+        test_approx ([] (double x)
+                     { return std::acos (x); },
+                     [] (double x)
+                     { return math_approx::acos<6> (x); },
+                     1.2e-11);
+    }
+    SECTION ("5th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::asin (x); },
+                     [] (double x)
+                     { return math_approx::asin<5> (x); },
+                     2.0e-10);
+    }
+}
+
+TEST_CASE ("Atan Approx Test (double)")
+{
+    const auto test_approx = [] (auto&& f_exact, auto&& f_approx, double err_bound)
+    {
+        static constexpr int num_points = 1'000'000;
+        double max_error = 0.0;
+        for (int i = 0; i <= num_points; ++i)
+        {
+            const auto x = -10.0 + (10.0 - -10.0) * (double) i / (double) num_points;
+            max_error = std::max (max_error, std::abs (f_exact (x) - f_approx (x)));
+        }
+
+        std::cout << max_error << std::endl;
+        REQUIRE (max_error < err_bound);
+    };
+
+    SECTION ("19th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::atan (x); },
+                     [] (double x)
+                     { return math_approx::atan<19> (x); },
+                     1.0e-15);
+    }
+    SECTION ("17th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::atan (x); },
+                     [] (double x)
+                     { return math_approx::atan<17> (x); },
+                     1.5e-14);
+    }
+    SECTION ("15th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::atan (x); },
+                     [] (double x)
+                     { return math_approx::atan<15> (x); },
+                     4.0e-13);
+    }
+    SECTION ("13th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::atan (x); },
+                     [] (double x)
+                     { return math_approx::atan<13> (x); },
+                     1.0e-11);
+    }
+    SECTION ("11th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::atan (x); },
+                     [] (double x)
+                     { return math_approx::atan<11> (x); },
+                     3.0e-10);
+    }
+    SECTION ("9th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::atan (x); },
+                     [] (double x)
+                     { return math_approx::atan<9> (x); },
+                     1.0e-8);
+    }
+}
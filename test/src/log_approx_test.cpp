@@ -221,3 +221,73 @@ TEMPLATE_TEST_CASE ("Log10 Approx Test", "", float, double)
                      3.0e-2f);
     }
 }
+
+TEST_CASE ("Log2 Approx Test (double)")
+{
+    const auto test_approx = [] (auto&& f_exact, auto&& f_approx, double err_bound)
+    {
+        static constexpr int num_points = 1'000'000;
+        double max_error = 0.0;
+        for (int i = 0; i <= num_points; ++i)
+        {
+            const auto x = 1.0e-2 + (1.0e2 - 1.0e-2) * (double) i / (double) num_points;
+            max_error = std::max (max_error, std::abs (f_exact (x) - f_approx (x)));
+        }
+
+        std::cout << max_error << std::endl;
+        REQUIRE (max_error < err_bound);
+    };
+
+    SECTION ("10th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::log2 (x); },
+                     [] (double x)
+                     { return math_approx::log2<10> (x); },
+                     3.0e-15);
+        test_approx ([] (double x)
+                     { return std::log (x); },
+                     [] (double x)
+                     { return math_approx::log<10> (x); },
+                     3.0e-15);
+    }
+    SECTION ("9th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::log2 (x); },
+                     [] (double x)
+                     { return math_approx::log2<9> (x); },
+                     5.0e-14);
+        test_approx ([] (double x)
+                     { return std::log (x); },
+                     [] (double x)
+                     { return math_approx::log<9> (x); },
+                     5.0e-14);
+    }
+    SECTION ("8th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::log2 (x); },
+                     [] (double x)
+                     { return math_approx::log2<8> (x); },
+                     1.5e-12);
+        test_approx ([] (double x)
+                     { return std::log (x); },
+                     [] (double x)
+                     { return math_approx::log<8> (x); },
+                     1.5e-12);
+    }
+    SECTION ("7th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::log2 (x); },
+                     [] (double x)
+                     { return math_approx::log2<7> (x); },
+                     6.0e-11);
+        test_approx ([] (double x)
+                     { return std::log (x); },
+                     [] (double x)
+                     { return math_approx::log<7> (x); },
+                     6.0e-11);
+    }
+}
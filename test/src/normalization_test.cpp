@@ -0,0 +1,132 @@
+#include "catch2/catch_template_test_macros.hpp"
+#include "test_helpers.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+#include <random>
+
+#include <math_approx/math_approx.hpp>
+
+namespace
+{
+template <typename T>
+std::vector<T> make_random_data (size_t N, T offset, T range)
+{
+    std::minstd_rand rng { 0x5678 };
+    std::uniform_real_distribution<T> dist { offset - range, offset + range };
+    std::vector<T> x (N);
+    for (auto& v : x)
+        v = dist (rng);
+    return x;
+}
+
+template <typename T>
+void reference_norm (const T* x, T* y, size_t N, const T* scale, const T* bias, T epsilon, bool subtract_mean)
+{
+    long double mean = 0;
+    if (subtract_mean)
+    {
+        for (size_t n = 0; n < N; ++n)
+            mean += x[n];
+        mean /= (long double) N;
+    }
+
+    long double var = 0;
+    for (size_t n = 0; n < N; ++n)
+        var += ((long double) x[n] - mean) * ((long double) x[n] - mean);
+    var /= (long double) N;
+
+    const auto inv_std = 1.0L / std::sqrt (var + epsilon);
+    for (size_t n = 0; n < N; ++n)
+        y[n] = (T) (((long double) x[n] - mean) * inv_std * (scale != nullptr ? scale[n] : (T) 1) + (bias != nullptr ? bias[n] : (T) 0));
+}
+
+template <typename T>
+T max_abs_diff (const std::vector<T>& a, const std::vector<T>& b)
+{
+    T max_diff {};
+    for (size_t n = 0; n < a.size(); ++n)
+        max_diff = std::max (max_diff, std::abs (a[n] - b[n]));
+    return max_diff;
+}
+} // namespace
+
+TEMPLATE_TEST_CASE ("Normalization Test", "", float, double)
+{
+    const auto tol = std::is_same_v<TestType, float> ? (TestType) 2.0e-5 : (TestType) 1.0e-12;
+
+    for (const auto N : { (size_t) 1, (size_t) 7, (size_t) 64, (size_t) 1001 })
+    {
+        const auto x = make_random_data<TestType> (N, (TestType) 0, (TestType) 2);
+        const auto scale = make_random_data<TestType> (N, (TestType) 1, (TestType) 0.5);
+        const auto bias = make_random_data<TestType> (N, (TestType) 0, (TestType) 0.5);
+        std::vector<TestType> y (N), y_ref (N);
+
+        SECTION ("RMS Norm (" + std::to_string (N) + ")")
+        {
+            math_approx::rms_norm (x.data(), y.data(), N);
+            reference_norm<TestType> (x.data(), y_ref.data(), N, nullptr, nullptr, (TestType) 1.0e-6, false);
+            REQUIRE (max_abs_diff (y, y_ref) < tol);
+
+            math_approx::rms_norm (x.data(), y.data(), N, scale.data());
+            reference_norm<TestType> (x.data(), y_ref.data(), N, scale.data(), nullptr, (TestType) 1.0e-6, false);
+            REQUIRE (max_abs_diff (y, y_ref) < tol);
+        }
+
+        SECTION ("Layer Norm (" + std::to_string (N) + ")")
+        {
+            math_approx::layer_norm (x.data(), y.data(), N);
+            reference_norm<TestType> (x.data(), y_ref.data(), N, nullptr, nullptr, (TestType) 1.0e-5, true);
+            REQUIRE (max_abs_diff (y, y_ref) < tol);
+
+            math_approx::layer_norm (x.data(), y.data(), N, scale.data(), bias.data());
+            reference_norm<TestType> (x.data(), y_ref.data(), N, scale.data(), bias.data(), (TestType) 1.0e-5, true);
+            REQUIRE (max_abs_diff (y, y_ref) < tol);
+        }
+    }
+
+    SECTION ("Layer Norm (large offset)")
+    {
+        // the one-pass variance should not suffer from cancellation when the mean is large
+        constexpr size_t N = 512;
+        const auto x = make_random_data<TestType> (N, (TestType) 1000, (TestType) 1);
+        std::vector<TestType> y (N), y_ref (N);
+        math_approx::layer_norm (x.data(), y.data(), N);
+        reference_norm<TestType> (x.data(), y_ref.data(), N, nullptr, nullptr, (TestType) 1.0e-5, true);
+        REQUIRE (max_abs_diff (y, y_ref) < (TestType) 1.0e3 * tol);
+    }
+
+    SECTION ("Matrix Rows")
+    {
+        constexpr size_t num_rows = 13;
+        constexpr size_t num_cols = 333;
+        const auto x = make_random_data<TestType> (num_rows * num_cols, (TestType) 0.5, (TestType) 3);
+        const auto scale = make_random_data<TestType> (num_cols, (TestType) 1, (TestType) 0.5);
+        const auto bias = make_random_data<TestType> (num_cols, (TestType) 0, (TestType) 0.5);
+        std::vector<TestType> y (num_rows * num_cols), y_ref (num_rows * num_cols);
+
+        math_approx::rms_norm_rows (x.data(), y.data(), num_rows, num_cols, scale.data());
+        for (size_t r = 0; r < num_rows; ++r)
+            reference_norm<TestType> (x.data() + r * num_cols, y_ref.data() + r * num_cols, num_cols, scale.data(), nullptr, (TestType) 1.0e-6, false);
+        REQUIRE (max_abs_diff (y, y_ref) < tol);
+
+        math_approx::layer_norm_rows (x.data(), y.data(), num_rows, num_cols, scale.data(), bias.data());
+        for (size_t r = 0; r < num_rows; ++r)
+            reference_norm<TestType> (x.data() + r * num_cols, y_ref.data() + r * num_cols, num_cols, scale.data(), bias.data(), (TestType) 1.0e-5, true);
+        REQUIRE (max_abs_diff (y, y_ref) < tol);
+    }
+
+    SECTION ("Empty Rows")
+    {
+        // nothing should be read from (or written to) the empty buffers
+        const TestType* x = nullptr;
+        TestType* y = nullptr;
+        math_approx::rms_norm (x, y, 0);
+        math_approx::layer_norm (x, y, 0);
+        math_approx::rms_norm_rows (x, y, 5, 0);
+        math_approx::layer_norm_rows (x, y, 5, 0);
+
+        std::vector<TestType> y_untouched (8, (TestType) 42);
+        math_approx::layer_norm_rows (x, y_untouched.data(), 0, y_untouched.size());
+        REQUIRE (y_untouched == std::vector<TestType> (8, (TestType) 42));
+    }
+}
@@ -0,0 +1,94 @@
+#include "test_helpers.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+
+#include <math_approx/math_approx.hpp>
+
+TEST_CASE ("Oscillator Bank Test")
+{
+    static constexpr float fs = 48000.0f;
+    static constexpr size_t num_partials = 37;
+    static constexpr float f0 = 220.0f;
+
+    SECTION ("Harmonic Series")
+    {
+        math_approx::oscillator_bank<9> bank;
+        bank.prepare (fs, num_partials);
+        for (size_t k = 0; k < num_partials; ++k)
+            bank.set_partial (k, f0 * (float) (k + 1), 1.0f / (float) (k + 1));
+        bank.reset();
+
+        static constexpr size_t N = 4800;
+        std::vector<float> y (N, 0.0f);
+        bank.process_block (y.data(), N);
+
+        float max_error = 0.0f;
+        for (size_t n = 0; n < N; ++n)
+        {
+            double expected = 0.0;
+            for (size_t k = 0; k < num_partials; ++k)
+            {
+                const auto increment = math_approx::phase_increment ((double) f0 * (double) (k + 1), (double) fs);
+                const auto phase = (uint32_t) ((uint32_t) n * increment);
+                expected += std::sin (2.0 * M_PI * (double) phase / 4294967296.0) / (double) (k + 1);
+            }
+            max_error = std::max (max_error, (float) std::abs (expected - (double) y[n]));
+        }
+        std::cout << max_error << std::endl;
+        REQUIRE (max_error < 1.0e-5f);
+    }
+
+    SECTION ("Amplitude Smoothing")
+    {
+        math_approx::oscillator_bank<9> bank;
+        bank.prepare (fs, 1, 0.001f);
+        bank.set_partial (0, fs / 4.0f, 1.0f);
+        bank.set_phase (0, 0.25f); // cosine, so every other sample is +/-1 (or 0)
+
+        static constexpr size_t N = 2000;
+        std::vector<float> y (N, 0.0f);
+        bank.process_block (y.data(), N);
+
+        // the first sample should be close to zero, and the amplitude should ramp up monotonically
+        REQUIRE (std::abs (y[0]) < 0.05f);
+        for (size_t n = 4; n < N; n += 2)
+            REQUIRE (std::abs (y[n]) >= std::abs (y[n - 2]));
+        REQUIRE (std::abs (std::abs (y[N - 2]) - 1.0f) < 1.0e-5f);
+    }
+
+    SECTION ("Band-Limit Culling")
+    {
+        math_approx::oscillator_bank<9> bank;
+        bank.prepare (fs, num_partials);
+        for (size_t k = 0; k < num_partials; ++k)
+            bank.set_partial (k, 1000.0f * (float) (k + 1), 1.0f);
+        bank.reset();
+
+        // partials at or above Nyquist are never computed
+        REQUIRE (bank.num_active_partials() < 24 + 8);
+
+        // lowering the band-limit fades out the upper partials, and then stops computing them
+        bank.set_band_limit (4500.0f);
+        std::vector<float> y (4800, 0.0f);
+        bank.process_block (y.data(), y.size());
+        bank.process_block (y.data(), y.size());
+        REQUIRE (bank.num_active_partials() < 4 + 8);
+
+        std::fill (y.begin(), y.end(), 0.0f);
+        bank.process_block (y.data(), y.size());
+        float max_error = 0.0f;
+        for (size_t n = 0; n < y.size(); ++n)
+        {
+            double expected = 0.0;
+            for (size_t k = 0; k < 4; ++k)
+            {
+                const auto increment = math_approx::phase_increment (1000.0 * (double) (k + 1), (double) fs);
+                const auto phase = (uint32_t) ((uint32_t) (n + 9600) * increment);
+                expected += std::sin (2.0 * M_PI * (double) phase / 4294967296.0);
+            }
+            max_error = std::max (max_error, (float) std::abs (expected - (double) y[n]));
+        }
+        std::cout << max_error << std::endl;
+        REQUIRE (max_error < 1.0e-5f);
+    }
+}
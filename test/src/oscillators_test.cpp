@@ -0,0 +1,86 @@
+#include "test_helpers.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+
+#include <math_approx/math_approx.hpp>
+
+namespace
+{
+double exact_sin_of_phase (uint32_t phase)
+{
+    return std::sin (2.0 * M_PI * (double) phase / 4294967296.0);
+}
+} // namespace
+
+TEST_CASE ("Phase To Turns Test")
+{
+    REQUIRE (math_approx::phase_to_turns (0u) == 0.0f);
+    REQUIRE (math_approx::phase_to_turns (0x40000000u) == 0.25f);
+    REQUIRE (math_approx::phase_to_turns (0x80000000u) == -0.5f);
+    REQUIRE (math_approx::phase_to_turns (0xc0000000u) == -0.25f);
+    REQUIRE (math_approx::phase_to_turns (0xffffffffu) < 0.0f);
+
+    REQUIRE (math_approx::phase_increment (12000.0, 48000.0) == 0x40000000u);
+    REQUIRE (math_approx::phase_increment (-12000.0, 48000.0) == 0xc0000000u);
+}
+
+TEST_CASE ("Sine Oscillator Test")
+{
+    static constexpr double fs = 48000.0;
+
+    SECTION ("Fixed Frequency")
+    {
+        static constexpr double freq = 440.0;
+        math_approx::sine_oscillator<9> osc;
+        osc.prepare ((float) fs);
+        osc.set_frequency ((float) freq);
+
+        const auto increment = math_approx::phase_increment (freq, fs);
+        float max_error = 0.0f;
+        for (uint32_t n = 0; n < 100'000; ++n)
+            max_error = std::max (max_error, (float) std::abs (exact_sin_of_phase (n * increment) - (double) osc.process()));
+        std::cout << max_error << std::endl;
+        REQUIRE (max_error < 1.0e-6f);
+    }
+
+    SECTION ("No Drift")
+    {
+        // after a few minutes at 48 kHz, the phase should be exactly where integer arithmetic puts it
+        static constexpr uint32_t num_samples = 10'000'000;
+        static constexpr double freq = 1000.1;
+
+        math_approx::sine_oscillator<9> osc;
+        osc.prepare ((float) fs);
+        osc.set_frequency ((float) freq);
+        osc.set_phase (0.125f);
+
+        for (uint32_t n = 0; n < num_samples; ++n)
+            osc.process();
+
+        const auto expected_phase = 0x20000000u + num_samples * math_approx::phase_increment ((float) freq, fs);
+        REQUIRE (std::abs ((double) osc.process() - exact_sin_of_phase (expected_phase)) < 1.0e-6);
+    }
+
+    SECTION ("Frequency Modulation")
+    {
+        static constexpr size_t N = 4800;
+        std::vector<float> freq (N);
+        for (size_t n = 0; n < N; ++n)
+            freq[n] = 1000.0f + 800.0f * std::sin (2.0f * (float) M_PI * 5.0f * (float) n / (float) fs);
+
+        math_approx::sine_oscillator<9> osc;
+        osc.prepare ((float) fs);
+        std::vector<float> y (N);
+        osc.process_block (y.data(), freq.data(), N);
+
+        double phase = 0.0;
+        float max_error = 0.0f;
+        for (size_t n = 0; n < N; ++n)
+        {
+            max_error = std::max (max_error, (float) std::abs (std::sin (2.0 * M_PI * phase) - (double) y[n]));
+            phase += (double) freq[n] / fs;
+        }
+        std::cout << max_error << std::endl;
+        REQUIRE (max_error < 1.0e-5f);
+    }
+}
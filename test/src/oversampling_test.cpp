@@ -0,0 +1,149 @@
+#include "test_helpers.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+
+#include <math_approx/math_approx.hpp>
+
+namespace
+{
+constexpr float fs = 48000.0f;
+
+std::vector<float> make_sine (float freq, float amplitude, size_t N)
+{
+    std::vector<float> x (N);
+    for (size_t n = 0; n < N; ++n)
+        x[n] = amplitude * std::sin (2.0f * (float) M_PI * freq * (float) n / fs);
+    return x;
+}
+
+/** Magnitude of the DFT of x[start, end) at a frequency (with a Hann window) */
+float magnitude_at (const std::vector<float>& x, size_t start, float freq)
+{
+    const auto N = x.size() - start;
+    double re = 0.0;
+    double im = 0.0;
+    for (size_t n = 0; n < N; ++n)
+    {
+        const auto window = 0.5 - 0.5 * std::cos (2.0 * M_PI * (double) n / (double) N);
+        const auto phase = 2.0 * M_PI * (double) freq * (double) n / (double) fs;
+        re += window * (double) x[start + n] * std::cos (phase);
+        im += window * (double) x[start + n] * std::sin (phase);
+    }
+    return (float) (4.0 * std::sqrt (re * re + im * im) / (double) N);
+}
+} // namespace
+
+TEST_CASE ("Oversampled Nonlinearity Test")
+{
+    static constexpr size_t N = 8192;
+
+    SECTION ("Identity and Latency")
+    {
+        for (auto phase : { math_approx::oversampling_phase::linear, math_approx::oversampling_phase::low_latency })
+        {
+            for (int factor : { 1, 2, 4, 8 })
+            {
+                math_approx::oversampled_nonlinearity<float> processor;
+                processor.prepare (factor, 256, phase);
+                REQUIRE (processor.oversampling_factor() == factor);
+
+                static constexpr float freq = 100.0f;
+                const auto x = make_sine (freq, 0.5f, N);
+                std::vector<float> y (N);
+                processor.process (x.data(), y.data(), N, [] (auto v)
+                                   { return v; });
+
+                const auto latency = processor.latency();
+                float max_error = 0.0f;
+                for (size_t n = 1000; n < N; ++n)
+                {
+                    const auto expected = 0.5f * std::sin (2.0f * (float) M_PI * freq * ((float) n - latency) / fs);
+                    max_error = std::max (max_error, std::abs (y[n] - expected));
+                }
+                std::cout << factor << "x, latency: " << latency << ", error: " << max_error << std::endl;
+                REQUIRE (max_error < 1.0e-4f);
+            }
+        }
+    }
+
+    SECTION ("Latency")
+    {
+        math_approx::oversampled_nonlinearity<float> linear;
+        math_approx::oversampled_nonlinearity<float> low_latency;
+        for (int factor : { 2, 4, 8 })
+        {
+            linear.prepare (factor, 64, math_approx::oversampling_phase::linear);
+            low_latency.prepare (factor, 64, math_approx::oversampling_phase::low_latency);
+            REQUIRE (low_latency.latency() < 0.25f * linear.latency());
+        }
+        linear.prepare (2, 64, math_approx::oversampling_phase::linear);
+        REQUIRE (linear.latency() == 55.0f);
+    }
+
+    SECTION ("Aliasing")
+    {
+        // a 7 kHz sine through tanh has harmonics at 21, 35, 49... kHz,
+        // which (without oversampling) alias to 13 kHz, 1 kHz, etc.
+        const auto x = make_sine (7000.0f, 4.0f, N);
+        const auto measure_aliasing = [&x] (int factor, math_approx::oversampling_phase phase)
+        {
+            math_approx::oversampled_nonlinearity<float> processor;
+            processor.prepare (factor, 512, phase);
+            std::vector<float> y (N);
+            processor.process (x.data(), y.data(), N, [] (auto v)
+                               { return math_approx::tanh<5> (v); });
+            return std::max (magnitude_at (y, 1024, 13000.0f), magnitude_at (y, 1024, 1000.0f));
+        };
+
+        const auto alias_1x = measure_aliasing (1, math_approx::oversampling_phase::linear);
+        for (auto phase : { math_approx::oversampling_phase::linear, math_approx::oversampling_phase::low_latency })
+        {
+            const auto alias_2x = measure_aliasing (2, phase);
+            const auto alias_4x = measure_aliasing (4, phase);
+            const auto alias_8x = measure_aliasing (8, phase);
+            std::cout << alias_1x << ", " << alias_2x << ", " << alias_4x << ", " << alias_8x << std::endl;
+            REQUIRE (alias_2x < 1.0e-4f * alias_1x);
+            REQUIRE (alias_4x < 1.0e-4f * alias_1x);
+            REQUIRE (alias_8x < 1.0e-4f * alias_1x);
+        }
+    }
+
+    SECTION ("In-place and Block Sizes")
+    {
+        const auto x = make_sine (1000.0f, 2.0f, N);
+        const auto tanh_func = [] (auto v)
+        { return math_approx::tanh<5> (v); };
+
+        math_approx::oversampled_nonlinearity<float> processor;
+        processor.prepare (4, 128);
+        std::vector<float> y (N);
+        processor.process (x.data(), y.data(), N, tanh_func);
+
+        processor.reset();
+        auto z = x;
+        for (size_t n = 0; n < N;)
+        {
+            const auto block_size = std::min ((size_t) 37 + n % 91, N - n);
+            processor.process (z.data() + n, z.data() + n, block_size, tanh_func);
+            n += block_size;
+        }
+
+        for (size_t n = 0; n < N; ++n)
+            REQUIRE (std::abs (y[n] - z[n]) < 1.0e-6f);
+    }
+
+    SECTION ("Unprepared")
+    {
+        // before prepare(), the nonlinearity runs at the base sample rate
+        const auto x = make_sine (1000.0f, 2.0f, 100);
+        const auto tanh_func = [] (auto v)
+        { return math_approx::tanh<5> (v); };
+
+        math_approx::oversampled_nonlinearity<float> processor;
+        std::vector<float> y (x.size());
+        processor.process (x.data(), y.data(), x.size(), tanh_func);
+        REQUIRE (processor.oversampling_factor() == 1);
+        for (size_t n = 0; n < x.size(); ++n)
+            REQUIRE (y[n] == math_approx::tanh<5> (x[n]));
+    }
+}
@@ -0,0 +1,135 @@
+#include "test_helpers.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+
+#include <math_approx/math_approx.hpp>
+
+namespace
+{
+template <typename T, typename PhaseFunc>
+double max_phasor_error (const std::vector<T>& re, const std::vector<T>& im, PhaseFunc&& phase)
+{
+    double max_error = 0.0;
+    for (size_t n = 0; n < re.size(); ++n)
+    {
+        const auto phi = phase ((double) n);
+        max_error = std::max (max_error, std::abs (std::cos (2.0 * M_PI * phi) - (double) re[n]));
+        max_error = std::max (max_error, std::abs (std::sin (2.0 * M_PI * phi) - (double) im[n]));
+    }
+    return max_error;
+}
+} // namespace
+
+TEST_CASE ("Phasor Grid Test")
+{
+    static constexpr size_t N = 10'007;
+    static constexpr float start = 0.1f;
+    static constexpr float step = 0.0123f;
+    const auto phase = [] (double n)
+    { return (double) start + n * (double) step; };
+
+    std::vector<float> re (N);
+    std::vector<float> im (N);
+
+    SECTION ("Split")
+    {
+        math_approx::phasor_grid<9> (re.data(), im.data(), N, start, step);
+        const auto error = max_phasor_error (re, im, phase);
+        std::cout << error << std::endl;
+        REQUIRE (error < 2.0e-6);
+    }
+
+    SECTION ("Interleaved")
+    {
+        std::vector<float> re_im (2 * N);
+        math_approx::phasor_grid_interleaved<9> (re_im.data(), N, start, step);
+        for (size_t n = 0; n < N; ++n)
+        {
+            re[n] = re_im[2 * n];
+            im[n] = re_im[2 * n + 1];
+        }
+        const auto error = max_phasor_error (re, im, phase);
+        std::cout << error << std::endl;
+        REQUIRE (error < 2.0e-6);
+    }
+
+    SECTION ("Re-Seed Interval")
+    {
+        // without re-seeding, the error grows with the length of the grid
+        math_approx::phasor_grid<9> (re.data(), im.data(), N, start, step, N);
+        const auto error_no_reseed = max_phasor_error (re, im, phase);
+        math_approx::phasor_grid<9> (re.data(), im.data(), N, start, step, 4);
+        const auto error_reseed = max_phasor_error (re, im, phase);
+        std::cout << error_no_reseed << ", " << error_reseed << std::endl;
+        REQUIRE (error_reseed < error_no_reseed);
+        REQUIRE (error_reseed < 1.0e-6);
+    }
+}
+
+TEST_CASE ("Chirp Grid Test")
+{
+    // a linear sweep from 20 Hz to 20 kHz, over one second at 48 kHz
+    static constexpr size_t N = 48'000;
+    static constexpr float start_step = 20.0f / 48000.0f;
+    static constexpr float step_increment = (20000.0f - 20.0f) / 48000.0f / (float) N;
+    const auto phase = [] (double n)
+    { return n * (double) start_step + 0.5 * n * (n - 1.0) * (double) step_increment; };
+
+    std::vector<float> re (N);
+    std::vector<float> im (N);
+
+    SECTION ("Split")
+    {
+        math_approx::chirp_grid<9> (re.data(), im.data(), N, 0.0f, start_step, step_increment);
+        const auto error = max_phasor_error (re, im, phase);
+        std::cout << error << std::endl;
+        REQUIRE (error < 2.0e-6);
+    }
+
+    SECTION ("Interleaved")
+    {
+        std::vector<float> re_im (2 * N);
+        math_approx::chirp_grid_interleaved<9> (re_im.data(), N, 0.0f, start_step, step_increment);
+        for (size_t n = 0; n < N; ++n)
+        {
+            re[n] = re_im[2 * n];
+            im[n] = re_im[2 * n + 1];
+        }
+        const auto error = max_phasor_error (re, im, phase);
+        std::cout << error << std::endl;
+        REQUIRE (error < 2.0e-6);
+    }
+}
+
+TEST_CASE ("FFT Twiddles Test")
+{
+    static constexpr size_t fft_size = 4096;
+    const auto phase = [] (double k)
+    { return -k / (double) fft_size; };
+
+    SECTION ("Float")
+    {
+        std::vector<float> re (fft_size / 2);
+        std::vector<float> im (fft_size / 2);
+        math_approx::fft_twiddles<9> (re.data(), im.data(), fft_size);
+        const auto error = max_phasor_error (re, im, phase);
+        std::cout << error << std::endl;
+        REQUIRE (error < 2.0e-6);
+    }
+
+    SECTION ("Double")
+    {
+        std::vector<double> re_im (fft_size);
+        math_approx::fft_twiddles_interleaved<11> (re_im.data(), fft_size);
+        std::vector<double> re (fft_size / 2);
+        std::vector<double> im (fft_size / 2);
+        for (size_t k = 0; k < fft_size / 2; ++k)
+        {
+            re[k] = re_im[2 * k];
+            im[k] = re_im[2 * k + 1];
+        }
+        const auto error = max_phasor_error (re, im, phase);
+        std::cout << error << std::endl;
+        REQUIRE (error < 1.0e-6);
+    }
+}
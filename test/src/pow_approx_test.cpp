@@ -39,6 +39,13 @@ TEMPLATE_TEST_CASE ("Exp Approx Test", "", float, double)
                                                                   return std::exp (x);
                                                               });
 
+    SECTION ("7th-Order")
+    {
+        test_approx<TestType> (all_floats, y_exact, [] (auto x)
+                               { return math_approx::exp<7> (x); },
+                               7.0e-7f,
+                               10);
+    }
     SECTION ("6th-Order")
     {
         test_approx<TestType> (all_floats, y_exact, [] (auto x)
@@ -120,6 +127,13 @@ TEMPLATE_TEST_CASE ("Exp2 Approx Test", "", float, double)
                                                                   return std::exp2 (x);
                                                               });
 
+    SECTION ("7th-Order")
+    {
+        test_approx<TestType> (all_floats, y_exact, [] (auto x)
+                               { return math_approx::exp2<7> (x); },
+                               3.0e-7f,
+                               4);
+    }
     SECTION ("6th-Order")
     {
         test_approx<TestType> (all_floats, y_exact, [] (auto x)
@@ -272,3 +286,73 @@ TEMPLATE_TEST_CASE ("Exp10 Approx Test", "", float, double)
                                0);
     }
 }
+
+TEST_CASE ("Exp2 Approx Test (double)")
+{
+    const auto test_approx = [] (auto&& f_exact, auto&& f_approx, double err_bound)
+    {
+        static constexpr int num_points = 1'000'000;
+        double max_error = 0.0;
+        for (int i = 0; i <= num_points; ++i)
+        {
+            const auto x = -20.0 + (20.0 - -20.0) * (double) i / (double) num_points;
+            max_error = std::max (max_error, std::abs ((f_exact (x) - f_approx (x)) / f_exact (x)));
+        }
+
+        std::cout << max_error << std::endl;
+        REQUIRE (max_error < err_bound);
+    };
+
+    SECTION ("10th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::exp2 (x); },
+                     [] (double x)
+                     { return math_approx::exp2<10> (x); },
+                     1.0e-15);
+        test_approx ([] (double x)
+                     { return std::exp (x); },
+                     [] (double x)
+                     { return math_approx::exp<10> (x); },
+                     2.5e-15); // includes the rounding error from scaling x by log2(e)
+    }
+    SECTION ("9th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::exp2 (x); },
+                     [] (double x)
+                     { return math_approx::exp2<9> (x); },
+                     2.0e-14);
+        test_approx ([] (double x)
+                     { return std::exp (x); },
+                     [] (double x)
+                     { return math_approx::exp<9> (x); },
+                     2.0e-14);
+    }
+    SECTION ("8th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::exp2 (x); },
+                     [] (double x)
+                     { return math_approx::exp2<8> (x); },
+                     1.0e-12);
+        test_approx ([] (double x)
+                     { return std::exp (x); },
+                     [] (double x)
+                     { return math_approx::exp<8> (x); },
+                     1.0e-12);
+    }
+    SECTION ("7th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::exp2 (x); },
+                     [] (double x)
+                     { return math_approx::exp2<7> (x); },
+                     6.0e-11);
+        test_approx ([] (double x)
+                     { return std::exp (x); },
+                     [] (double x)
+                     { return math_approx::exp<7> (x); },
+                     6.0e-11);
+    }
+}
@@ -0,0 +1,144 @@
+#include "test_helpers.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+#include <random>
+
+#include <math_approx/math_approx.hpp>
+
+template <typename Q>
+void test_table (math_approx::quantization_params in_params,
+                 math_approx::quantization_params out_params,
+                 auto&& f_approx,
+                 auto&& f_exact,
+                 int max_error_steps)
+{
+    using U = std::make_unsigned_t<Q>;
+    constexpr size_t table_size = (size_t) std::numeric_limits<U>::max() + 1;
+
+    std::vector<Q> table (table_size);
+    math_approx::build_activation_table (table.data(), in_params, out_params, f_approx);
+
+    int max_error = 0;
+    for (size_t i = 0; i < table_size; ++i)
+    {
+        const auto q = static_cast<Q> (static_cast<U> (i));
+        const auto x = in_params.scale * (float) ((int32_t) q - in_params.zero_point);
+        const auto y_exact = (int32_t) std::nearbyint (f_exact (x) / out_params.scale) + out_params.zero_point;
+        const auto y_exact_clamped = std::clamp (y_exact, (int32_t) std::numeric_limits<Q>::min(), (int32_t) std::numeric_limits<Q>::max());
+        max_error = std::max (max_error, std::abs ((int32_t) table[i] - y_exact_clamped));
+    }
+
+    std::cout << max_error << std::endl;
+    REQUIRE (max_error <= max_error_steps);
+
+    std::minstd_rand rng { 0x1234 };
+    std::uniform_int_distribution<int32_t> dist { std::numeric_limits<Q>::min(), std::numeric_limits<Q>::max() };
+    for (const auto N : { (size_t) 1, (size_t) 15, (size_t) 64, (size_t) 1003 })
+    {
+        std::vector<Q> x (N);
+        for (auto& q : x)
+            q = static_cast<Q> (dist (rng));
+
+        std::vector<Q> y (N);
+        math_approx::apply_activation_table (table.data(), x.data(), y.data(), N);
+        for (size_t n = 0; n < N; ++n)
+            REQUIRE (y[n] == table[static_cast<U> (x[n])]);
+    }
+}
+
+TEST_CASE ("Quantized Activation Table Test")
+{
+    const auto tanh_exact = [] (float x)
+    { return std::tanh (x); };
+    const auto sigmoid_exact = [] (float x)
+    { return 1.0f / (1.0f + std::exp (-x)); };
+
+    SECTION ("int8 tanh")
+    {
+        test_table<int8_t> ({ 4.0f / 128.0f, 0 }, { 1.0f / 127.0f, 0 }, [] (auto x)
+                            { return math_approx::tanh<5> (x); },
+                            tanh_exact,
+                            1);
+    }
+    SECTION ("uint8 sigmoid")
+    {
+        test_table<uint8_t> ({ 0.05f, 128 }, { 1.0f / 256.0f, 0 }, [] (auto x)
+                             { return math_approx::sigmoid<7> (x); },
+                             sigmoid_exact,
+                             1);
+    }
+    SECTION ("int8 exp")
+    {
+        test_table<int8_t> ({ 1.0f / 32.0f, 64 }, { 1.0f / 128.0f, -128 }, [] (auto x)
+                            { return math_approx::exp<5> (x); },
+                            [] (float x)
+                            { return std::exp (x); },
+                            1);
+    }
+    SECTION ("int16 tanh")
+    {
+        test_table<int16_t> ({ 8.0f / 32768.0f, 0 }, { 1.0f / 32767.0f, 0 }, [] (auto x)
+                             { return math_approx::tanh<7> (x); },
+                             tanh_exact,
+                             2);
+    }
+    SECTION ("uint16 sigmoid (exp)")
+    {
+        test_table<uint16_t> ({ 16.0f / 65536.0f, 32768 }, { 1.0f / 65536.0f, 0 }, [] (auto x)
+                              { return math_approx::sigmoid_exp<5> (x); },
+                              sigmoid_exact,
+                              1);
+    }
+}
+
+TEST_CASE ("Quantized Activation Table Non-Finite Test")
+{
+    using math_approx::special_value_policy;
+
+    SECTION ("Inf and NaN")
+    {
+        // log(x < 0) = NaN, log(0) = -Inf
+        std::vector<int8_t> table (256);
+        math_approx::build_activation_table (table.data(), { 1.0f, 0 }, { 1.0f / 16.0f, 3 }, [] (auto x)
+                                             { return math_approx::log<5, false, decltype (x), special_value_policy::ieee> (x); });
+        REQUIRE (table[(uint8_t) -1] == 3);
+        REQUIRE (table[(uint8_t) -128] == 3);
+        REQUIRE (table[0] == -128);
+        REQUIRE (table[1] == 3);
+        REQUIRE (table[64] == 70); // log(64) * 16 + 3 = 69.54
+
+        // exp(x > 88.7) = Inf
+        math_approx::build_activation_table (table.data(), { 1.0f, 0 }, { 1.0f, -128 }, [] (auto x)
+                                             { return math_approx::exp<5, false, true, decltype (x), special_value_policy::ieee> (x); });
+        REQUIRE (table[100] == 127);
+        REQUIRE (table[127] == 127);
+        REQUIRE (table[(uint8_t) -128] == -128);
+    }
+
+    SECTION ("Out of Range")
+    {
+        std::vector<uint16_t> table (65536);
+        math_approx::build_activation_table (table.data(), { 1.0f, 32768 }, { 1.0e-30f, 100 }, [] (auto x)
+                                             { return x; });
+        REQUIRE (table[32768] == 100);
+        REQUIRE (table[32769] == 65535);
+        REQUIRE (table[0] == 0);
+    }
+}
+
+TEST_CASE ("Quantized Activation Table Lookup Edges")
+{
+    // the first and last table entries are the ones most likely to be read out-of-bounds
+    std::vector<uint16_t> table (65536);
+    for (size_t i = 0; i < table.size(); ++i)
+        table[i] = static_cast<uint16_t> (i ^ 0x5A5A);
+
+    std::vector<int16_t> x (37);
+    for (size_t n = 0; n < x.size(); ++n)
+        x[n] = (n % 3 == 0) ? int16_t { -1 } : (n % 3 == 1) ? std::numeric_limits<int16_t>::min() : static_cast<int16_t> (n % 2 == 0 ? 0 : 32767);
+
+    std::vector<int16_t> y (x.size());
+    math_approx::apply_activation_table (reinterpret_cast<const int16_t*> (table.data()), x.data(), y.data(), x.size());
+    for (size_t n = 0; n < x.size(); ++n)
+        REQUIRE (static_cast<uint16_t> (y[n]) == table[static_cast<uint16_t> (x[n])]);
+}
@@ -0,0 +1,151 @@
+#include "test_helpers.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+
+#include <math_approx/math_approx.hpp>
+
+namespace
+{
+constexpr size_t N = 200'000;
+
+struct moments
+{
+    double mean;
+    double variance;
+};
+
+moments compute_moments (const std::vector<float>& x)
+{
+    double sum = 0.0;
+    for (auto v : x)
+        sum += (double) v;
+    const auto mean = sum / (double) x.size();
+
+    double sum_sq = 0.0;
+    for (auto v : x)
+        sum_sq += ((double) v - mean) * ((double) v - mean);
+    return { mean, sum_sq / (double) (x.size() - 1) };
+}
+
+/** Kolmogorov-Smirnov statistic of the samples against a CDF */
+template <typename CDF>
+double ks_statistic (std::vector<float> x, CDF&& cdf)
+{
+    std::sort (x.begin(), x.end());
+    double d = 0.0;
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        const auto F = cdf ((double) x[i]);
+        d = std::max (d, std::max (F - (double) i / (double) x.size(), (double) (i + 1) / (double) x.size() - F));
+    }
+    return d;
+}
+
+// KS critical value at the 0.1% significance level
+const auto ks_critical = 1.95 / std::sqrt ((double) N);
+} // namespace
+
+TEST_CASE ("Random Variates Test")
+{
+    math_approx::random_variate_engine engine { 1234 };
+    std::vector<float> x (N);
+
+    SECTION ("Uniform")
+    {
+        engine.uniform (x.data(), N, -1.0f, 3.0f);
+        for (auto v : x)
+            REQUIRE ((v >= -1.0f && v < 3.0f));
+
+        const auto m = compute_moments (x);
+        const auto ks = ks_statistic (x, [] (double v)
+                                      { return (v + 1.0) / 4.0; });
+        std::cout << m.mean << ", " << m.variance << ", " << ks << std::endl;
+        REQUIRE (std::abs (m.mean - 1.0) < 0.02);
+        REQUIRE (std::abs (m.variance - 16.0 / 12.0) < 0.02);
+        REQUIRE (ks < ks_critical);
+    }
+
+    SECTION ("Normal")
+    {
+        engine.normal (x.data(), N, 1.0f, 2.0f);
+        const auto m = compute_moments (x);
+        const auto ks = ks_statistic (x, [] (double v)
+                                      { return 0.5 * std::erfc (-(v - 1.0) / (2.0 * std::sqrt (2.0))); });
+        std::cout << m.mean << ", " << m.variance << ", " << ks << std::endl;
+        REQUIRE (std::abs (m.mean - 1.0) < 0.03);
+        REQUIRE (std::abs (m.variance - 4.0) < 0.06);
+        REQUIRE (ks < ks_critical);
+    }
+
+    SECTION ("Exponential")
+    {
+        engine.exponential (x.data(), N, 2.0f);
+        for (auto v : x)
+            REQUIRE (v >= 0.0f);
+
+        const auto m = compute_moments (x);
+        const auto ks = ks_statistic (x, [] (double v)
+                                      { return 1.0 - std::exp (-2.0 * v); });
+        std::cout << m.mean << ", " << m.variance << ", " << ks << std::endl;
+        REQUIRE (std::abs (m.mean - 0.5) < 0.01);
+        REQUIRE (std::abs (m.variance - 0.25) < 0.01);
+        REQUIRE (ks < ks_critical);
+    }
+
+    SECTION ("Cauchy")
+    {
+        // the Cauchy distribution has no mean or variance, so we only check the KS statistic
+        engine.cauchy (x.data(), N, -1.0f, 0.5f);
+        for (auto v : x)
+            REQUIRE (std::isfinite (v));
+
+        const auto ks = ks_statistic (x, [] (double v)
+                                      { return 0.5 + std::atan ((v + 1.0) / 0.5) / M_PI; });
+        std::cout << ks << std::endl;
+        REQUIRE (ks < ks_critical);
+    }
+
+    SECTION ("Seeding")
+    {
+        std::vector<float> y (N);
+        engine.seed (42);
+        engine.normal (x.data(), 1001);
+        engine.seed (42);
+        engine.normal (y.data(), 1001);
+        REQUIRE (std::equal (x.begin(), x.begin() + 1001, y.begin()));
+
+        engine.seed (43);
+        engine.normal (y.data(), 1001);
+        REQUIRE (! std::equal (x.begin(), x.begin() + 1001, y.begin()));
+    }
+}
+
+TEST_CASE ("Random Variates Endpoints Test")
+{
+    namespace random_detail = math_approx::random_detail;
+    const auto first_lane = [] (random_detail::float_vector x)
+    {
+#if defined(XSIMD_HPP)
+        return x.get (0);
+#else
+        return x;
+#endif
+    };
+
+    // the all-zero and all-one bit patterns give the extreme values of u
+    const auto u_low = first_lane (random_detail::minus_half_to_half (random_detail::uint_vector (0u)));
+    const auto u_high = first_lane (random_detail::minus_half_to_half (random_detail::uint_vector (0xffffffffu)));
+    REQUIRE (u_low > -0.5f);
+    REQUIRE (u_high < 0.5f);
+    REQUIRE (u_low == -u_high);
+    REQUIRE (first_lane (random_detail::minus_half_to_half (random_detail::uint_vector (0x1ffu))) == u_low);
+
+    // so the Cauchy variates are finite, with the correct sign
+    const auto y_low = math_approx::tan_mhalfpi_halfpi<9> ((float) M_PI * u_low);
+    const auto y_high = math_approx::tan_mhalfpi_halfpi<9> ((float) M_PI * u_high);
+    std::cout << y_low << ", " << y_high << std::endl;
+    REQUIRE (std::isfinite (y_low));
+    REQUIRE (std::isfinite (y_high));
+    REQUIRE (y_low < -1.0e6f);
+    REQUIRE (y_high > 1.0e6f);
+}
@@ -0,0 +1,119 @@
+#include "test_helpers.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+#include <random>
+
+#include <math_approx/math_approx.hpp>
+
+namespace
+{
+std::vector<float> make_random_data (size_t N, float range, unsigned seed)
+{
+    std::minstd_rand rng { seed };
+    std::uniform_real_distribution<float> dist { -range, range };
+    std::vector<float> x (N);
+    for (auto& v : x)
+        v = dist (rng);
+    return x;
+}
+
+float sigmoid_exact (float x)
+{
+    return 1.0f / (1.0f + std::exp (-x));
+}
+} // namespace
+
+TEST_CASE ("LSTM Cell Test")
+{
+    const auto test_lstm = [] (size_t N, auto&& lstm_approx, float err_bound)
+    {
+        const auto gates = make_random_data (4 * N, 6.0f, 1);
+        const auto c_init = make_random_data (N, 3.0f, 2);
+
+        auto c_exact = c_init;
+        std::vector<float> h_exact (N);
+        for (size_t n = 0; n < N; ++n)
+        {
+            const auto i = sigmoid_exact (gates[n]);
+            const auto f = sigmoid_exact (gates[N + n]);
+            const auto g = std::tanh (gates[2 * N + n]);
+            const auto o = sigmoid_exact (gates[3 * N + n]);
+            c_exact[n] = f * c_exact[n] + i * g;
+            h_exact[n] = o * std::tanh (c_exact[n]);
+        }
+
+        auto c_approx = c_init;
+        std::vector<float> h_approx (N);
+        lstm_approx (gates.data(), c_approx.data(), h_approx.data(), N);
+
+        const auto c_error = test_helpers::abs_max<float> (test_helpers::compute_error<float> (c_exact, c_approx));
+        const auto h_error = test_helpers::abs_max<float> (test_helpers::compute_error<float> (h_exact, h_approx));
+        std::cout << c_error << ", " << h_error << std::endl;
+        REQUIRE (std::abs (c_error) < err_bound);
+        REQUIRE (std::abs (h_error) < err_bound);
+    };
+
+    SECTION ("Order 9/11")
+    {
+        test_lstm (259, [] (auto&&... args)
+                   { math_approx::lstm_cell<9, 11> (args...); },
+                   2.0e-6f);
+    }
+    SECTION ("Order 7/7")
+    {
+        test_lstm (259, [] (auto&&... args)
+                   { math_approx::lstm_cell<7, 7> (args...); },
+                   5.0e-5f);
+    }
+    SECTION ("Order 5/5")
+    {
+        test_lstm (64, [] (auto&&... args)
+                   { math_approx::lstm_cell<5, 5> (args...); },
+                   1.0e-3f);
+    }
+}
+
+TEST_CASE ("GRU Cell Test")
+{
+    const auto test_gru = [] (size_t N, auto&& gru_approx, float err_bound)
+    {
+        const auto x_gates = make_random_data (3 * N, 4.0f, 3);
+        const auto h_gates = make_random_data (3 * N, 4.0f, 4);
+        const auto h_init = make_random_data (N, 1.0f, 5);
+
+        auto h_exact = h_init;
+        for (size_t n = 0; n < N; ++n)
+        {
+            const auto r = sigmoid_exact (x_gates[n] + h_gates[n]);
+            const auto z = sigmoid_exact (x_gates[N + n] + h_gates[N + n]);
+            const auto n_gate = std::tanh (x_gates[2 * N + n] + r * h_gates[2 * N + n]);
+            h_exact[n] = (1.0f - z) * n_gate + z * h_exact[n];
+        }
+
+        auto h_approx = h_init;
+        gru_approx (x_gates.data(), h_gates.data(), h_approx.data(), N);
+
+        const auto h_error = test_helpers::abs_max<float> (test_helpers::compute_error<float> (h_exact, h_approx));
+        std::cout << h_error << std::endl;
+        REQUIRE (std::abs (h_error) < err_bound);
+    };
+
+    SECTION ("Order 9/11")
+    {
+        test_gru (259, [] (auto&&... args)
+                  { math_approx::gru_cell<9, 11> (args...); },
+                  2.0e-6f);
+    }
+    SECTION ("Order 7/7")
+    {
+        test_gru (259, [] (auto&&... args)
+                  { math_approx::gru_cell<7, 7> (args...); },
+                  5.0e-5f);
+    }
+    SECTION ("Order 5/5")
+    {
+        test_gru (64, [] (auto&&... args)
+                  { math_approx::gru_cell<5, 5> (args...); },
+                  1.0e-3f);
+    }
+}
@@ -0,0 +1,133 @@
+#include "test_helpers.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+#include <random>
+
+#include <math_approx/math_approx.hpp>
+
+namespace
+{
+std::vector<float> make_random_data (size_t N, unsigned seed)
+{
+    std::minstd_rand rng { seed };
+    std::uniform_real_distribution<float> dist { -1.0f, 1.0f };
+    std::vector<float> x (N);
+    for (auto& v : x)
+        v = dist (rng);
+    return x;
+}
+
+double exact_angle (size_t i, size_t head_dim, size_t position)
+{
+    return (double) position * std::pow (10000.0, -(double) (2 * i) / (double) head_dim);
+}
+} // namespace
+
+TEST_CASE ("RoPE Frequencies Test")
+{
+    static constexpr size_t head_dim = 128;
+    std::vector<float> freqs (head_dim / 2);
+    math_approx::rope_frequencies (freqs.data(), head_dim);
+
+    for (size_t i = 0; i < freqs.size(); ++i)
+    {
+        const auto exact = exact_angle (i, head_dim, 1) / (2.0 * M_PI);
+        REQUIRE (std::abs ((double) freqs[i] - exact) / exact < 1.0e-6);
+    }
+}
+
+TEST_CASE ("RoPE Angles Test")
+{
+    static constexpr size_t head_dim = 96;
+    static constexpr size_t num_freqs = head_dim / 2;
+    std::vector<float> freqs (num_freqs);
+    math_approx::rope_frequencies (freqs.data(), head_dim);
+
+    const auto test_angles = [&] (size_t start_position, size_t num_positions, float err_bound)
+    {
+        std::vector<float> cos_table (num_freqs * num_positions);
+        std::vector<float> sin_table (num_freqs * num_positions);
+        math_approx::rope_table (freqs.data(), cos_table.data(), sin_table.data(), num_freqs, start_position, num_positions);
+
+        float max_error = 0.0f;
+        for (size_t p = 0; p < num_positions; ++p)
+        {
+            for (size_t i = 0; i < num_freqs; ++i)
+            {
+                const auto angle = exact_angle (i, head_dim, start_position + p);
+                max_error = std::max (max_error, (float) std::abs (std::cos (angle) - (double) cos_table[p * num_freqs + i]));
+                max_error = std::max (max_error, (float) std::abs (std::sin (angle) - (double) sin_table[p * num_freqs + i]));
+            }
+        }
+        std::cout << max_error << std::endl;
+        REQUIRE (max_error < err_bound);
+    };
+
+    SECTION ("Short Positions")
+    {
+        test_angles (0, 64, 1.0e-5f);
+    }
+    SECTION ("Long Positions")
+    {
+        // the angle itself is only float-precise, so the error grows with position
+        test_angles (4000, 64, 2.0e-3f);
+    }
+    SECTION ("Incremental Matches Table")
+    {
+        std::vector<float> cos_table (num_freqs * 16), sin_table (num_freqs * 16);
+        math_approx::rope_table (freqs.data(), cos_table.data(), sin_table.data(), num_freqs, 100, 16);
+
+        std::vector<float> cos_row (num_freqs), sin_row (num_freqs);
+        math_approx::rope_angles (freqs.data(), cos_row.data(), sin_row.data(), num_freqs, 115);
+        for (size_t i = 0; i < num_freqs; ++i)
+        {
+            REQUIRE (cos_row[i] == cos_table[15 * num_freqs + i]);
+            REQUIRE (sin_row[i] == sin_table[15 * num_freqs + i]);
+        }
+    }
+}
+
+TEST_CASE ("RoPE Apply Test")
+{
+    static constexpr size_t head_dim = 72;
+    static constexpr size_t num_heads = 3;
+    static constexpr size_t num_freqs = head_dim / 2;
+    static constexpr size_t position = 37;
+
+    std::vector<float> freqs (num_freqs), cos_row (num_freqs), sin_row (num_freqs);
+    math_approx::rope_frequencies (freqs.data(), head_dim);
+    math_approx::rope_angles (freqs.data(), cos_row.data(), sin_row.data(), num_freqs, position);
+
+    const auto x = make_random_data (head_dim * num_heads, 6);
+    const auto test_rope = [&] (auto layout, size_t pair_stride, size_t pair_offset)
+    {
+        auto y = x;
+        math_approx::apply_rope<decltype (layout)::value> (y.data(), cos_row.data(), sin_row.data(), head_dim, num_heads);
+
+        float max_error = 0.0f;
+        for (size_t h = 0; h < num_heads; ++h)
+        {
+            for (size_t i = 0; i < num_freqs; ++i)
+            {
+                const auto idx1 = h * head_dim + i * pair_stride;
+                const auto idx2 = idx1 + pair_offset;
+                const auto angle = exact_angle (i, head_dim, position);
+                const auto y1 = (double) x[idx1] * std::cos (angle) - (double) x[idx2] * std::sin (angle);
+                const auto y2 = (double) x[idx2] * std::cos (angle) + (double) x[idx1] * std::sin (angle);
+                max_error = std::max (max_error, (float) std::abs (y1 - (double) y[idx1]));
+                max_error = std::max (max_error, (float) std::abs (y2 - (double) y[idx2]));
+            }
+        }
+        std::cout << max_error << std::endl;
+        REQUIRE (max_error < 1.0e-5f);
+    };
+
+    SECTION ("Split Layout")
+    {
+        test_rope (std::integral_constant<math_approx::rope_layout, math_approx::rope_layout::split> {}, 1, num_freqs);
+    }
+    SECTION ("Interleaved Layout")
+    {
+        test_rope (std::integral_constant<math_approx::rope_layout, math_approx::rope_layout::interleaved> {}, 2, 1);
+    }
+}
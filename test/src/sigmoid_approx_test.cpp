@@ -116,3 +116,61 @@ TEST_CASE ("Sigmoid (Exp) Approx Test")
                      0);
     }
 }
+
+TEST_CASE ("Sigmoid Approx Test (double)")
+{
+    const auto test_approx = [] (auto&& f_exact, auto&& f_approx, double err_bound)
+    {
+        static constexpr int num_points = 1'000'000;
+        double max_error = 0.0;
+        for (int i = 0; i <= num_points; ++i)
+        {
+            const auto x = -40.0 + (40.0 - -40.0) * (double) i / (double) num_points;
+            max_error = std::max (max_error, std::abs (f_exact (x) - f_approx (x)));
+        }
+
+        std::cout << max_error << std::endl;
+        REQUIRE (max_error < err_bound);
+    };
+
+    SECTION ("19th-Order")
+    {
+        test_approx ([] (double x)
+                     { return 1.0 / (1.0 + std::exp (-x)); },
+                     [] (double x)
+                     { return math_approx::sigmoid<19> (x); },
+                     7.0e-13);
+    }
+    SECTION ("17th-Order")
+    {
+        test_approx ([] (double x)
+                     { return 1.0 / (1.0 + std::exp (-x)); },
+                     [] (double x)
+                     { return math_approx::sigmoid<17> (x); },
+                     1.0e-11);
+    }
+    SECTION ("15th-Order")
+    {
+        test_approx ([] (double x)
+                     { return 1.0 / (1.0 + std::exp (-x)); },
+                     [] (double x)
+                     { return math_approx::sigmoid<15> (x); },
+                     1.5e-10);
+    }
+    SECTION ("13th-Order")
+    {
+        test_approx ([] (double x)
+                     { return 1.0 / (1.0 + std::exp (-x)); },
+                     [] (double x)
+                     { return math_approx::sigmoid<13> (x); },
+                     2.5e-9);
+    }
+    SECTION ("11th-Order")
+    {
+        test_approx ([] (double x)
+                     { return 1.0 / (1.0 + std::exp (-x)); },
+                     [] (double x)
+                     { return math_approx::sigmoid<11> (x); },
+                     3.5e-8);
+    }
+}
@@ -0,0 +1,268 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <limits>
+#include <math_approx/math_approx.hpp>
+
+namespace
+{
+using math_approx::special_value_policy;
+constexpr auto saturate = special_value_policy::saturate;
+constexpr auto ieee = special_value_policy::ieee;
+constexpr auto flush = special_value_policy::flush_denormals;
+
+template <typename T>
+const auto special_inputs = std::array<T, 12> {
+    (T) 0,
+    (T) -0.0,
+    (T) 1,
+    (T) -1,
+    (T) 2,
+    (T) -2,
+    (T) 1.0e6,
+    (T) -1.0e6,
+    std::numeric_limits<T>::denorm_min(),
+    std::numeric_limits<T>::max(),
+    std::numeric_limits<T>::infinity(),
+    -std::numeric_limits<T>::infinity(),
+};
+
+template <typename T>
+bool is_close (T actual, T expected, T rel_err_bound)
+{
+    return std::abs ((actual - expected) / expected) < rel_err_bound;
+}
+
+template <typename T, typename Func>
+void check_always_finite (Func&& func)
+{
+    for (auto x : special_inputs<T>)
+        REQUIRE (std::isfinite (func (x)));
+    REQUIRE (std::isfinite (func (std::numeric_limits<T>::quiet_NaN())));
+}
+} // namespace
+
+TEMPLATE_TEST_CASE ("Special Values: Exp", "", float, double)
+{
+    using T = TestType;
+    using limits = std::numeric_limits<T>;
+    const auto big = (T) (std::is_same_v<T, float> ? 200 : 1000);
+
+    SECTION ("IEEE")
+    {
+        REQUIRE (math_approx::exp<6, false, true, T, ieee> (big) == limits::infinity());
+        REQUIRE (math_approx::exp<6, false, true, T, ieee> (limits::infinity()) == limits::infinity());
+        REQUIRE (math_approx::exp<6, false, true, T, ieee> (-limits::infinity()) == (T) 0);
+        REQUIRE (math_approx::exp<6, false, true, T, ieee> (-big) == (T) 0);
+        REQUIRE (std::isnan (math_approx::exp<6, false, true, T, ieee> (limits::quiet_NaN())));
+        REQUIRE (math_approx::exp2<6, false, true, T, ieee> ((T) limits::max_exponent) == limits::infinity());
+        REQUIRE (math_approx::exp<6, false, true, T, ieee> ((T) 1) == math_approx::exp<6> ((T) 1));
+
+        // subnormal results
+        for (auto x2 : { (T) limits::min_exponent - (T) 1.5, (T) limits::min_exponent - (T) 10.25, (T) limits::min_exponent - (T) 20.75 })
+        {
+            const auto expected = std::exp2 (x2);
+            const auto actual = math_approx::exp2<6, false, true, T, ieee> (x2);
+            REQUIRE (actual > (T) 0);
+            REQUIRE (actual < limits::min());
+            REQUIRE (std::abs (actual - expected) <= (T) 1.0e-6 * expected + limits::denorm_min());
+        }
+    }
+
+    SECTION ("Flush Denormals")
+    {
+        REQUIRE (math_approx::exp<6, false, true, T, flush> (big) == limits::infinity());
+        REQUIRE (std::isnan (math_approx::exp<6, false, true, T, flush> (limits::quiet_NaN())));
+        REQUIRE (math_approx::exp<6, false, true, T, flush> ((T) 1) == math_approx::exp<6> ((T) 1));
+
+        // results below the smallest normal number are flushed to zero
+        for (auto x2 : { (T) limits::min_exponent - (T) 1.001, (T) limits::min_exponent - (T) 1.5, (T) limits::min_exponent - (T) 20.75, -limits::infinity() })
+            REQUIRE (math_approx::exp2<6, false, true, T, flush> (x2) == (T) 0);
+
+        // the smallest normal number itself is kept
+        REQUIRE (math_approx::exp2<6, false, true, T, flush> ((T) limits::min_exponent - (T) 1) == limits::min());
+        for (auto x2 : { (T) limits::min_exponent - (T) 0.999, (T) limits::min_exponent - (T) 0.5, (T) limits::min_exponent })
+        {
+            const auto y = math_approx::exp2<6, false, true, T, flush> (x2);
+            REQUIRE (y >= limits::min());
+            REQUIRE (is_close<T> (y, std::exp2 (x2), (T) 1.0e-6));
+        }
+    }
+
+    SECTION ("Saturate")
+    {
+        check_always_finite<T> ([] (T x)
+                                { return math_approx::exp<6, false, true, T, saturate> (x); });
+        check_always_finite<T> ([] (T x)
+                                { return math_approx::exp10<6, false, true, T, saturate> (x); });
+        REQUIRE (math_approx::exp<6, false, true, T, saturate> (big) > limits::max() / (T) 2);
+        REQUIRE (math_approx::exp<6, false, true, T, saturate> ((T) 1) == math_approx::exp<6> ((T) 1));
+    }
+}
+
+TEMPLATE_TEST_CASE ("Special Values: Log", "", float, double)
+{
+    using T = TestType;
+    using limits = std::numeric_limits<T>;
+
+    SECTION ("IEEE")
+    {
+        REQUIRE (math_approx::log<6, false, T, ieee> ((T) 0) == -limits::infinity());
+        REQUIRE (math_approx::log<6, false, T, ieee> ((T) -0.0) == -limits::infinity());
+        REQUIRE (std::isnan (math_approx::log<6, false, T, ieee> ((T) -1)));
+        REQUIRE (std::isnan (math_approx::log<6, false, T, ieee> (-limits::infinity())));
+        REQUIRE (std::isnan (math_approx::log<6, false, T, ieee> (limits::quiet_NaN())));
+        REQUIRE (math_approx::log<6, false, T, ieee> (limits::infinity()) == limits::infinity());
+        REQUIRE (math_approx::log2<6, false, T, ieee> ((T) 8) == math_approx::log2<6> ((T) 8));
+
+        // subnormal inputs
+        for (auto x : { limits::denorm_min(), limits::min() / (T) 3, limits::min() / (T) 1000 })
+        {
+            REQUIRE (is_close<T> (math_approx::log<6, false, T, ieee> (x), std::log (x), (T) 1.0e-4));
+            REQUIRE (is_close<T> (math_approx::log2<6, false, T, ieee> (x), std::log2 (x), (T) 1.0e-4));
+            REQUIRE (is_close<T> (math_approx::log10<6, false, T, ieee> (x), std::log10 (x), (T) 1.0e-4));
+        }
+    }
+
+    SECTION ("Flush Denormals")
+    {
+        REQUIRE (math_approx::log<6, false, T, flush> (limits::denorm_min()) == -limits::infinity());
+        REQUIRE (math_approx::log<6, false, T, flush> (limits::min() / (T) 3) == -limits::infinity());
+        REQUIRE (math_approx::log<6, false, T, flush> ((T) 0) == -limits::infinity());
+        REQUIRE (std::isnan (math_approx::log<6, false, T, flush> (-limits::denorm_min())));
+        REQUIRE (std::isnan (math_approx::log<6, false, T, flush> (limits::quiet_NaN())));
+        REQUIRE (math_approx::log<6, false, T, flush> (limits::infinity()) == limits::infinity());
+        REQUIRE (math_approx::log<6, false, T, flush> (limits::min()) == math_approx::log<6> (limits::min()));
+    }
+
+    SECTION ("Saturate")
+    {
+        check_always_finite<T> ([] (T x)
+                                { return math_approx::log<6, false, T, saturate> (x); });
+        check_always_finite<T> ([] (T x)
+                                { return math_approx::log10<6, false, T, saturate> (x); });
+        REQUIRE (math_approx::log<6, false, T, saturate> ((T) 0) == math_approx::log<6> (limits::min()));
+    }
+}
+
+TEMPLATE_TEST_CASE ("Special Values: Inverse Trig", "", float, double)
+{
+    using T = TestType;
+    using limits = std::numeric_limits<T>;
+
+    SECTION ("IEEE")
+    {
+        for (auto x : { (T) 1.0001, (T) -2, limits::infinity(), limits::quiet_NaN() })
+        {
+            REQUIRE (std::isnan (math_approx::asin<5, T, ieee> (x)));
+            REQUIRE (std::isnan (math_approx::acos<5, T, ieee> (x)));
+        }
+        REQUIRE (math_approx::asin<5, T, ieee> ((T) 0.25) == math_approx::asin<5> ((T) 0.25));
+        REQUIRE (math_approx::acos<5, T, ieee> ((T) -1) == math_approx::acos<5> ((T) -1));
+    }
+
+    SECTION ("Saturate")
+    {
+        check_always_finite<T> ([] (T x)
+                                { return math_approx::asin<5, T, saturate> (x); });
+        check_always_finite<T> ([] (T x)
+                                { return math_approx::acos<5, T, saturate> (x); });
+        REQUIRE (math_approx::asin<5, T, saturate> ((T) 2) == math_approx::asin<5> ((T) 1));
+        REQUIRE (math_approx::acos<5, T, saturate> ((T) -2) == math_approx::acos<5> ((T) -1));
+    }
+}
+
+TEMPLATE_TEST_CASE ("Special Values: Hyperbolic", "", float, double)
+{
+    using T = TestType;
+    using limits = std::numeric_limits<T>;
+
+    SECTION ("IEEE")
+    {
+        REQUIRE (math_approx::sinh<6, T, ieee> ((T) 1.0e6) == limits::infinity());
+        REQUIRE (math_approx::sinh<6, T, ieee> ((T) -1.0e6) == -limits::infinity());
+        REQUIRE (math_approx::cosh<6, T, ieee> ((T) -1.0e6) == limits::infinity());
+        REQUIRE (std::isnan (math_approx::cosh<6, T, ieee> (limits::quiet_NaN())));
+
+        REQUIRE (is_close<T> (math_approx::tanh<5, T, ieee> ((T) 1.0e30), (T) 1, (T) 1.0e-5));
+        REQUIRE (is_close<T> (math_approx::tanh<5, T, ieee> (-limits::infinity()), (T) -1, (T) 1.0e-5));
+        REQUIRE (std::isnan (math_approx::tanh<5, T, ieee> (limits::quiet_NaN())));
+
+        REQUIRE (is_close<T> (math_approx::asinh<5, T, ieee> ((T) 1.0e30), std::asinh ((T) 1.0e30), (T) 1.0e-4));
+        REQUIRE (is_close<T> (math_approx::asinh<7, T, ieee> ((T) -1.0e30), std::asinh ((T) -1.0e30), (T) 1.0e-4));
+        REQUIRE (math_approx::asinh<5, T, ieee> (limits::infinity()) == limits::infinity());
+        REQUIRE (math_approx::asinh<7, T, ieee> (-limits::infinity()) == -limits::infinity());
+        REQUIRE (std::isnan (math_approx::asinh<5, T, ieee> (limits::quiet_NaN())));
+        REQUIRE (math_approx::asinh<5, T, ieee> ((T) 0) == (T) 0);
+
+        REQUIRE (std::isnan (math_approx::acosh<5, T, ieee> ((T) 0.5)));
+        REQUIRE (is_close<T> (math_approx::acosh<5, T, ieee> ((T) 1.0e30), std::acosh ((T) 1.0e30), (T) 1.0e-4));
+        REQUIRE (math_approx::atanh<5, T, ieee> ((T) 1) == limits::infinity());
+        REQUIRE (math_approx::atanh<5, T, ieee> ((T) -1) == -limits::infinity());
+        REQUIRE (std::isnan (math_approx::atanh<5, T, ieee> ((T) 2)));
+    }
+
+    SECTION ("Flush Denormals")
+    {
+        REQUIRE (math_approx::tanh<5, T, flush> (limits::denorm_min()) == (T) 0);
+        REQUIRE (math_approx::tanh<5, T, flush> (-limits::min() / (T) 2) == (T) 0);
+        REQUIRE (math_approx::tanh<5, T, flush> (limits::min()) == limits::min());
+        REQUIRE (std::isnan (math_approx::tanh<5, T, flush> (limits::quiet_NaN())));
+        REQUIRE (math_approx::sinh<6, T, flush> ((T) 1.0e6) == limits::infinity());
+        REQUIRE (std::isnan (math_approx::asin<5, T, flush> ((T) 2)));
+    }
+
+    SECTION ("Saturate")
+    {
+        check_always_finite<T> ([] (T x)
+                                { return math_approx::sinh<6, T, saturate> (x); });
+        check_always_finite<T> ([] (T x)
+                                { return math_approx::cosh<6, T, saturate> (x); });
+        check_always_finite<T> ([] (T x)
+                                { return math_approx::tanh<5, T, saturate> (x); });
+        check_always_finite<T> ([] (T x)
+                                { return math_approx::asinh<5, T, saturate> (x); });
+        check_always_finite<T> ([] (T x)
+                                { return math_approx::asinh<7, T, saturate> (x); });
+        check_always_finite<T> ([] (T x)
+                                { return math_approx::acosh<5, T, saturate> (x); });
+        check_always_finite<T> ([] (T x)
+                                { return math_approx::atanh<5, T, saturate> (x); });
+        REQUIRE (is_close<T> (math_approx::tanh<11, T, saturate> ((T) 1.0e30), (T) 1, (T) 1.0e-6));
+    }
+}
+
+TEMPLATE_TEST_CASE ("Special Values: Explicit Type", "", float, double)
+{
+    using T = TestType;
+    const auto x = (T) 0.5;
+
+    SECTION ("Unchecked")
+    {
+        REQUIRE (math_approx::exp<5, false, true, T> (x) == math_approx::exp<5> (x));
+        REQUIRE (math_approx::exp2<5, false, true, T> (x) == math_approx::exp2<5> (x));
+        REQUIRE (math_approx::exp10<5, false, true, T> (x) == math_approx::exp10<5> (x));
+        REQUIRE (math_approx::expm1<5, false, true, T> (x) == math_approx::expm1<5> (x));
+        REQUIRE (math_approx::log<5, false, T> (x) == math_approx::log<5> (x));
+        REQUIRE (math_approx::log2<5, false, T> (x) == math_approx::log2<5> (x));
+        REQUIRE (math_approx::log10<5, false, T> (x) == math_approx::log10<5> (x));
+        REQUIRE (math_approx::log1p<5, false, T> (x) == math_approx::log1p<5> (x));
+        REQUIRE (math_approx::asin<5, T> (x) == math_approx::asin<5> (x));
+        REQUIRE (math_approx::acos<5, T> (x) == math_approx::acos<5> (x));
+        REQUIRE (math_approx::sinh<5, T> (x) == math_approx::sinh<5> (x));
+        REQUIRE (math_approx::cosh<5, T> (x) == math_approx::cosh<5> (x));
+        REQUIRE (math_approx::tanh<5, T> (x) == math_approx::tanh<5> (x));
+        REQUIRE (math_approx::asinh<5, T> (x) == math_approx::asinh<5> (x));
+        REQUIRE (math_approx::acosh<5, T> ((T) 2) == math_approx::acosh<5> ((T) 2));
+        REQUIRE (math_approx::atanh<5, T> (x) == math_approx::atanh<5> (x));
+    }
+
+    SECTION ("With Policy")
+    {
+        REQUIRE (math_approx::exp<5, false, true, T, saturate> (x) == math_approx::exp<5> (x));
+        REQUIRE (math_approx::log<5, false, T, ieee> (x) == math_approx::log<5> (x));
+        REQUIRE (math_approx::tanh<5, T, flush> (x) == math_approx::tanh<5> (x));
+        REQUIRE (math_approx::asin<5, T, saturate> (x) == math_approx::asin<5> (x));
+    }
+}
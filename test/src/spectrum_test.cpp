@@ -0,0 +1,108 @@
+#include "test_helpers.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+
+#include <math_approx/math_approx.hpp>
+
+namespace
+{
+std::vector<float> make_spectrum (size_t N)
+{
+    std::vector<float> re_im (2 * N);
+    for (size_t i = 0; i < N; ++i)
+    {
+        // magnitudes spanning ~[-160, +40] dB, at all angles
+        const auto magnitude = std::pow (10.0f, -8.0f + 10.0f * (float) i / (float) N);
+        const auto angle = 0.7f * (float) i;
+        re_im[2 * i] = magnitude * std::cos (angle);
+        re_im[2 * i + 1] = magnitude * std::sin (angle);
+    }
+    return re_im;
+}
+} // namespace
+
+TEST_CASE ("Complex to dB Test")
+{
+    static constexpr size_t N = 10'001;
+    const auto re_im = make_spectrum (N);
+    static constexpr float floor_db = -120.0f;
+
+    const auto db_exact = [&re_im] (size_t i)
+    {
+        const auto re = (double) re_im[2 * i];
+        const auto im = (double) re_im[2 * i + 1];
+        return std::max (10.0 * std::log10 (re * re + im * im), (double) floor_db);
+    };
+
+    SECTION ("Scalar")
+    {
+        float max_error = 0.0f;
+        for (size_t i = 0; i < N; ++i)
+        {
+            const auto db = math_approx::complex_to_db<6> (re_im[2 * i], re_im[2 * i + 1], floor_db);
+            max_error = std::max (max_error, (float) std::abs (db - db_exact (i)));
+        }
+        std::cout << max_error << std::endl;
+        REQUIRE (max_error < 5.0e-5f);
+    }
+
+    SECTION ("Bulk")
+    {
+        std::vector<float> db (N);
+        math_approx::complex_to_db<6> (re_im.data(), db.data(), N, floor_db);
+
+        float max_error = 0.0f;
+        for (size_t i = 0; i < N; ++i)
+            max_error = std::max (max_error, (float) std::abs (db[i] - db_exact (i)));
+        std::cout << max_error << std::endl;
+        REQUIRE (max_error < 5.0e-5f);
+    }
+
+    SECTION ("Bulk with Phase")
+    {
+        std::vector<float> db (N);
+        std::vector<float> phase (N);
+        math_approx::complex_to_db<6, 7> (re_im.data(), db.data(), phase.data(), N, floor_db);
+
+        float max_error = 0.0f;
+        float max_phase_error = 0.0f;
+        for (size_t i = 0; i < N; ++i)
+        {
+            max_error = std::max (max_error, (float) std::abs (db[i] - db_exact (i)));
+            max_phase_error = std::max (max_phase_error, std::abs (phase[i] - std::atan2 (re_im[2 * i + 1], re_im[2 * i])));
+        }
+        std::cout << max_error << ", " << max_phase_error << std::endl;
+        REQUIRE (max_error < 5.0e-5f);
+        REQUIRE (max_phase_error < 1.0e-6f);
+    }
+
+    SECTION ("Phase with Signed-Zero Imaginary Parts")
+    {
+        // FFT bins on the real axis often have a -0 imaginary part, which should give a phase of -pi
+        std::vector<float> axis (2 * 19);
+        for (size_t i = 0; i < axis.size() / 2; ++i)
+        {
+            axis[2 * i] = (i % 2 == 0) ? -1.0f : 1.0f;
+            axis[2 * i + 1] = (i % 4 < 2) ? 0.0f : -0.0f;
+        }
+
+        std::vector<float> db (axis.size() / 2);
+        std::vector<float> phase (axis.size() / 2);
+        math_approx::complex_to_db<6, 7> (axis.data(), db.data(), phase.data(), db.size(), floor_db);
+        for (size_t i = 0; i < phase.size(); ++i)
+        {
+            const auto phase_exact = std::atan2 (axis[2 * i + 1], axis[2 * i]);
+            REQUIRE (std::abs (phase[i] - phase_exact) < 1.0e-6f);
+            REQUIRE (std::signbit (phase[i]) == std::signbit (phase_exact));
+        }
+    }
+
+    SECTION ("Floor")
+    {
+        const std::vector<float> zeros (2 * 9, 0.0f);
+        std::vector<float> db (9);
+        math_approx::complex_to_db<6> (zeros.data(), db.data(), db.size(), floor_db);
+        for (auto x : db)
+            REQUIRE (std::abs (x - floor_db) < 1.0e-4f);
+    }
+}
@@ -164,3 +164,150 @@ TEST_CASE ("Tan Approx Test")
                      0);
     }
 }
+
+TEST_CASE ("Sine/Cosine Approx Test (double)")
+{
+    const auto test_approx = [] (auto&& f_exact, auto&& f_approx, double err_bound)
+    {
+        static constexpr int num_points = 1'000'000;
+        double max_error = 0.0;
+        for (int i = 0; i <= num_points; ++i)
+        {
+            const auto x = -10.0 + (10.0 - -10.0) * (double) i / (double) num_points;
+            max_error = std::max (max_error, std::abs (f_exact (x) - f_approx (x)));
+        }
+
+        std::cout << max_error << std::endl;
+        REQUIRE (max_error < err_bound);
+    };
+
+    SECTION ("17th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::sin (x); },
+                     [] (double x)
+                     { return math_approx::sin<17> (x); },
+                     2.0e-15);
+        test_approx ([] (double x)
+                     { return std::cos (x); },
+                     [] (double x)
+                     { return math_approx::cos<17> (x); },
+                     2.0e-15);
+    }
+    SECTION ("15th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::sin (x); },
+                     [] (double x)
+                     { return math_approx::sin<15> (x); },
+                     1.0e-13);
+        test_approx ([] (double x)
+                     { return std::cos (x); },
+                     [] (double x)
+                     { return math_approx::cos<15> (x); },
+                     1.0e-13);
+    }
+    SECTION ("13th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::sin (x); },
+                     [] (double x)
+                     { return math_approx::sin<13> (x); },
+                     1.5e-11);
+        test_approx ([] (double x)
+                     { return std::cos (x); },
+                     [] (double x)
+                     { return math_approx::cos<13> (x); },
+                     1.5e-11);
+    }
+    SECTION ("11th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::sin (x); },
+                     [] (double x)
+                     { return math_approx::sin<11> (x); },
+                     1.5e-9);
+        test_approx ([] (double x)
+                     { return std::cos (x); },
+                     [] (double x)
+                     { return math_approx::cos<11> (x); },
+                     1.5e-9);
+    }
+}
+
+TEST_CASE ("Cody-Waite Range Reduction Test")
+{
+    using math_approx::CodyWaiteTrigRangeReduction;
+
+    const auto test_approx = [] (double magnitude, auto&& f_exact, auto&& f_approx, double err_bound)
+    {
+        static constexpr int num_points = 200'000;
+        double max_error = 0.0;
+        for (int i = 0; i <= num_points; ++i)
+        {
+            const auto x = magnitude * (-1.0 + 2.0 * (double) i / (double) num_points);
+            max_error = std::max (max_error, std::abs (f_exact (x) - f_approx (x)));
+        }
+
+        std::cout << max_error << std::endl;
+        REQUIRE (max_error < err_bound);
+    };
+
+    SECTION ("float")
+    {
+        for (const auto magnitude : { 10.0, 1.0e3, 1.0e5, 1.0e8 })
+        {
+            // compare against the exact function of the (float) argument
+            test_approx (
+                magnitude,
+                [] (double x)
+                { return std::sin ((double) (float) x); },
+                [] (double x)
+                { return (double) math_approx::sin<9, float, CodyWaiteTrigRangeReduction> ((float) x); },
+                1.0e-6);
+            test_approx (
+                magnitude,
+                [] (double x)
+                { return std::cos ((double) (float) x); },
+                [] (double x)
+                { return (double) math_approx::cos<9, float, CodyWaiteTrigRangeReduction> ((float) x); },
+                1.0e-6);
+        }
+    }
+
+    SECTION ("double")
+    {
+        for (const auto magnitude : { 10.0, 1.0e5, 1.0e10, 1.0e16 })
+        {
+            test_approx (
+                magnitude,
+                [] (double x)
+                { return std::sin (x); },
+                [] (double x)
+                { return math_approx::sin<17, double, CodyWaiteTrigRangeReduction> (x); },
+                2.0e-15);
+            test_approx (
+                magnitude,
+                [] (double x)
+                { return std::cos (x); },
+                [] (double x)
+                { return math_approx::cos<17, double, CodyWaiteTrigRangeReduction> (x); },
+                2.0e-15);
+        }
+    }
+
+    SECTION ("Explicit Type")
+    {
+        // the range reduction comes after the type, so explicitly typed calls still work
+        REQUIRE (math_approx::sin<9, float> (0.5f) == math_approx::sin<9> (0.5f));
+        REQUIRE (math_approx::cos<9, double> (0.5) == math_approx::cos<9> (0.5));
+        REQUIRE (math_approx::tan<9, float> (0.5f) == math_approx::tan<9> (0.5f));
+    }
+
+    SECTION ("tan")
+    {
+        const auto x = 1.0e6;
+        const auto expected = std::tan (x);
+        REQUIRE (std::abs (math_approx::tan<15, double, CodyWaiteTrigRangeReduction> (x) - expected) < 1.0e-6 * std::abs (expected));
+    }
+}
@@ -114,3 +114,60 @@ TEST_CASE ("Cosine Approx Test")
                      14'000);
     }
 }
+
+TEST_CASE ("Sine/Cosine Turns Approx Test (double)")
+{
+    const auto test_approx = [] (auto&& f_exact, auto&& f_approx, double err_bound)
+    {
+        static constexpr int num_points = 1'000'000;
+        double max_error = 0.0;
+        for (int i = 0; i <= num_points; ++i)
+        {
+            const auto x = -2.0 + (2.0 - -2.0) * (double) i / (double) num_points;
+            max_error = std::max (max_error, std::abs (f_exact (x) - f_approx (x)));
+        }
+
+        std::cout << max_error << std::endl;
+        REQUIRE (max_error < err_bound);
+    };
+
+    SECTION ("17th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::sin (2.0 * M_PI * x); },
+                     [] (double x)
+                     { return math_approx::sin_turns<17> (x); },
+                     3.0e-15);
+        test_approx ([] (double x)
+                     { return std::cos (2.0 * M_PI * x); },
+                     [] (double x)
+                     { return math_approx::cos_turns<17> (x); },
+                     3.0e-15);
+    }
+    SECTION ("15th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::sin (2.0 * M_PI * x); },
+                     [] (double x)
+                     { return math_approx::sin_turns<15> (x); },
+                     1.0e-13);
+        test_approx ([] (double x)
+                     { return std::cos (2.0 * M_PI * x); },
+                     [] (double x)
+                     { return math_approx::cos_turns<15> (x); },
+                     1.0e-13);
+    }
+    SECTION ("13th-Order")
+    {
+        test_approx ([] (double x)
+                     { return std::sin (2.0 * M_PI * x); },
+                     [] (double x)
+                     { return math_approx::sin_turns<13> (x); },
+                     1.5e-11);
+        test_approx ([] (double x)
+                     { return std::cos (2.0 * M_PI * x); },
+                     [] (double x)
+                     { return math_approx::cos_turns<13> (x); },
+                     1.5e-11);
+    }
+}
@@ -0,0 +1,117 @@
+#include "test_helpers.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+
+#include <math_approx/math_approx.hpp>
+
+namespace
+{
+template <typename Exact, typename Approx>
+float max_relative_error (float begin, float end, Exact&& f_exact, Approx&& f_approx)
+{
+    static constexpr int num_points = 100'000;
+    float max_error = 0.0f;
+    for (int i = 0; i <= num_points; ++i)
+    {
+        const auto x = begin + (end - begin) * (float) i / (float) num_points;
+        const auto y_exact = f_exact ((double) x);
+        max_error = std::max (max_error, (float) std::abs ((y_exact - (double) f_approx (x)) / y_exact));
+    }
+    return max_error;
+}
+
+template <typename Exact, typename Approx>
+float max_error (float begin, float end, Exact&& f_exact, Approx&& f_approx)
+{
+    static constexpr int num_points = 100'000;
+    float max_error = 0.0f;
+    for (int i = 0; i <= num_points; ++i)
+    {
+        const auto x = begin + (end - begin) * (float) i / (float) num_points;
+        max_error = std::max (max_error, (float) std::abs (f_exact ((double) x) - (double) f_approx (x)));
+    }
+    return max_error;
+}
+} // namespace
+
+TEST_CASE ("Decibel Conversion Test")
+{
+    SECTION ("dB to Gain")
+    {
+        const auto error = max_relative_error (-100.0f, 24.0f, [] (double x)
+                                               { return std::pow (10.0, x / 20.0); },
+                                               [] (float x)
+                                               { return math_approx::db_to_gain<6> (x); });
+        std::cout << error << std::endl;
+        REQUIRE (error < 1.0e-6f);
+    }
+
+    SECTION ("Gain to dB")
+    {
+        const auto error = max_error (1.0e-5f, 16.0f, [] (double x)
+                                      { return 20.0 * std::log10 (x); },
+                                      [] (float x)
+                                      { return math_approx::gain_to_db<6> (x); });
+        std::cout << error << std::endl;
+        REQUIRE (error < 5.0e-5f);
+    }
+
+    SECTION ("Bulk")
+    {
+        std::vector<float> db (1003);
+        for (size_t i = 0; i < db.size(); ++i)
+            db[i] = -60.0f + 0.07f * (float) i;
+
+        std::vector<float> gain (db.size());
+        std::vector<float> db_round_trip (db.size());
+        math_approx::db_to_gain<6> (db.data(), gain.data(), db.size());
+        math_approx::gain_to_db<6> (gain.data(), db_round_trip.data(), db.size());
+        for (size_t i = 0; i < db.size(); ++i)
+        {
+            REQUIRE (gain[i] == math_approx::db_to_gain<6> (db[i]));
+            REQUIRE (std::abs (db_round_trip[i] - db[i]) < 1.0e-4f);
+        }
+    }
+}
+
+TEST_CASE ("MIDI Conversion Test")
+{
+    SECTION ("MIDI to Hz")
+    {
+        const auto error = max_relative_error (0.0f, 135.0f, [] (double x)
+                                               { return 440.0 * std::exp2 ((x - 69.0) / 12.0); },
+                                               [] (float x)
+                                               { return math_approx::midi_to_hz<6> (x); });
+        std::cout << error << std::endl;
+        REQUIRE (error < 1.0e-6f);
+        REQUIRE (std::abs (math_approx::midi_to_hz<6> (69.0f) - 440.0f) < 1.0e-4f);
+    }
+
+    SECTION ("Hz to MIDI")
+    {
+        const auto error = max_error (8.0f, 20000.0f, [] (double x)
+                                      { return 69.0 + 12.0 * std::log2 (x / 440.0); },
+                                      [] (float x)
+                                      { return math_approx::hz_to_midi<6> (x); });
+        std::cout << error << std::endl;
+        REQUIRE (error < 1.0e-4f);
+        REQUIRE (std::abs (math_approx::hz_to_midi<6> (440.0f) - 69.0f) < 1.0e-4f);
+    }
+
+    SECTION ("Bulk")
+    {
+        std::vector<float> notes (128);
+        for (size_t i = 0; i < notes.size(); ++i)
+            notes[i] = (float) i;
+
+        std::vector<float> hz (notes.size());
+        std::vector<float> notes_round_trip (notes.size());
+        math_approx::midi_to_hz<6> (notes.data(), hz.data(), notes.size());
+        math_approx::hz_to_midi<6> (hz.data(), notes_round_trip.data(), notes.size());
+        for (size_t i = 0; i < notes.size(); ++i)
+        {
+            REQUIRE (hz[i] == math_approx::midi_to_hz<6> (notes[i]));
+            REQUIRE (std::abs (notes_round_trip[i] - notes[i]) < 1.0e-4f);
+        }
+    }
+}
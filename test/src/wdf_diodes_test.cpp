@@ -0,0 +1,165 @@
+#include "test_helpers.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+
+#include <math_approx/math_approx.hpp>
+
+namespace
+{
+constexpr double Is = 2.52e-9;
+constexpr double Vt = 25.85e-3 * 1.752;
+
+/** Solves for the diode voltage, given the incident wave, port resistance, and diode current function */
+template <typename CurrentFunc, typename CurrentDerivFunc>
+double solve_diode_voltage (double a, double R, CurrentFunc&& i_of_v, CurrentDerivFunc&& di_dv)
+{
+    // Kirchhoff: (a - v) / R = i(v)
+    double v = std::clamp (a, -1.0, 1.0);
+    for (int k = 0; k < 200; ++k)
+    {
+        const auto f = (a - v) / R - i_of_v (v);
+        const auto df = -1.0 / R - di_dv (v);
+        const auto v_next = v - f / df;
+        if (std::abs (v_next - v) < 1.0e-15)
+            return v_next;
+        v = v_next;
+    }
+    return v;
+}
+
+double diode_reflected_exact (double a, double R)
+{
+    const auto v = solve_diode_voltage (
+        a, R, [] (double v)
+        { return Is * (std::exp (v / Vt) - 1.0); },
+        [] (double v)
+        { return Is / Vt * std::exp (v / Vt); });
+    return 2.0 * v - a;
+}
+
+double diode_pair_reflected_exact (double a, double R)
+{
+    const auto v = solve_diode_voltage (
+        a, R, [] (double v)
+        { return 2.0 * Is * std::sinh (v / Vt); },
+        [] (double v)
+        { return 2.0 * Is / Vt * std::cosh (v / Vt); });
+    return 2.0 * v - a;
+}
+} // namespace
+
+TEST_CASE ("WDF Diode Test")
+{
+    static constexpr double R = 4700.0;
+    const auto test_diode = [] (auto diode, float err_bound)
+    {
+        float max_error = 0.0f;
+        for (double a = -10.0; a <= 10.0; a += 0.01)
+            max_error = std::max (max_error, (float) std::abs (diode.reflected ((float) a) - diode_reflected_exact (a, R)));
+        std::cout << max_error << std::endl;
+        REQUIRE (max_error < err_bound);
+    };
+
+    SECTION ("Wright-Omega, 1 NR Iteration")
+    {
+        test_diode (math_approx::wdf_diode<float> { (float) R, (float) Is, (float) Vt }, 1.0e-3f);
+    }
+    SECTION ("Wright-Omega, 2 NR Iterations")
+    {
+        test_diode (math_approx::wdf_diode<float, math_approx::WrightOmegaProvider<2>> { (float) R, (float) Is, (float) Vt }, 5.0e-5f);
+    }
+    SECTION ("D'Angelo, 1 NR Iteration")
+    {
+        test_diode (math_approx::wdf_diode<float, math_approx::DAngeloOmegaProvider<1>> { (float) R, (float) Is, (float) Vt }, 5.0e-3f);
+    }
+}
+
+TEST_CASE ("WDF Diode Pair Test")
+{
+    static constexpr double R = 1000.0;
+    const auto test_diode_pair = [] (auto diode_pair, float err_bound)
+    {
+        float max_error = 0.0f;
+        for (double a = -10.0; a <= 10.0; a += 0.01)
+            max_error = std::max (max_error, (float) std::abs (diode_pair.reflected ((float) a) - diode_pair_reflected_exact (a, R)));
+        std::cout << max_error << std::endl;
+        REQUIRE (max_error < err_bound);
+    };
+
+    SECTION ("Best")
+    {
+        test_diode_pair (math_approx::wdf_diode_pair<float, math_approx::diode_pair_quality::best> { (float) R, (float) Is, (float) Vt }, 1.0e-3f);
+    }
+    SECTION ("Good")
+    {
+        test_diode_pair (math_approx::wdf_diode_pair<float, math_approx::diode_pair_quality::good> { (float) R, (float) Is, (float) Vt }, 1.0e-3f);
+    }
+    SECTION ("Odd Symmetry")
+    {
+        const math_approx::wdf_diode_pair<float> diode_pair { (float) R, (float) Is, (float) Vt };
+        for (float a = 0.0f; a <= 5.0f; a += 0.125f)
+            REQUIRE (diode_pair.reflected (-a) == -diode_pair.reflected (a));
+    }
+}
+
+TEST_CASE ("WDF Diode Clipper Test")
+{
+    static constexpr double fs = 48000.0;
+    static constexpr double R = 2200.0;
+    static constexpr double C = 10.0e-9;
+    static constexpr size_t N = 1000;
+
+    std::vector<float> x (N);
+    for (size_t n = 0; n < N; ++n)
+        x[n] = 5.0f * std::sin (2.0f * (float) M_PI * 500.0f * (float) n / (float) fs);
+
+    // double-precision reference, with the exact diode pair
+    std::vector<double> y_exact (N);
+    {
+        const auto G_c = 2.0 * fs * C;
+        const auto G_s = 1.0 / R;
+        const auto source_coeff = G_s / (G_c + G_s);
+        double z = 0.0;
+        for (size_t n = 0; n < N; ++n)
+        {
+            const auto b_up = z + source_coeff * ((double) x[n] - z);
+            const auto b_root = diode_pair_reflected_exact (b_up, 1.0 / (G_c + G_s));
+            z = b_up + b_root - z;
+            y_exact[n] = 0.5 * (b_up + b_root);
+        }
+    }
+
+    math_approx::wdf_diode_clipper<float> clipper;
+    clipper.prepare ((float) fs, (float) R, (float) C, (float) Is, (float) Vt);
+    auto y = x;
+    clipper.process_block (y.data(), N);
+
+    float max_error = 0.0f;
+    for (size_t n = 0; n < N; ++n)
+        max_error = std::max (max_error, (float) std::abs (y_exact[n] - (double) y[n]));
+    std::cout << max_error << std::endl;
+    REQUIRE (max_error < 1.0e-3f);
+}
+
+TEST_CASE ("WDF Diode Clipper Unprepared Test")
+{
+    // an unprepared clipper should process with its default circuit, rather than computing log(0)
+    std::vector<float> x (100);
+    for (size_t n = 0; n < x.size(); ++n)
+        x[n] = 5.0f * std::sin (2.0f * (float) M_PI * 500.0f * (float) n / 48000.0f);
+
+    math_approx::wdf_diode_clipper<float> unprepared_clipper;
+    auto y_unprepared = x;
+    unprepared_clipper.process_block (y_unprepared.data(), x.size());
+
+    math_approx::wdf_diode_clipper<float> prepared_clipper;
+    prepared_clipper.prepare (48000.0f, 2200.0f, 10.0e-9f, (float) Is, (float) Vt);
+    auto y_prepared = x;
+    prepared_clipper.process_block (y_prepared.data(), x.size());
+
+    for (size_t n = 0; n < x.size(); ++n)
+    {
+        REQUIRE (std::isfinite (y_unprepared[n]));
+        REQUIRE (std::abs (y_unprepared[n] - y_prepared[n]) < 1.0e-6f);
+    }
+}
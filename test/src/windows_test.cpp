@@ -0,0 +1,113 @@
+#include "test_helpers.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <iostream>
+
+#include <math_approx/math_approx.hpp>
+
+namespace
+{
+using math_approx::window_symmetry;
+
+double cosine_sum_reference (double n, double D, std::initializer_list<double> a)
+{
+    double y = 0.0;
+    double sign = 1.0;
+    int k = 0;
+    for (auto a_k : a)
+    {
+        y += sign * a_k * std::cos (2.0 * M_PI * (double) k * n / D);
+        sign = -sign;
+        ++k;
+    }
+    return y;
+}
+
+template <typename Generator, typename Reference>
+float max_window_error (Generator&& generate, Reference&& reference)
+{
+    float max_error = 0.0f;
+    for (size_t N : { 1, 2, 3, 16, 17, 1000, 1001, 65536 })
+    {
+        for (auto symmetry : { window_symmetry::symmetric, window_symmetry::periodic })
+        {
+            std::vector<float> w (N);
+            generate (w.data(), N, symmetry);
+
+            const auto D = N == 1 ? 1.0 : (double) (symmetry == window_symmetry::symmetric ? N - 1 : N);
+            for (size_t n = 0; n < N; ++n)
+            {
+                const auto expected = N == 1 ? 1.0 : reference ((double) n, D);
+                max_error = std::max (max_error, (float) std::abs (expected - (double) w[n]));
+            }
+        }
+    }
+    return max_error;
+}
+
+template <int order>
+void test_cosine_sum_windows (float hann_bound, float blackman_bound, float blackman_harris_bound, float flat_top_bound)
+{
+    const auto hann_error = max_window_error ([] (float* w, size_t N, window_symmetry s)
+                                              { math_approx::hann_window<order> (w, N, s); },
+                                              [] (double n, double D)
+                                              { return cosine_sum_reference (n, D, { 0.5, 0.5 }); });
+    const auto hamming_error = max_window_error ([] (float* w, size_t N, window_symmetry s)
+                                                 { math_approx::hamming_window<order> (w, N, s); },
+                                                 [] (double n, double D)
+                                                 { return cosine_sum_reference (n, D, { 0.54, 0.46 }); });
+    const auto blackman_error = max_window_error ([] (float* w, size_t N, window_symmetry s)
+                                                  { math_approx::blackman_window<order> (w, N, s); },
+                                                  [] (double n, double D)
+                                                  { return cosine_sum_reference (n, D, { 0.42, 0.5, 0.08 }); });
+    const auto blackman_harris_error = max_window_error ([] (float* w, size_t N, window_symmetry s)
+                                                         { math_approx::blackman_harris_window<order> (w, N, s); },
+                                                         [] (double n, double D)
+                                                         { return cosine_sum_reference (n, D, { 0.35875, 0.48829, 0.14128, 0.01168 }); });
+    const auto flat_top_error = max_window_error ([] (float* w, size_t N, window_symmetry s)
+                                                  { math_approx::flat_top_window<order> (w, N, s); },
+                                                  [] (double n, double D)
+                                                  { return cosine_sum_reference (n, D, { 0.21557895, 0.41663158, 0.277263158, 0.083578947, 0.006947368 }); });
+
+    std::cout << hann_error << ", " << hamming_error << ", " << blackman_error << ", " << blackman_harris_error << ", " << flat_top_error << std::endl;
+    REQUIRE (hann_error < hann_bound);
+    REQUIRE (hamming_error < hann_bound);
+    REQUIRE (blackman_error < blackman_bound);
+    REQUIRE (blackman_harris_error < blackman_harris_bound);
+    REQUIRE (flat_top_error < flat_top_bound);
+}
+} // namespace
+
+TEST_CASE ("Cosine-Sum Windows Test")
+{
+    SECTION ("9th-Order")
+    {
+        test_cosine_sum_windows<9> (3.0e-7f, 4.0e-7f, 5.0e-7f, 1.0e-6f);
+    }
+    SECTION ("7th-Order")
+    {
+        test_cosine_sum_windows<7> (1.0e-5f, 1.5e-5f, 2.0e-5f, 4.0e-5f);
+    }
+    SECTION ("5th-Order")
+    {
+        test_cosine_sum_windows<5> (4.0e-4f, 7.0e-4f, 1.0e-3f, 2.0e-3f);
+    }
+}
+
+TEST_CASE ("Tukey Window Test")
+{
+    for (float alpha : { 0.0f, 0.25f, 0.5f, 1.0f })
+    {
+        const auto error = max_window_error ([alpha] (float* w, size_t N, window_symmetry s)
+                                             { math_approx::tukey_window<9> (w, N, alpha, s); },
+                                             [alpha] (double n, double D)
+                                             {
+                                                 const auto x = n / D;
+                                                 const auto x_mirrored = std::min (x, 1.0 - x);
+                                                 if (alpha == 0.0f || x_mirrored >= 0.5 * (double) alpha)
+                                                     return 1.0;
+                                                 return 0.5 - 0.5 * std::cos (2.0 * M_PI * x_mirrored / (double) alpha);
+                                             });
+        std::cout << error << std::endl;
+        REQUIRE (error < 3.0e-7f);
+    }
+}
@@ -0,0 +1,88 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+#include <random>
+
+static constexpr size_t N = 2000;
+static const auto data = []
+{
+    std::vector<float> x (N);
+    for (size_t n = 0; n < N; ++n)
+        x[n] = 4.0f * std::sin (2.0f * (float) M_PI * 0.0123f * (float) n);
+    return x;
+}();
+
+void tanh_std (benchmark::State& state)
+{
+    auto x = data;
+    for (auto _ : state)
+    {
+        for (auto& v : x)
+            v = std::tanh (v);
+        benchmark::DoNotOptimize (x.data());
+    }
+}
+BENCHMARK (tanh_std);
+
+void tanh_adaa1_std (benchmark::State& state)
+{
+    auto x = data;
+    for (auto _ : state)
+    {
+        float x1 = 0.0f, ad1_x1 = 0.0f;
+        for (auto& v : x)
+        {
+            const auto ad1_x = std::log (std::cosh (v));
+            const auto delta = v - x1;
+            const auto y = std::abs (delta) < 1.0e-3f ? std::tanh (0.5f * (v + x1)) : (ad1_x - ad1_x1) / delta;
+            x1 = v;
+            ad1_x1 = ad1_x;
+            v = y;
+        }
+        benchmark::DoNotOptimize (x.data());
+    }
+}
+BENCHMARK (tanh_adaa1_std);
+
+template <typename ADAA>
+void adaa_approx (benchmark::State& state)
+{
+    auto x = data;
+    ADAA adaa {};
+    for (auto _ : state)
+    {
+        adaa.process_block (x.data(), N);
+        benchmark::DoNotOptimize (x.data());
+    }
+}
+BENCHMARK (adaa_approx<math_approx::first_order_adaa<math_approx::adaa_tanh<>>>);
+BENCHMARK (adaa_approx<math_approx::second_order_adaa<math_approx::adaa_tanh<>>>);
+BENCHMARK (adaa_approx<math_approx::first_order_adaa<math_approx::adaa_sigmoid<>>>);
+BENCHMARK (adaa_approx<math_approx::second_order_adaa<math_approx::adaa_sigmoid<>>>);
+BENCHMARK (adaa_approx<math_approx::first_order_adaa<math_approx::adaa_hard_clip>>);
+BENCHMARK (adaa_approx<math_approx::second_order_adaa<math_approx::adaa_hard_clip>>);
+BENCHMARK (adaa_approx<math_approx::first_order_adaa<math_approx::adaa_soft_clip>>);
+BENCHMARK (adaa_approx<math_approx::second_order_adaa<math_approx::adaa_soft_clip>>);
+
+#if defined(XSIMD_HPP)
+template <typename ADAA>
+void adaa_approx_simd (benchmark::State& state)
+{
+    // one channel per SIMD lane
+    using B = xsimd::batch<float>;
+    std::vector<B> x (N);
+    for (size_t n = 0; n < N; ++n)
+        x[n] = B (data[n]);
+
+    ADAA adaa {};
+    for (auto _ : state)
+    {
+        adaa.process_block (x.data(), N);
+        benchmark::DoNotOptimize (x.data());
+    }
+}
+BENCHMARK (adaa_approx_simd<math_approx::first_order_adaa<math_approx::adaa_tanh<>, xsimd::batch<float>>>);
+BENCHMARK (adaa_approx_simd<math_approx::second_order_adaa<math_approx::adaa_tanh<>, xsimd::batch<float>>>);
+BENCHMARK (adaa_approx_simd<math_approx::second_order_adaa<math_approx::adaa_hard_clip, xsimd::batch<float>>>);
+#endif
+
+BENCHMARK_MAIN();
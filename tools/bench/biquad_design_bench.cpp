@@ -0,0 +1,92 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+
+static constexpr float fs = 48000.0f;
+
+struct filter_bank_data
+{
+    explicit filter_bank_data (size_t N)
+        : freq (N), q (N, 0.7071f), gain (N), b0 (N), b1 (N), b2 (N), a1 (N), a2 (N)
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            freq[i] = 20.0f * std::pow (1000.0f, (float) i / (float) N);
+            gain[i] = -12.0f + 24.0f * (float) i / (float) N;
+        }
+    }
+
+    std::vector<float> freq, q, gain;
+    std::vector<float> b0, b1, b2, a1, a2;
+};
+
+void peak_std (benchmark::State& state)
+{
+    const auto N = (size_t) state.range (0);
+    filter_bank_data data { N };
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            const auto w0 = 2.0f * (float) M_PI * data.freq[i] / fs;
+            const auto cos_w0 = std::cos (w0);
+            const auto alpha = std::sin (w0) / (2.0f * data.q[i]);
+            const auto A = std::pow (10.0f, data.gain[i] / 40.0f);
+            const auto a0_inv = 1.0f / (1.0f + alpha / A);
+            data.b0[i] = (1.0f + alpha * A) * a0_inv;
+            data.b1[i] = -2.0f * cos_w0 * a0_inv;
+            data.b2[i] = (1.0f - alpha * A) * a0_inv;
+            data.a1[i] = data.b1[i];
+            data.a2[i] = (1.0f - alpha / A) * a0_inv;
+        }
+        benchmark::DoNotOptimize (data.b0.data());
+        benchmark::DoNotOptimize (data.a2.data());
+    }
+}
+BENCHMARK (peak_std)->RangeMultiplier (4)->Range (16, 1024);
+
+void lowpass_std (benchmark::State& state)
+{
+    const auto N = (size_t) state.range (0);
+    filter_bank_data data { N };
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            const auto K = std::tan ((float) M_PI * data.freq[i] / fs);
+            const auto K_sq = K * K;
+            const auto a0_inv = 1.0f / (1.0f + K / data.q[i] + K_sq);
+            data.b0[i] = K_sq * a0_inv;
+            data.b1[i] = 2.0f * data.b0[i];
+            data.b2[i] = data.b0[i];
+            data.a1[i] = 2.0f * (K_sq - 1.0f) * a0_inv;
+            data.a2[i] = (1.0f - K / data.q[i] + K_sq) * a0_inv;
+        }
+        benchmark::DoNotOptimize (data.b0.data());
+        benchmark::DoNotOptimize (data.a2.data());
+    }
+}
+BENCHMARK (lowpass_std)->RangeMultiplier (4)->Range (16, 1024);
+
+template <math_approx::biquad_type type, int tan_order, int exp_order>
+void design_approx (benchmark::State& state)
+{
+    const auto N = (size_t) state.range (0);
+    filter_bank_data data { N };
+    for (auto _ : state)
+    {
+        math_approx::design_biquads<type, tan_order, exp_order> ({ data.b0.data(), data.b1.data(), data.b2.data(), data.a1.data(), data.a2.data() },
+                                                                  data.freq.data(),
+                                                                  data.q.data(),
+                                                                  data.gain.data(),
+                                                                  N,
+                                                                  fs);
+        benchmark::DoNotOptimize (data.b0.data());
+        benchmark::DoNotOptimize (data.a2.data());
+    }
+}
+BENCHMARK (design_approx<math_approx::biquad_type::peak, 9, 5>)->RangeMultiplier (4)->Range (16, 1024);
+BENCHMARK (design_approx<math_approx::biquad_type::lowpass, 9, 5>)->RangeMultiplier (4)->Range (16, 1024);
+BENCHMARK (design_approx<math_approx::biquad_type::lowpass, 5, 5>)->RangeMultiplier (4)->Range (16, 1024);
+BENCHMARK (design_approx<math_approx::biquad_type::high_shelf, 9, 5>)->RangeMultiplier (4)->Range (16, 1024);
+
+BENCHMARK_MAIN();
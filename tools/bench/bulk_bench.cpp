@@ -0,0 +1,60 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+
+template <typename T>
+static std::vector<T> make_data (size_t N)
+{
+    std::vector<T> x (N);
+    for (size_t i = 0; i < N; ++i)
+        x[i] = (T) (0.1 + 9.9 * (double) i / (double) N);
+    return x;
+}
+
+// native: double buffers, computed with double (batches)
+// mixed: double buffers, narrowed to float (batches), and widened back
+// float: float buffers, for reference
+// (512 values fit in L1 cache, so the conversions are the only extra cost for the mixed version)
+#define BULK_BENCH(name, func) \
+void name##_native_double (benchmark::State& state) \
+{ \
+const auto x = make_data<double> ((size_t) state.range (0)); \
+std::vector<double> y (x.size()); \
+for (auto _ : state) \
+{ \
+math_approx::process_bulk (x.data(), y.data(), x.size(), [] (auto v) { return func (v); }); \
+benchmark::DoNotOptimize (y.data()); \
+} \
+state.SetItemsProcessed ((int64_t) state.iterations() * (int64_t) x.size()); \
+} \
+BENCHMARK (name##_native_double)->Arg (512)->Arg (4096); \
+void name##_mixed_precision (benchmark::State& state) \
+{ \
+const auto x = make_data<double> ((size_t) state.range (0)); \
+std::vector<double> y (x.size()); \
+for (auto _ : state) \
+{ \
+math_approx::process_bulk_mixed_precision (x.data(), y.data(), x.size(), [] (auto v) { return func (v); }); \
+benchmark::DoNotOptimize (y.data()); \
+} \
+state.SetItemsProcessed ((int64_t) state.iterations() * (int64_t) x.size()); \
+} \
+BENCHMARK (name##_mixed_precision)->Arg (512)->Arg (4096); \
+void name##_float (benchmark::State& state) \
+{ \
+const auto x = make_data<float> ((size_t) state.range (0)); \
+std::vector<float> y (x.size()); \
+for (auto _ : state) \
+{ \
+math_approx::process_bulk (x.data(), y.data(), x.size(), [] (auto v) { return func (v); }); \
+benchmark::DoNotOptimize (y.data()); \
+} \
+state.SetItemsProcessed ((int64_t) state.iterations() * (int64_t) x.size()); \
+} \
+BENCHMARK (name##_float)->Arg (512)->Arg (4096);
+
+BULK_BENCH (exp5, math_approx::exp<5>)
+BULK_BENCH (log5, math_approx::log<5>)
+BULK_BENCH (tanh7, math_approx::tanh<7>)
+BULK_BENCH (sin9, math_approx::sin<9>)
+
+BENCHMARK_MAIN();
@@ -0,0 +1,164 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+
+// one 20 ms frame at 8 kHz, for each channel
+static constexpr size_t frame_size = 160;
+
+static std::vector<float> make_float_frames (size_t num_channels)
+{
+    std::vector<float> x (frame_size * num_channels);
+    for (size_t i = 0; i < x.size(); ++i)
+        x[i] = 0.9f * std::sin (0.37f * (float) i) * std::sin (0.0013f * (float) i);
+    return x;
+}
+
+static std::vector<int16_t> make_pcm_frames (size_t num_channels)
+{
+    const auto x = make_float_frames (num_channels);
+    std::vector<int16_t> pcm (x.size());
+    for (size_t i = 0; i < x.size(); ++i)
+        pcm[i] = (int16_t) (x[i] * 32767.0f);
+    return pcm;
+}
+
+static std::vector<uint8_t> make_code_frames (size_t num_channels)
+{
+    std::vector<uint8_t> codes (frame_size * num_channels);
+    for (size_t i = 0; i < codes.size(); ++i)
+        codes[i] = (uint8_t) ((i * 97) & 0xff);
+    return codes;
+}
+
+// Table-search G.711 encoders, as in the ITU-T/Sun reference implementation
+static uint8_t linear_to_ulaw_reference (int16_t pcm_val)
+{
+    static constexpr int seg_uend[8] = { 0x3F, 0x7F, 0xFF, 0x1FF, 0x3FF, 0x7FF, 0xFFF, 0x1FFF };
+    int pcm = pcm_val >> 2;
+    const auto mask = pcm < 0 ? 0x7F : 0xFF;
+    pcm = std::min (std::abs (pcm), 8159) + (0x84 >> 2);
+
+    int seg = 0;
+    while (seg < 8 && pcm > seg_uend[seg])
+        ++seg;
+    if (seg >= 8)
+        return (uint8_t) (0x7F ^ mask);
+    return (uint8_t) (((seg << 4) | ((pcm >> (seg + 1)) & 0xF)) ^ mask);
+}
+
+static uint8_t linear_to_alaw_reference (int16_t pcm_val)
+{
+    static constexpr int seg_aend[8] = { 0x1F, 0x3F, 0x7F, 0xFF, 0x1FF, 0x3FF, 0x7FF, 0xFFF };
+    int pcm = pcm_val >> 3;
+    const auto mask = pcm >= 0 ? 0xD5 : 0x55;
+    if (pcm < 0)
+        pcm = -pcm - 1;
+
+    int seg = 0;
+    while (seg < 8 && pcm > seg_aend[seg])
+        ++seg;
+    if (seg >= 8)
+        return (uint8_t) (0x7F ^ mask);
+    const auto aval = (seg << 4) | (seg < 2 ? (pcm >> 1) & 0xF : (pcm >> seg) & 0xF);
+    return (uint8_t) (aval ^ mask);
+}
+
+static int16_t ulaw_to_linear_reference (uint8_t u_val)
+{
+    u_val = (uint8_t) ~u_val;
+    int t = ((u_val & 0xF) << 3) + 0x84;
+    t <<= (u_val & 0x70) >> 4;
+    return (int16_t) ((u_val & 0x80) ? (0x84 - t) : (t - 0x84));
+}
+
+#define G711_ENCODE_BENCH(name, func) \
+void name (benchmark::State& state) \
+{ \
+const auto pcm = make_pcm_frames ((size_t) state.range (0)); \
+std::vector<uint8_t> codes (pcm.size()); \
+for (auto _ : state) \
+{ \
+func (pcm.data(), codes.data(), pcm.size()); \
+benchmark::DoNotOptimize (codes.data()); \
+} \
+state.SetItemsProcessed ((int64_t) state.iterations() * (int64_t) pcm.size()); \
+} \
+BENCHMARK (name)->Arg (1024)->Arg (4096);
+
+static void mu_law_encode_reference (const int16_t* pcm, uint8_t* codes, size_t N)
+{
+    for (size_t n = 0; n < N; ++n)
+        codes[n] = linear_to_ulaw_reference (pcm[n]);
+}
+
+static void a_law_encode_reference (const int16_t* pcm, uint8_t* codes, size_t N)
+{
+    for (size_t n = 0; n < N; ++n)
+        codes[n] = linear_to_alaw_reference (pcm[n]);
+}
+
+G711_ENCODE_BENCH (g711_mu_law_encode_reference, mu_law_encode_reference)
+G711_ENCODE_BENCH (g711_mu_law_encode_approx, math_approx::mu_law_encode)
+G711_ENCODE_BENCH (g711_a_law_encode_reference, a_law_encode_reference)
+G711_ENCODE_BENCH (g711_a_law_encode_approx, math_approx::a_law_encode)
+
+void g711_mu_law_decode_reference (benchmark::State& state)
+{
+    const auto codes = make_code_frames ((size_t) state.range (0));
+    std::vector<int16_t> pcm (codes.size());
+    for (auto _ : state)
+    {
+        for (size_t n = 0; n < codes.size(); ++n)
+            pcm[n] = ulaw_to_linear_reference (codes[n]);
+        benchmark::DoNotOptimize (pcm.data());
+    }
+    state.SetItemsProcessed ((int64_t) state.iterations() * (int64_t) codes.size());
+}
+BENCHMARK (g711_mu_law_decode_reference)->Arg (1024)->Arg (4096);
+
+void g711_mu_law_decode_approx (benchmark::State& state)
+{
+    const auto codes = make_code_frames ((size_t) state.range (0));
+    std::vector<int16_t> pcm (codes.size());
+    for (auto _ : state)
+    {
+        math_approx::mu_law_decode (codes.data(), pcm.data(), codes.size());
+        benchmark::DoNotOptimize (pcm.data());
+    }
+    state.SetItemsProcessed ((int64_t) state.iterations() * (int64_t) codes.size());
+}
+BENCHMARK (g711_mu_law_decode_approx)->Arg (1024)->Arg (4096);
+
+#define CONTINUOUS_BENCH(name, func) \
+void name (benchmark::State& state) \
+{ \
+const auto x = make_float_frames ((size_t) state.range (0)); \
+std::vector<float> y (x.size()); \
+for (auto _ : state) \
+{ \
+func (x.data(), y.data(), x.size()); \
+benchmark::DoNotOptimize (y.data()); \
+} \
+state.SetItemsProcessed ((int64_t) state.iterations() * (int64_t) x.size()); \
+} \
+BENCHMARK (name)->Arg (1024)->Arg (4096);
+
+static void mu_law_compress_std (const float* x, float* y, size_t N)
+{
+    for (size_t n = 0; n < N; ++n)
+        y[n] = std::copysign (std::log1p (255.0f * std::abs (x[n])) * (1.0f / 5.5451774f), x[n]);
+}
+
+static void mu_law_expand_std (const float* x, float* y, size_t N)
+{
+    for (size_t n = 0; n < N; ++n)
+        y[n] = std::copysign (std::expm1 (5.5451774f * std::abs (x[n])) * (1.0f / 255.0f), x[n]);
+}
+
+CONTINUOUS_BENCH (mu_law_compress_libm, mu_law_compress_std)
+CONTINUOUS_BENCH (mu_law_compress_approx, math_approx::mu_law_compress<5>)
+CONTINUOUS_BENCH (mu_law_expand_libm, mu_law_expand_std)
+CONTINUOUS_BENCH (mu_law_expand_approx, math_approx::mu_law_expand<5>)
+CONTINUOUS_BENCH (a_law_compress_approx, math_approx::a_law_compress<5>)
+CONTINUOUS_BENCH (a_law_expand_approx, math_approx::a_law_expand<5>)
+
+BENCHMARK_MAIN();
@@ -0,0 +1,92 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+
+// Each benchmark is run with a signal that starts at 1 (and decays over the block),
+// and a signal that starts at 1e-39, which is already in the denormal range.
+// With the denormals flushed, the throughput should be the same for both.
+static constexpr size_t N = 2048;
+static float start_level (const benchmark::State& state)
+{
+    return state.range (0) == 0 ? 1.0f : 1.0e-39f;
+}
+
+static std::vector<float> make_decaying_signal (float start)
+{
+    std::vector<float> x (N);
+    auto level = start;
+    for (size_t i = 0; i < N; ++i)
+    {
+        x[i] = (i % 2 == 0) ? level : -level;
+        level *= 0.99f;
+    }
+    return x;
+}
+
+// a feedback loop decaying into silence: y[n] = tanh(g * y[n-1])
+template <math_approx::denormal_mode mode>
+static void feedback_decay (benchmark::State& state)
+{
+    const auto g = math_approx::exp<5> (-0.05f);
+    const auto process = [&]
+    {
+        auto y = start_level (state);
+        for (size_t i = 0; i < N; ++i)
+        {
+            y = math_approx::tanh<5> (g * y);
+            benchmark::DoNotOptimize (y);
+        }
+    };
+
+    for (auto _ : state)
+    {
+        if constexpr (mode == math_approx::denormal_mode::flush)
+        {
+            math_approx::scoped_flush_denormals guard {};
+            process();
+        }
+        else
+        {
+            process();
+        }
+    }
+    state.SetItemsProcessed ((int64_t) state.iterations() * (int64_t) N);
+}
+BENCHMARK (feedback_decay<math_approx::denormal_mode::preserve>)->Arg (0)->Arg (1);
+BENCHMARK (feedback_decay<math_approx::denormal_mode::flush>)->Arg (0)->Arg (1);
+
+// a decaying signal through a bulk saturator
+template <math_approx::denormal_mode mode>
+static void bulk_tanh_decay (benchmark::State& state)
+{
+    const auto x = make_decaying_signal (start_level (state));
+    std::vector<float> y (x.size());
+    for (auto _ : state)
+    {
+        math_approx::process_bulk<mode> (x.data(), y.data(), x.size(), [] (auto v)
+                                         { return math_approx::tanh<5> (v); });
+        benchmark::DoNotOptimize (y.data());
+    }
+    state.SetItemsProcessed ((int64_t) state.iterations() * (int64_t) N);
+}
+BENCHMARK (bulk_tanh_decay<math_approx::denormal_mode::preserve>)->Arg (0)->Arg (1);
+BENCHMARK (bulk_tanh_decay<math_approx::denormal_mode::flush>)->Arg (0)->Arg (1);
+
+// an exponential decay envelope, exp(-n / tau), which underflows after ~90 tau
+template <math_approx::special_value_policy policy>
+static void exp_envelope (benchmark::State& state)
+{
+    const auto start = state.range (0) == 0 ? 0.0f : -100.0f;
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            auto y = math_approx::exp<5, false, true, float, policy> (start - 0.01f * (float) i);
+            benchmark::DoNotOptimize (y);
+        }
+    }
+    state.SetItemsProcessed ((int64_t) state.iterations() * (int64_t) N);
+}
+BENCHMARK (exp_envelope<math_approx::special_value_policy::ieee>)->Arg (0)->Arg (1);
+BENCHMARK (exp_envelope<math_approx::special_value_policy::flush_denormals>)->Arg (0)->Arg (1);
+
+BENCHMARK_MAIN();
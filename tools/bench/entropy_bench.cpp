@@ -0,0 +1,103 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+#include <random>
+
+static constexpr size_t N = 1 << 16;
+static const auto make_probabilities = [] (unsigned seed)
+{
+    std::minstd_rand rng { seed };
+    std::uniform_real_distribution<float> dist { 0.0f, 2.0f / (float) N };
+    std::vector<float> p (N);
+    for (size_t n = 0; n < N; ++n)
+        p[n] = n % 17 == 0 ? 0.0f : dist (rng);
+    return p;
+};
+static const auto data_p = make_probabilities (1);
+static const auto data_q = make_probabilities (2);
+
+void entropy_std (benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        float sum = 0.0f;
+        for (auto p : data_p)
+            sum -= p > 0.0f ? p * std::log (p) : 0.0f;
+        benchmark::DoNotOptimize (sum);
+    }
+}
+BENCHMARK (entropy_std);
+
+template <int order>
+void entropy_approx (benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto sum = math_approx::entropy<order> (data_p.data(), N);
+        benchmark::DoNotOptimize (sum);
+    }
+}
+BENCHMARK (entropy_approx<6>);
+BENCHMARK (entropy_approx<5>);
+BENCHMARK (entropy_approx<4>);
+BENCHMARK (entropy_approx<3>);
+
+void cross_entropy_std (benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        float sum = 0.0f;
+        for (size_t n = 0; n < N; ++n)
+            sum -= data_p[n] * std::log (std::max (data_q[n], 1.0e-30f));
+        benchmark::DoNotOptimize (sum);
+    }
+}
+BENCHMARK (cross_entropy_std);
+
+template <int order>
+void cross_entropy_approx (benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto sum = math_approx::cross_entropy<order> (data_p.data(), data_q.data(), N);
+        benchmark::DoNotOptimize (sum);
+    }
+}
+BENCHMARK (cross_entropy_approx<6>);
+BENCHMARK (cross_entropy_approx<4>);
+
+void binary_cross_entropy_std (benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        float sum = 0.0f;
+        for (size_t n = 0; n < N; ++n)
+        {
+            const auto y = (float) (n & 1);
+            const auto p = data_q[n] * (float) N * 0.5f;
+            sum -= y * std::log (std::max (p, 1.0e-30f)) + (1.0f - y) * std::log (std::max (1.0f - p, 1.0e-30f));
+        }
+        benchmark::DoNotOptimize (sum);
+    }
+}
+BENCHMARK (binary_cross_entropy_std);
+
+template <int order>
+void binary_cross_entropy_approx (benchmark::State& state)
+{
+    std::vector<float> y (N), p (N);
+    for (size_t n = 0; n < N; ++n)
+    {
+        y[n] = (float) (n & 1);
+        p[n] = data_q[n] * (float) N * 0.5f;
+    }
+
+    for (auto _ : state)
+    {
+        auto sum = math_approx::binary_cross_entropy<order> (y.data(), p.data(), N);
+        benchmark::DoNotOptimize (sum);
+    }
+}
+BENCHMARK (binary_cross_entropy_approx<6>);
+BENCHMARK (binary_cross_entropy_approx<4>);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,82 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+
+static constexpr size_t N = 2048;
+static constexpr float start = -3.0f;
+static constexpr float slope = 5.0e-5f;
+
+void ramp_std (benchmark::State& state)
+{
+    std::vector<float> y (N);
+    for (auto _ : state)
+    {
+        for (size_t n = 0; n < N; ++n)
+            y[n] = std::exp (start + (float) n * slope);
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (ramp_std);
+
+template <int order>
+void ramp_exp_per_sample (benchmark::State& state)
+{
+    std::vector<float> y (N);
+    for (auto _ : state)
+    {
+        for (size_t n = 0; n < N; ++n)
+            y[n] = math_approx::exp<order> (start + (float) n * slope);
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (ramp_exp_per_sample<6>);
+BENCHMARK (ramp_exp_per_sample<4>);
+
+template <int order>
+void ramp_recurrence (benchmark::State& state)
+{
+    std::vector<float> y (N);
+    math_approx::exp_ramp<order> ramp;
+    for (auto _ : state)
+    {
+        ramp.set (start, slope);
+        ramp.process_block (y.data(), N);
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (ramp_recurrence<6>);
+BENCHMARK (ramp_recurrence<4>);
+
+template <int order>
+void ramp_recurrence_per_sample (benchmark::State& state)
+{
+    std::vector<float> y (N);
+    math_approx::exp_ramp<order> ramp;
+    for (auto _ : state)
+    {
+        ramp.set (start, slope);
+        for (auto& y_n : y)
+            y_n = ramp.process();
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (ramp_recurrence_per_sample<6>);
+
+#if defined(XSIMD_HPP)
+template <int order>
+void ramp_recurrence_simd_lanes (benchmark::State& state)
+{
+    // one ramp per SIMD lane
+    using B = xsimd::batch<float>;
+    std::vector<B> y (N);
+    math_approx::exp_ramp<order, B> ramp;
+    for (auto _ : state)
+    {
+        ramp.set (B (start), B (slope));
+        ramp.process_block (y.data(), N);
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (ramp_recurrence_simd_lanes<6>);
+#endif
+
+BENCHMARK_MAIN();
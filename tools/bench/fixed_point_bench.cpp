@@ -0,0 +1,115 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+
+static std::vector<int16_t> make_q15 (size_t N)
+{
+    std::vector<int16_t> x (N);
+    for (size_t i = 0; i < N; ++i)
+        x[i] = (int16_t) ((int) (i * 40503) - 32768);
+    return x;
+}
+
+static std::vector<int32_t> make_q31 (size_t N)
+{
+    std::vector<int32_t> x (N);
+    for (size_t i = 0; i < N; ++i)
+        x[i] = (int32_t) ((int64_t) i * 2654435761LL - 2147483648LL);
+    return x;
+}
+
+// The float round-trip that the fixed-point kernels replace: Q1.15 -> float -> approximation -> Q1.15
+template <typename Func>
+static void float_round_trip (const int16_t* x, int16_t* y, size_t N, Func&& func)
+{
+    for (size_t n = 0; n < N; ++n)
+    {
+        const auto v = func ((float) x[n] * (1.0f / 32768.0f));
+        y[n] = (int16_t) std::clamp (v * 32768.0f, -32768.0f, 32767.0f);
+    }
+}
+
+static void sin_turns_float (const int16_t* x, int16_t* y, size_t N)
+{
+    float_round_trip (x, y, N, [] (float v)
+                      { return math_approx::sin_turns<7> (v); });
+}
+
+static void pow2_float (const int16_t* x, int16_t* y, size_t N)
+{
+    float_round_trip (x, y, N, [] (float v)
+                      { return math_approx::exp2<4> (v - 1.0f); });
+}
+
+static void log2_float (const int16_t* x, int16_t* y, size_t N)
+{
+    float_round_trip (x, y, N, [] (float v)
+                      { return math_approx::log2<5> (v) * (1.0f / 16.0f); });
+}
+
+static void tanh_float (const int16_t* x, int16_t* y, size_t N)
+{
+    float_round_trip (x, y, N, [] (float v)
+                      { return math_approx::tanh<5> (v); });
+}
+
+// The scalar fixed-point kernels in a loop, for comparison with the bulk (SIMD) kernels
+template <typename T, T (*func) (T)>
+static void scalar_loop (const T* x, T* y, size_t N)
+{
+    for (size_t n = 0; n < N; ++n)
+        y[n] = func (x[n]);
+}
+
+#define Q15_BENCH(name, func) \
+void name (benchmark::State& state) \
+{ \
+const auto x = make_q15 ((size_t) state.range (0)); \
+std::vector<int16_t> y (x.size()); \
+for (auto _ : state) \
+{ \
+func (x.data(), y.data(), x.size()); \
+benchmark::DoNotOptimize (y.data()); \
+} \
+state.SetItemsProcessed ((int64_t) state.iterations() * (int64_t) x.size()); \
+} \
+BENCHMARK (name)->Arg (1024)->Arg (4096);
+
+#define Q31_BENCH(name, func) \
+void name (benchmark::State& state) \
+{ \
+const auto x = make_q31 ((size_t) state.range (0)); \
+std::vector<int32_t> y (x.size()); \
+for (auto _ : state) \
+{ \
+func (x.data(), y.data(), x.size()); \
+benchmark::DoNotOptimize (y.data()); \
+} \
+state.SetItemsProcessed ((int64_t) state.iterations() * (int64_t) x.size()); \
+} \
+BENCHMARK (name)->Arg (1024)->Arg (4096);
+
+Q15_BENCH (sin_turns_q15_float, sin_turns_float)
+Q15_BENCH (sin_turns_q15_fixed_scalar, (scalar_loop<int16_t, math_approx::sin_turns_q15<>>))
+Q15_BENCH (sin_turns_q15_fixed, math_approx::sin_turns_q15<>)
+Q31_BENCH (sin_turns_q31_fixed_scalar, (scalar_loop<int32_t, math_approx::sin_turns_q31<>>))
+Q31_BENCH (sin_turns_q31_fixed, math_approx::sin_turns_q31<>)
+
+Q15_BENCH (pow2_q15_float, pow2_float)
+Q15_BENCH (pow2_q15_fixed_scalar, (scalar_loop<int16_t, math_approx::pow2_q15<>>))
+Q15_BENCH (pow2_q15_fixed, math_approx::pow2_q15<>)
+Q31_BENCH (pow2_q31_fixed_scalar, (scalar_loop<int32_t, math_approx::pow2_q31<>>))
+Q31_BENCH (pow2_q31_fixed, math_approx::pow2_q31<>)
+
+Q15_BENCH (log2_q15_float, log2_float)
+Q15_BENCH (log2_q15_fixed_scalar, (scalar_loop<int16_t, math_approx::log2_q15<>>))
+Q15_BENCH (log2_q15_fixed, math_approx::log2_q15<>)
+Q31_BENCH (log2_q31_fixed_scalar, (scalar_loop<int32_t, math_approx::log2_q31<>>))
+Q31_BENCH (log2_q31_fixed, math_approx::log2_q31<>)
+
+Q15_BENCH (tanh_q15_float, tanh_float)
+Q15_BENCH (tanh_q15_fixed_scalar, (scalar_loop<int16_t, math_approx::tanh_q15<>>))
+Q15_BENCH (tanh_q15_fixed, math_approx::tanh_q15<>)
+Q31_BENCH (tanh_q31_fixed_scalar, (scalar_loop<int32_t, math_approx::tanh_q31<>>))
+Q31_BENCH (tanh_q31_fixed, math_approx::tanh_q31<>)
+
+BENCHMARK_MAIN();
@@ -0,0 +1,97 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+#include <random>
+
+static constexpr size_t num_rows = 64;
+static const auto data = []
+{
+    std::minstd_rand rng { 0x1234 };
+    std::normal_distribution<float> dist { 0.5f, 2.0f };
+    std::vector<float> x (num_rows * 4096);
+    for (auto& v : x)
+        v = dist (rng);
+    return x;
+}();
+static const auto scale = std::vector<float> (4096, 1.1f);
+static const auto bias = std::vector<float> (4096, 0.1f);
+
+void layer_norm_std (benchmark::State& state)
+{
+    const auto num_cols = (size_t) state.range (0);
+    std::vector<float> y (num_rows * num_cols);
+    for (auto _ : state)
+    {
+        for (size_t r = 0; r < num_rows; ++r)
+        {
+            const auto* x_row = data.data() + r * num_cols;
+            auto* y_row = y.data() + r * num_cols;
+
+            float mean = 0.0f;
+            for (size_t n = 0; n < num_cols; ++n)
+                mean += x_row[n];
+            mean /= (float) num_cols;
+
+            float var = 0.0f;
+            for (size_t n = 0; n < num_cols; ++n)
+                var += (x_row[n] - mean) * (x_row[n] - mean);
+            var /= (float) num_cols;
+
+            const auto inv_std = 1.0f / std::sqrt (var + 1.0e-5f);
+            for (size_t n = 0; n < num_cols; ++n)
+                y_row[n] = (x_row[n] - mean) * inv_std * scale[n] + bias[n];
+        }
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (layer_norm_std)->Arg (768)->Arg (4096);
+
+void layer_norm_approx (benchmark::State& state)
+{
+    const auto num_cols = (size_t) state.range (0);
+    std::vector<float> y (num_rows * num_cols);
+    for (auto _ : state)
+    {
+        math_approx::layer_norm_rows (data.data(), y.data(), num_rows, num_cols, scale.data(), bias.data());
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (layer_norm_approx)->Arg (768)->Arg (4096);
+
+void rms_norm_std (benchmark::State& state)
+{
+    const auto num_cols = (size_t) state.range (0);
+    std::vector<float> y (num_rows * num_cols);
+    for (auto _ : state)
+    {
+        for (size_t r = 0; r < num_rows; ++r)
+        {
+            const auto* x_row = data.data() + r * num_cols;
+            auto* y_row = y.data() + r * num_cols;
+
+            float mean_sq = 0.0f;
+            for (size_t n = 0; n < num_cols; ++n)
+                mean_sq += x_row[n] * x_row[n];
+            mean_sq /= (float) num_cols;
+
+            const auto inv_rms = 1.0f / std::sqrt (mean_sq + 1.0e-6f);
+            for (size_t n = 0; n < num_cols; ++n)
+                y_row[n] = x_row[n] * inv_rms * scale[n];
+        }
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (rms_norm_std)->Arg (768)->Arg (4096);
+
+void rms_norm_approx (benchmark::State& state)
+{
+    const auto num_cols = (size_t) state.range (0);
+    std::vector<float> y (num_rows * num_cols);
+    for (auto _ : state)
+    {
+        math_approx::rms_norm_rows (data.data(), y.data(), num_rows, num_cols, scale.data());
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (rms_norm_approx)->Arg (768)->Arg (4096);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,61 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+
+static constexpr size_t N = 256;
+static constexpr float fs = 48000.0f;
+static constexpr float f0 = 11.0f;
+
+template <int order>
+void partials_scalar (benchmark::State& state)
+{
+    // one partial at a time, with float phases
+    const auto num_partials = (size_t) state.range (0);
+    std::vector<float> phases (num_partials, 0.0f);
+    std::vector<float> increments (num_partials);
+    std::vector<float> amplitudes (num_partials);
+    for (size_t k = 0; k < num_partials; ++k)
+    {
+        increments[k] = f0 * (float) (k + 1) / fs;
+        amplitudes[k] = 1.0f / (float) (k + 1);
+    }
+
+    std::vector<float> y (N);
+    for (auto _ : state)
+    {
+        std::fill (y.begin(), y.end(), 0.0f);
+        for (size_t k = 0; k < num_partials; ++k)
+        {
+            for (size_t n = 0; n < N; ++n)
+            {
+                y[n] += amplitudes[k] * math_approx::sin_turns<order> (phases[k]);
+                phases[k] += increments[k];
+            }
+        }
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (partials_scalar<9>)->RangeMultiplier (2)->Range (64, 2048);
+BENCHMARK (partials_scalar<7>)->RangeMultiplier (2)->Range (64, 2048);
+
+template <int order>
+void partials_bank (benchmark::State& state)
+{
+    const auto num_partials = (size_t) state.range (0);
+    math_approx::oscillator_bank<order> bank;
+    bank.prepare (fs, num_partials);
+    for (size_t k = 0; k < num_partials; ++k)
+        bank.set_partial (k, f0 * (float) (k + 1), 1.0f / (float) (k + 1));
+    bank.reset();
+
+    std::vector<float> y (N);
+    for (auto _ : state)
+    {
+        std::fill (y.begin(), y.end(), 0.0f);
+        bank.process_block (y.data(), N);
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (partials_bank<9>)->RangeMultiplier (2)->Range (64, 2048);
+BENCHMARK (partials_bank<7>)->RangeMultiplier (2)->Range (64, 2048);
+
+BENCHMARK_MAIN();
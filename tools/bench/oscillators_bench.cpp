@@ -0,0 +1,116 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+
+static constexpr size_t N = 2048;
+static constexpr float fs = 48000.0f;
+
+static const auto fm_data = []
+{
+    std::vector<float> f (N);
+    for (size_t n = 0; n < N; ++n)
+        f[n] = 1000.0f + 800.0f * std::sin (2.0f * (float) M_PI * 5.0f * (float) n / fs);
+    return f;
+}();
+
+void osc_std (benchmark::State& state)
+{
+    std::vector<float> y (N);
+    float phase = 0.0f;
+    for (auto _ : state)
+    {
+        for (size_t n = 0; n < N; ++n)
+        {
+            y[n] = std::sin (2.0f * (float) M_PI * phase);
+            phase += 440.0f / fs;
+            phase -= std::floor (phase);
+        }
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (osc_std);
+
+template <int order>
+void osc_float_phase (benchmark::State& state)
+{
+    std::vector<float> y (N);
+    float phase = 0.0f;
+    for (auto _ : state)
+    {
+        for (size_t n = 0; n < N; ++n)
+        {
+            y[n] = math_approx::sin_turns<order> (phase);
+            phase += 440.0f / fs;
+        }
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (osc_float_phase<9>);
+BENCHMARK (osc_float_phase<7>);
+
+template <int order>
+void osc_int_phase (benchmark::State& state)
+{
+    std::vector<float> y (N);
+    math_approx::sine_oscillator<order> osc;
+    osc.prepare (fs);
+    osc.set_frequency (440.0f);
+    for (auto _ : state)
+    {
+        osc.process_block (y.data(), N);
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (osc_int_phase<9>);
+BENCHMARK (osc_int_phase<7>);
+
+template <int order>
+void osc_float_phase_fm (benchmark::State& state)
+{
+    std::vector<float> y (N);
+    float phase = 0.0f;
+    for (auto _ : state)
+    {
+        for (size_t n = 0; n < N; ++n)
+        {
+            y[n] = math_approx::sin_turns<order> (phase);
+            phase += fm_data[n] * (1.0f / fs);
+        }
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (osc_float_phase_fm<9>);
+
+template <int order>
+void osc_int_phase_fm (benchmark::State& state)
+{
+    std::vector<float> y (N);
+    math_approx::sine_oscillator<order> osc;
+    osc.prepare (fs);
+    for (auto _ : state)
+    {
+        osc.process_block (y.data(), fm_data.data(), N);
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (osc_int_phase_fm<9>);
+
+#if defined(XSIMD_HPP)
+template <int order>
+void osc_int_phase_simd (benchmark::State& state)
+{
+    // one voice per SIMD lane
+    using B = xsimd::batch<float>;
+    std::vector<B> y (N);
+    math_approx::sine_oscillator<order, B> osc;
+    osc.prepare (fs);
+    osc.set_frequency (B (440.0f));
+    for (auto _ : state)
+    {
+        osc.process_block (y.data(), N);
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (osc_int_phase_simd<9>);
+#endif
+
+BENCHMARK_MAIN();
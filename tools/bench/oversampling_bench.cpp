@@ -0,0 +1,65 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+
+static constexpr size_t N = 512;
+
+static const auto input_data = []
+{
+    std::vector<float> x (N);
+    for (size_t i = 0; i < N; ++i)
+        x[i] = 3.0f * std::sin (0.05f * (float) i);
+    return x;
+}();
+
+// processes one channel, through the full up-sample / nonlinearity / down-sample chain
+template <int order, math_approx::oversampling_phase phase>
+void tanh_oversampled (benchmark::State& state)
+{
+    math_approx::oversampled_nonlinearity<float> processor;
+    processor.prepare ((int) state.range (0), N, phase);
+    std::vector<float> y (N);
+    for (auto _ : state)
+    {
+        processor.process (input_data.data(), y.data(), N, [] (auto x)
+                           { return math_approx::tanh<order> (x); });
+        benchmark::DoNotOptimize (y.data());
+    }
+    state.SetItemsProcessed ((int64_t) state.iterations() * (int64_t) N);
+}
+
+template <math_approx::oversampling_phase phase>
+void tanh_std_oversampled (benchmark::State& state)
+{
+    math_approx::oversampled_nonlinearity<float> processor;
+    processor.prepare ((int) state.range (0), N, phase);
+    std::vector<float> y (N);
+    for (auto _ : state)
+    {
+        processor.process (input_data.data(), y.data(), N, [] (auto x)
+                           {
+                               if constexpr (std::is_same_v<decltype (x), float>)
+                                   return std::tanh (x);
+#if defined(XSIMD_HPP)
+                               else
+                                   return xsimd::tanh (x);
+#endif
+                           });
+        benchmark::DoNotOptimize (y.data());
+    }
+    state.SetItemsProcessed ((int64_t) state.iterations() * (int64_t) N);
+}
+
+static constexpr auto linear = math_approx::oversampling_phase::linear;
+static constexpr auto low_latency = math_approx::oversampling_phase::low_latency;
+
+BENCHMARK (tanh_std_oversampled<linear>)->Arg (1)->Arg (2)->Arg (4)->Arg (8);
+BENCHMARK (tanh_oversampled<3, linear>)->Arg (1)->Arg (2)->Arg (4)->Arg (8);
+BENCHMARK (tanh_oversampled<5, linear>)->Arg (1)->Arg (2)->Arg (4)->Arg (8);
+BENCHMARK (tanh_oversampled<7, linear>)->Arg (1)->Arg (2)->Arg (4)->Arg (8);
+
+BENCHMARK (tanh_std_oversampled<low_latency>)->Arg (1)->Arg (2)->Arg (4)->Arg (8);
+BENCHMARK (tanh_oversampled<3, low_latency>)->Arg (1)->Arg (2)->Arg (4)->Arg (8);
+BENCHMARK (tanh_oversampled<5, low_latency>)->Arg (1)->Arg (2)->Arg (4)->Arg (8);
+BENCHMARK (tanh_oversampled<7, low_latency>)->Arg (1)->Arg (2)->Arg (4)->Arg (8);
+
+BENCHMARK_MAIN();
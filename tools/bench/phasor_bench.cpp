@@ -0,0 +1,117 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+
+static constexpr size_t N = 4096;
+static constexpr float step = 1.0f / (float) N;
+static constexpr float chirp_start_step = 20.0f / 48000.0f;
+static constexpr float chirp_step_increment = (20000.0f - 20.0f) / 48000.0f / (float) N;
+
+void grid_std (benchmark::State& state)
+{
+    std::vector<float> re (N);
+    std::vector<float> im (N);
+    for (auto _ : state)
+    {
+        for (size_t n = 0; n < N; ++n)
+        {
+            re[n] = std::cos (2.0f * (float) M_PI * (float) n * step);
+            im[n] = std::sin (2.0f * (float) M_PI * (float) n * step);
+        }
+        benchmark::DoNotOptimize (re.data());
+        benchmark::DoNotOptimize (im.data());
+    }
+}
+BENCHMARK (grid_std);
+
+template <int order>
+void grid_polynomial (benchmark::State& state)
+{
+    std::vector<float> re (N);
+    std::vector<float> im (N);
+    for (auto _ : state)
+    {
+        for (size_t n = 0; n < N; ++n)
+        {
+            re[n] = math_approx::cos_turns<order> ((float) n * step);
+            im[n] = math_approx::sin_turns<order> ((float) n * step);
+        }
+        benchmark::DoNotOptimize (re.data());
+        benchmark::DoNotOptimize (im.data());
+    }
+}
+BENCHMARK (grid_polynomial<9>);
+
+template <int order>
+void grid_phasor (benchmark::State& state)
+{
+    std::vector<float> re (N);
+    std::vector<float> im (N);
+    for (auto _ : state)
+    {
+        math_approx::phasor_grid<order> (re.data(), im.data(), N, 0.0f, step);
+        benchmark::DoNotOptimize (re.data());
+        benchmark::DoNotOptimize (im.data());
+    }
+}
+BENCHMARK (grid_phasor<9>);
+
+template <int order>
+void grid_phasor_interleaved (benchmark::State& state)
+{
+    std::vector<float> re_im (2 * N);
+    for (auto _ : state)
+    {
+        math_approx::phasor_grid_interleaved<order> (re_im.data(), N, 0.0f, step);
+        benchmark::DoNotOptimize (re_im.data());
+    }
+}
+BENCHMARK (grid_phasor_interleaved<9>);
+
+template <int order>
+void fft_twiddles (benchmark::State& state)
+{
+    std::vector<float> re (N / 2);
+    std::vector<float> im (N / 2);
+    for (auto _ : state)
+    {
+        math_approx::fft_twiddles<order> (re.data(), im.data(), N);
+        benchmark::DoNotOptimize (re.data());
+        benchmark::DoNotOptimize (im.data());
+    }
+}
+BENCHMARK (fft_twiddles<9>);
+
+void chirp_std (benchmark::State& state)
+{
+    std::vector<float> re (N);
+    std::vector<float> im (N);
+    for (auto _ : state)
+    {
+        for (size_t n = 0; n < N; ++n)
+        {
+            const auto phase = (double) n * (double) chirp_start_step + 0.5 * (double) n * (double) (n - 1) * (double) chirp_step_increment;
+            const auto turns = (float) (phase - std::nearbyint (phase));
+            re[n] = std::cos (2.0f * (float) M_PI * turns);
+            im[n] = std::sin (2.0f * (float) M_PI * turns);
+        }
+        benchmark::DoNotOptimize (re.data());
+        benchmark::DoNotOptimize (im.data());
+    }
+}
+BENCHMARK (chirp_std);
+
+template <int order>
+void chirp_phasor (benchmark::State& state)
+{
+    std::vector<float> re (N);
+    std::vector<float> im (N);
+    for (auto _ : state)
+    {
+        math_approx::chirp_grid<order> (re.data(), im.data(), N, 0.0f, chirp_start_step, chirp_step_increment);
+        benchmark::DoNotOptimize (re.data());
+        benchmark::DoNotOptimize (im.data());
+    }
+}
+BENCHMARK (chirp_phasor<9>);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,90 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+#include <random>
+
+static constexpr math_approx::quantization_params in_params_16 { 8.0f / 32768.0f, 0 };
+static constexpr math_approx::quantization_params out_params_16 { 1.0f / 32767.0f, 0 };
+
+void build_table_int16_std (benchmark::State& state)
+{
+    std::vector<int16_t> table (1 << 16);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < table.size(); ++i)
+        {
+            const auto x = in_params_16.scale * (float) (int16_t) (uint16_t) i;
+            table[i] = (int16_t) std::clamp ((int32_t) std::nearbyint (std::tanh (x) / out_params_16.scale), -32768, 32767);
+        }
+        benchmark::DoNotOptimize (table.data());
+    }
+}
+BENCHMARK (build_table_int16_std);
+
+#define BUILD_TABLE_BENCH(name, func) \
+void name (benchmark::State& state) \
+{ \
+std::vector<int16_t> table (1 << 16); \
+for (auto _ : state) \
+{ \
+math_approx::build_activation_table (table.data(), in_params_16, out_params_16, func); \
+benchmark::DoNotOptimize (table.data()); \
+} \
+} \
+BENCHMARK (name);
+BUILD_TABLE_BENCH (build_table_int16_tanh7, [] (auto x) { return math_approx::tanh<7> (x); })
+BUILD_TABLE_BENCH (build_table_int16_tanh5, [] (auto x) { return math_approx::tanh<5> (x); })
+BUILD_TABLE_BENCH (build_table_int16_sigmoid7, [] (auto x) { return math_approx::sigmoid<7> (x); })
+BUILD_TABLE_BENCH (build_table_int16_sigmoid_exp5, [] (auto x) { return math_approx::sigmoid_exp<5> (x); })
+
+static constexpr size_t N = 1 << 14;
+template <typename Q>
+const auto& quantized_data()
+{
+    static const auto data = []
+    {
+        std::minstd_rand rng { 0x1234 };
+        std::uniform_int_distribution<int32_t> dist { std::numeric_limits<Q>::min(), std::numeric_limits<Q>::max() };
+        std::vector<Q> x (N);
+        for (auto& q : x)
+            q = static_cast<Q> (dist (rng));
+        return x;
+    }();
+    return data;
+}
+
+template <typename Q>
+void apply_table_scalar (benchmark::State& state)
+{
+    std::vector<Q> table (1 << (8 * sizeof (Q)));
+    math_approx::build_activation_table (table.data(), { 1.0f / 32.0f, 0 }, { 1.0f / 127.0f, 0 }, [] (auto x)
+                                         { return math_approx::tanh<5> (x); });
+    const auto& x = quantized_data<Q>();
+    std::vector<Q> y (N);
+    for (auto _ : state)
+    {
+        for (size_t n = 0; n < N; ++n)
+            y[n] = table[static_cast<std::make_unsigned_t<Q>> (x[n])];
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (apply_table_scalar<int8_t>);
+BENCHMARK (apply_table_scalar<int16_t>);
+
+template <typename Q>
+void apply_table_simd (benchmark::State& state)
+{
+    std::vector<Q> table (1 << (8 * sizeof (Q)));
+    math_approx::build_activation_table (table.data(), { 1.0f / 32.0f, 0 }, { 1.0f / 127.0f, 0 }, [] (auto x)
+                                         { return math_approx::tanh<5> (x); });
+    const auto& x = quantized_data<Q>();
+    std::vector<Q> y (N);
+    for (auto _ : state)
+    {
+        math_approx::apply_activation_table (table.data(), x.data(), y.data(), N);
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (apply_table_simd<int8_t>);
+BENCHMARK (apply_table_simd<int16_t>);
+
+BENCHMARK_MAIN();
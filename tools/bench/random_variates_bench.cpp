@@ -0,0 +1,50 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+static constexpr size_t N = 4096;
+
+#define STD_DISTRIBUTION_BENCH(name, distribution) \
+void name (benchmark::State& state) \
+{ \
+std::mt19937 rng { 1234 }; \
+auto dist = distribution; \
+std::vector<float> y (N); \
+for (auto _ : state) \
+{ \
+for (auto& v : y) \
+v = dist (rng); \
+benchmark::DoNotOptimize (y.data()); \
+} \
+state.SetItemsProcessed ((int64_t) state.iterations() * (int64_t) N); \
+} \
+BENCHMARK (name);
+
+#define APPROX_DISTRIBUTION_BENCH(name, method) \
+void name (benchmark::State& state) \
+{ \
+math_approx::random_variate_engine engine { 1234 }; \
+std::vector<float> y (N); \
+for (auto _ : state) \
+{ \
+engine.method (y.data(), N); \
+benchmark::DoNotOptimize (y.data()); \
+} \
+state.SetItemsProcessed ((int64_t) state.iterations() * (int64_t) N); \
+} \
+BENCHMARK (name);
+
+STD_DISTRIBUTION_BENCH (uniform_std, std::uniform_real_distribution<float> {})
+APPROX_DISTRIBUTION_BENCH (uniform_approx, uniform)
+
+STD_DISTRIBUTION_BENCH (normal_std, std::normal_distribution<float> {})
+APPROX_DISTRIBUTION_BENCH (normal_approx, normal)
+
+STD_DISTRIBUTION_BENCH (exponential_std, std::exponential_distribution<float> {})
+APPROX_DISTRIBUTION_BENCH (exponential_approx, exponential)
+
+STD_DISTRIBUTION_BENCH (cauchy_std, std::cauchy_distribution<float> {})
+APPROX_DISTRIBUTION_BENCH (cauchy_approx, cauchy)
+
+BENCHMARK_MAIN();
@@ -0,0 +1,111 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+#include <random>
+
+static constexpr size_t max_hidden_size = 512;
+static const auto gates = []
+{
+    std::minstd_rand rng { 0x1234 };
+    std::uniform_real_distribution<float> dist { -6.0f, 6.0f };
+    std::vector<float> x (4 * max_hidden_size);
+    for (auto& v : x)
+        v = dist (rng);
+    return x;
+}();
+
+void lstm_std (benchmark::State& state)
+{
+    const auto N = (size_t) state.range (0);
+    std::vector<float> c (N, 0.5f), h (N);
+    const auto sigmoid = [] (float x)
+    { return 1.0f / (1.0f + std::exp (-x)); };
+    for (auto _ : state)
+    {
+        for (size_t n = 0; n < N; ++n)
+        {
+            c[n] = sigmoid (gates[N + n]) * c[n] + sigmoid (gates[n]) * std::tanh (gates[2 * N + n]);
+            h[n] = sigmoid (gates[3 * N + n]) * std::tanh (c[n]);
+        }
+        benchmark::DoNotOptimize (h.data());
+    }
+}
+BENCHMARK (lstm_std)->RangeMultiplier (2)->Range (64, max_hidden_size);
+
+template <int sigmoid_order, int tanh_order>
+void lstm_unfused (benchmark::State& state)
+{
+    const auto N = (size_t) state.range (0);
+    std::vector<float> c (N, 0.5f), h (N), activations (4 * N);
+    for (auto _ : state)
+    {
+        // one pass per gate, with intermediate buffers
+        const auto sig = [] (auto x)
+        { return math_approx::sigmoid<sigmoid_order> (x); };
+        math_approx::process_bulk (gates.data(), activations.data(), 2 * N, sig);
+        math_approx::process_bulk (gates.data() + 2 * N, activations.data() + 2 * N, N, [] (auto x)
+                                   { return math_approx::tanh<tanh_order> (x); });
+        math_approx::process_bulk (gates.data() + 3 * N, activations.data() + 3 * N, N, sig);
+        for (size_t n = 0; n < N; ++n)
+            c[n] = activations[N + n] * c[n] + activations[n] * activations[2 * N + n];
+        math_approx::process_bulk (c.data(), h.data(), N, [] (auto x)
+                                   { return math_approx::tanh<tanh_order> (x); });
+        for (size_t n = 0; n < N; ++n)
+            h[n] *= activations[3 * N + n];
+        benchmark::DoNotOptimize (h.data());
+    }
+}
+BENCHMARK (lstm_unfused<7, 7>)->RangeMultiplier (2)->Range (64, max_hidden_size);
+
+template <int sigmoid_order, int tanh_order>
+void lstm_fused (benchmark::State& state)
+{
+    const auto N = (size_t) state.range (0);
+    std::vector<float> c (N, 0.5f), h (N);
+    for (auto _ : state)
+    {
+        math_approx::lstm_cell<sigmoid_order, tanh_order> (gates.data(), c.data(), h.data(), N);
+        benchmark::DoNotOptimize (h.data());
+    }
+}
+BENCHMARK (lstm_fused<9, 11>)->RangeMultiplier (2)->Range (64, max_hidden_size);
+BENCHMARK (lstm_fused<7, 7>)->RangeMultiplier (2)->Range (64, max_hidden_size);
+BENCHMARK (lstm_fused<5, 5>)->RangeMultiplier (2)->Range (64, max_hidden_size);
+
+void gru_std (benchmark::State& state)
+{
+    const auto N = (size_t) state.range (0);
+    std::vector<float> h (N, 0.5f);
+    const auto* x_gates = gates.data();
+    const auto* h_gates = gates.data() + N;
+    const auto sigmoid = [] (float x)
+    { return 1.0f / (1.0f + std::exp (-x)); };
+    for (auto _ : state)
+    {
+        for (size_t n = 0; n < N; ++n)
+        {
+            const auto r = sigmoid (x_gates[n] + h_gates[n]);
+            const auto z = sigmoid (x_gates[N + n] + h_gates[N + n]);
+            const auto n_gate = std::tanh (x_gates[2 * N + n] + r * h_gates[2 * N + n]);
+            h[n] = (1.0f - z) * n_gate + z * h[n];
+        }
+        benchmark::DoNotOptimize (h.data());
+    }
+}
+BENCHMARK (gru_std)->RangeMultiplier (2)->Range (64, max_hidden_size);
+
+template <int sigmoid_order, int tanh_order>
+void gru_fused (benchmark::State& state)
+{
+    const auto N = (size_t) state.range (0);
+    std::vector<float> h (N, 0.5f);
+    for (auto _ : state)
+    {
+        math_approx::gru_cell<sigmoid_order, tanh_order> (gates.data(), gates.data() + N, h.data(), N);
+        benchmark::DoNotOptimize (h.data());
+    }
+}
+BENCHMARK (gru_fused<9, 11>)->RangeMultiplier (2)->Range (64, max_hidden_size);
+BENCHMARK (gru_fused<7, 7>)->RangeMultiplier (2)->Range (64, max_hidden_size);
+BENCHMARK (gru_fused<5, 5>)->RangeMultiplier (2)->Range (64, max_hidden_size);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,104 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+#include <random>
+
+static constexpr size_t head_dim = 128;
+static constexpr size_t num_heads = 32;
+static constexpr size_t num_freqs = head_dim / 2;
+
+static const auto freqs = []
+{
+    std::vector<float> f (num_freqs);
+    math_approx::rope_frequencies (f.data(), head_dim);
+    return f;
+}();
+
+static auto make_heads()
+{
+    std::minstd_rand rng { 0x1234 };
+    std::uniform_real_distribution<float> dist { -1.0f, 1.0f };
+    std::vector<float> x (head_dim * num_heads);
+    for (auto& v : x)
+        v = dist (rng);
+    return x;
+}
+
+void rope_table_std (benchmark::State& state)
+{
+    const auto num_positions = (size_t) state.range (0);
+    std::vector<float> cos_table (num_freqs * num_positions), sin_table (num_freqs * num_positions);
+    for (auto _ : state)
+    {
+        for (size_t p = 0; p < num_positions; ++p)
+        {
+            for (size_t i = 0; i < num_freqs; ++i)
+            {
+                const auto angle = (float) p * freqs[i] * 6.283185307f;
+                cos_table[p * num_freqs + i] = std::cos (angle);
+                sin_table[p * num_freqs + i] = std::sin (angle);
+            }
+        }
+        benchmark::DoNotOptimize (cos_table.data());
+        benchmark::DoNotOptimize (sin_table.data());
+    }
+}
+BENCHMARK (rope_table_std)->Arg (512)->Arg (4096);
+
+template <int order>
+void rope_table_approx (benchmark::State& state)
+{
+    const auto num_positions = (size_t) state.range (0);
+    std::vector<float> cos_table (num_freqs * num_positions), sin_table (num_freqs * num_positions);
+    for (auto _ : state)
+    {
+        math_approx::rope_table<order> (freqs.data(), cos_table.data(), sin_table.data(), num_freqs, 0, num_positions);
+        benchmark::DoNotOptimize (cos_table.data());
+        benchmark::DoNotOptimize (sin_table.data());
+    }
+}
+BENCHMARK (rope_table_approx<9>)->Arg (512)->Arg (4096);
+BENCHMARK (rope_table_approx<7>)->Arg (512)->Arg (4096);
+
+void rope_decode_std (benchmark::State& state)
+{
+    auto x = make_heads();
+    size_t position = 1000;
+    for (auto _ : state)
+    {
+        for (size_t h = 0; h < num_heads; ++h)
+        {
+            auto* x_head = x.data() + h * head_dim;
+            for (size_t i = 0; i < num_freqs; ++i)
+            {
+                const auto angle = (float) position * freqs[i] * 6.283185307f;
+                const auto c = std::cos (angle);
+                const auto s = std::sin (angle);
+                const auto x1 = x_head[i];
+                const auto x2 = x_head[i + num_freqs];
+                x_head[i] = x1 * c - x2 * s;
+                x_head[i + num_freqs] = x2 * c + x1 * s;
+            }
+        }
+        position++;
+        benchmark::DoNotOptimize (x.data());
+    }
+}
+BENCHMARK (rope_decode_std);
+
+template <math_approx::rope_layout layout>
+void rope_decode_approx (benchmark::State& state)
+{
+    auto x = make_heads();
+    std::vector<float> cos_row (num_freqs), sin_row (num_freqs);
+    size_t position = 1000;
+    for (auto _ : state)
+    {
+        math_approx::rope_angles (freqs.data(), cos_row.data(), sin_row.data(), num_freqs, position++);
+        math_approx::apply_rope<layout> (x.data(), cos_row.data(), sin_row.data(), head_dim, num_heads);
+        benchmark::DoNotOptimize (x.data());
+    }
+}
+BENCHMARK (rope_decode_approx<math_approx::rope_layout::split>);
+BENCHMARK (rope_decode_approx<math_approx::rope_layout::interleaved>);
+
+BENCHMARK_MAIN();
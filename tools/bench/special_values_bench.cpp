@@ -0,0 +1,74 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+
+static constexpr size_t N = 2000;
+static std::vector<float> make_data (float low, float high)
+{
+    std::vector<float> x (N);
+    for (size_t i = 0; i < N; ++i)
+        x[i] = low + (high - low) * (float) i / (float) N;
+    return x;
+}
+
+// inputs within each function's domain, so that only the cost of the policy is measured
+const auto exp_data = make_data (-20.0f, 20.0f);
+const auto log_data = make_data (0.01f, 100.0f);
+const auto unit_data = make_data (-0.99f, 0.99f);
+const auto acosh_data = make_data (1.0f, 100.0f);
+
+using math_approx::special_value_policy;
+static constexpr auto unchecked = special_value_policy::unchecked;
+static constexpr auto saturate = special_value_policy::saturate;
+static constexpr auto ieee = special_value_policy::ieee;
+
+#define SPECIAL_VALUES_BENCH(name, data, func) \
+void name (benchmark::State& state) \
+{ \
+for (auto _ : state) \
+{ \
+for (auto& x : data) \
+{ \
+auto y = func (x); \
+benchmark::DoNotOptimize (y); \
+} \
+} \
+} \
+BENCHMARK (name);
+
+#define SPECIAL_VALUES_SIMD_BENCH(name, data, func) \
+void name (benchmark::State& state) \
+{ \
+for (auto _ : state) \
+{ \
+for (auto& x : data) \
+{ \
+auto y = func (xsimd::broadcast (x)); \
+static_assert (std::is_same_v<xsimd::batch<float>, decltype(y)>); \
+benchmark::DoNotOptimize (y); \
+} \
+} \
+} \
+BENCHMARK (name);
+
+#define POLICY_BENCHES(BENCH, prefix, data, func, ...) \
+BENCH (prefix##_unchecked, data, (func<__VA_ARGS__ unchecked>)) \
+BENCH (prefix##_saturate, data, (func<__VA_ARGS__ saturate>)) \
+BENCH (prefix##_ieee, data, (func<__VA_ARGS__ ieee>))
+
+POLICY_BENCHES (SPECIAL_VALUES_BENCH, exp, exp_data, math_approx::exp, 5, false, true, float,)
+POLICY_BENCHES (SPECIAL_VALUES_BENCH, log, log_data, math_approx::log, 5, false, float,)
+POLICY_BENCHES (SPECIAL_VALUES_BENCH, asin, unit_data, math_approx::asin, 5, float,)
+POLICY_BENCHES (SPECIAL_VALUES_BENCH, sinh, exp_data, math_approx::sinh, 5, float,)
+POLICY_BENCHES (SPECIAL_VALUES_BENCH, tanh, exp_data, math_approx::tanh, 5, float,)
+POLICY_BENCHES (SPECIAL_VALUES_BENCH, acosh, acosh_data, math_approx::acosh, 5, float,)
+POLICY_BENCHES (SPECIAL_VALUES_BENCH, atanh, unit_data, math_approx::atanh, 5, float,)
+
+POLICY_BENCHES (SPECIAL_VALUES_SIMD_BENCH, exp_simd, exp_data, math_approx::exp, 5, false, true, xsimd::batch<float>,)
+POLICY_BENCHES (SPECIAL_VALUES_SIMD_BENCH, log_simd, log_data, math_approx::log, 5, false, xsimd::batch<float>,)
+POLICY_BENCHES (SPECIAL_VALUES_SIMD_BENCH, asin_simd, unit_data, math_approx::asin, 5, xsimd::batch<float>,)
+POLICY_BENCHES (SPECIAL_VALUES_SIMD_BENCH, sinh_simd, exp_data, math_approx::sinh, 5, xsimd::batch<float>,)
+POLICY_BENCHES (SPECIAL_VALUES_SIMD_BENCH, tanh_simd, exp_data, math_approx::tanh, 5, xsimd::batch<float>,)
+POLICY_BENCHES (SPECIAL_VALUES_SIMD_BENCH, acosh_simd, acosh_data, math_approx::acosh, 5, xsimd::batch<float>,)
+POLICY_BENCHES (SPECIAL_VALUES_SIMD_BENCH, atanh_simd, unit_data, math_approx::atanh, 5, xsimd::batch<float>,)
+
+BENCHMARK_MAIN();
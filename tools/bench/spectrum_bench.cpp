@@ -0,0 +1,77 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+
+static constexpr size_t N = 2048;
+
+static const auto spectrum_data = []
+{
+    std::vector<float> re_im (2 * N);
+    for (size_t i = 0; i < N; ++i)
+    {
+        const auto magnitude = std::pow (10.0f, -6.0f + 7.0f * (float) i / (float) N);
+        re_im[2 * i] = magnitude * std::cos (0.7f * (float) i);
+        re_im[2 * i + 1] = magnitude * std::sin (0.7f * (float) i);
+    }
+    return re_im;
+}();
+
+// separate passes: magnitude, then dB
+void complex_to_db_std (benchmark::State& state)
+{
+    std::vector<float> magnitude (N);
+    std::vector<float> db (N);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < N; ++i)
+            magnitude[i] = std::sqrt (spectrum_data[2 * i] * spectrum_data[2 * i] + spectrum_data[2 * i + 1] * spectrum_data[2 * i + 1]);
+        for (size_t i = 0; i < N; ++i)
+            db[i] = 20.0f * std::log10 (std::max (magnitude[i], 1.0e-6f));
+        benchmark::DoNotOptimize (db.data());
+    }
+}
+BENCHMARK (complex_to_db_std);
+
+void complex_to_db_approx (benchmark::State& state)
+{
+    std::vector<float> db (N);
+    for (auto _ : state)
+    {
+        math_approx::complex_to_db<4> (spectrum_data.data(), db.data(), N);
+        benchmark::DoNotOptimize (db.data());
+    }
+}
+BENCHMARK (complex_to_db_approx);
+
+void complex_to_db_phase_std (benchmark::State& state)
+{
+    std::vector<float> db (N);
+    std::vector<float> phase (N);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            const auto re = spectrum_data[2 * i];
+            const auto im = spectrum_data[2 * i + 1];
+            db[i] = 10.0f * std::log10 (std::max (re * re + im * im, 1.0e-12f));
+            phase[i] = std::atan2 (im, re);
+        }
+        benchmark::DoNotOptimize (db.data());
+        benchmark::DoNotOptimize (phase.data());
+    }
+}
+BENCHMARK (complex_to_db_phase_std);
+
+void complex_to_db_phase_approx (benchmark::State& state)
+{
+    std::vector<float> db (N);
+    std::vector<float> phase (N);
+    for (auto _ : state)
+    {
+        math_approx::complex_to_db<4, 5> (spectrum_data.data(), db.data(), phase.data(), N);
+        benchmark::DoNotOptimize (db.data());
+        benchmark::DoNotOptimize (phase.data());
+    }
+}
+BENCHMARK (complex_to_db_phase_approx);
+
+BENCHMARK_MAIN();
@@ -43,6 +43,11 @@ TRIG_BENCH (tan_approx7, math_approx::tan<7>)
 TRIG_BENCH (tan_approx5, math_approx::tan<5>)
 TRIG_BENCH (tan_approx3, math_approx::tan<3>)
 
+using math_approx::CodyWaiteTrigRangeReduction;
+TRIG_BENCH (sin_approx9_cody_waite, (math_approx::sin<9, float, CodyWaiteTrigRangeReduction>))
+TRIG_BENCH (cos_approx9_cody_waite, (math_approx::cos<9, float, CodyWaiteTrigRangeReduction>))
+TRIG_BENCH (tan_approx9_cody_waite, (math_approx::tan<9, float, CodyWaiteTrigRangeReduction>))
+
 #define TRIG_SIMD_BENCH(name, func) \
 void name (benchmark::State& state) \
 { \
@@ -76,4 +81,8 @@ TRIG_SIMD_BENCH (tan_simd_approx7, math_approx::tan<7>)
 TRIG_SIMD_BENCH (tan_simd_approx5, math_approx::tan<5>)
 TRIG_SIMD_BENCH (tan_simd_approx3, math_approx::tan<3>)
 
+TRIG_SIMD_BENCH (sin_simd_approx9_cody_waite, (math_approx::sin<9, xsimd::batch<float>, CodyWaiteTrigRangeReduction>))
+TRIG_SIMD_BENCH (cos_simd_approx9_cody_waite, (math_approx::cos<9, xsimd::batch<float>, CodyWaiteTrigRangeReduction>))
+TRIG_SIMD_BENCH (tan_simd_approx9_cody_waite, (math_approx::tan<9, xsimd::batch<float>, CodyWaiteTrigRangeReduction>))
+
 BENCHMARK_MAIN();
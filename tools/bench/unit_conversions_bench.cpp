@@ -0,0 +1,94 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+
+static constexpr size_t N = 2000;
+
+static const auto db_data = []
+{
+    std::vector<float> x (N);
+    for (size_t i = 0; i < N; ++i)
+        x[i] = -60.0f + 72.0f * (float) i / (float) N;
+    return x;
+}();
+
+static const auto gain_data = []
+{
+    std::vector<float> x (N);
+    for (size_t i = 0; i < N; ++i)
+        x[i] = 0.001f + 4.0f * (float) i / (float) N;
+    return x;
+}();
+
+static const auto midi_data = []
+{
+    std::vector<float> x (N);
+    for (size_t i = 0; i < N; ++i)
+        x[i] = 128.0f * (float) i / (float) N;
+    return x;
+}();
+
+static const auto hz_data = []
+{
+    std::vector<float> x (N);
+    for (size_t i = 0; i < N; ++i)
+        x[i] = 20.0f + 20000.0f * (float) i / (float) N;
+    return x;
+}();
+
+#define CONVERSION_BENCH(name, func, data) \
+void name (benchmark::State& state) \
+{ \
+for (auto _ : state) \
+{ \
+for (auto& x : data) \
+{ \
+auto y = func (x); \
+benchmark::DoNotOptimize (y); \
+} \
+} \
+} \
+BENCHMARK (name);
+
+// dB to gain
+CONVERSION_BENCH (db_to_gain_std, [] (float x) { return std::pow (10.0f, x / 20.0f); }, db_data)
+CONVERSION_BENCH (db_to_gain_composed, [] (float x) { return math_approx::exp10<6> (x * (1.0f / 20.0f)); }, db_data)
+CONVERSION_BENCH (db_to_gain_fused, [] (float x) { return math_approx::db_to_gain<6> (x); }, db_data)
+
+// gain to dB
+CONVERSION_BENCH (gain_to_db_std, [] (float x) { return 20.0f * std::log10 (x); }, gain_data)
+CONVERSION_BENCH (gain_to_db_composed, [] (float x) { return 20.0f * math_approx::log10<6> (x); }, gain_data)
+CONVERSION_BENCH (gain_to_db_fused, [] (float x) { return math_approx::gain_to_db<6> (x); }, gain_data)
+
+// MIDI to Hz
+CONVERSION_BENCH (midi_to_hz_std, [] (float x) { return 440.0f * std::exp2 ((x - 69.0f) * (1.0f / 12.0f)); }, midi_data)
+CONVERSION_BENCH (midi_to_hz_composed, [] (float x) { return 440.0f * math_approx::exp2<6> ((x - 69.0f) * (1.0f / 12.0f)); }, midi_data)
+CONVERSION_BENCH (midi_to_hz_fused, [] (float x) { return math_approx::midi_to_hz<6> (x); }, midi_data)
+
+// Hz to MIDI
+CONVERSION_BENCH (hz_to_midi_std, [] (float x) { return 69.0f + 12.0f * std::log2 (x * (1.0f / 440.0f)); }, hz_data)
+CONVERSION_BENCH (hz_to_midi_composed, [] (float x) { return 69.0f + 12.0f * math_approx::log2<6> (x * (1.0f / 440.0f)); }, hz_data)
+CONVERSION_BENCH (hz_to_midi_fused, [] (float x) { return math_approx::hz_to_midi<6> (x); }, hz_data)
+
+void db_to_gain_bulk (benchmark::State& state)
+{
+    std::vector<float> y (N);
+    for (auto _ : state)
+    {
+        math_approx::db_to_gain<6> (db_data.data(), y.data(), N);
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (db_to_gain_bulk);
+
+void midi_to_hz_bulk (benchmark::State& state)
+{
+    std::vector<float> y (N);
+    for (auto _ : state)
+    {
+        math_approx::midi_to_hz<6> (midi_data.data(), y.data(), N);
+        benchmark::DoNotOptimize (y.data());
+    }
+}
+BENCHMARK (midi_to_hz_bulk);
+
+BENCHMARK_MAIN();
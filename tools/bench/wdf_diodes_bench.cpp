@@ -0,0 +1,86 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+
+static constexpr size_t N = 2000;
+static constexpr float fs = 48000.0f;
+static constexpr float Is = 2.52e-9f;
+static constexpr float Vt = 25.85e-3f * 1.752f;
+
+static const auto data = []
+{
+    std::vector<float> x (N);
+    for (size_t n = 0; n < N; ++n)
+        x[n] = 5.0f * std::sin (2.0f * (float) M_PI * 500.0f * (float) n / fs);
+    return x;
+}();
+
+/** Wright-Omega using std::log and std::exp, with a few NR iterations */
+struct StdOmegaProvider
+{
+    static float omega (float x)
+    {
+        auto y = x < 1.0f ? std::exp (x) : x - std::log (x);
+        for (int i = 0; i < 3; ++i)
+            y = y - (y - std::exp (x - y)) / (y + 1.0f);
+        return y;
+    }
+};
+
+template <typename DiodePair>
+void diode_pair (benchmark::State& state)
+{
+    const DiodePair dp { 1000.0f, Is, Vt };
+    std::vector<float> b (N);
+    for (auto _ : state)
+    {
+        dp.reflected (data.data(), b.data(), N);
+        benchmark::DoNotOptimize (b.data());
+    }
+}
+BENCHMARK (diode_pair<math_approx::wdf_diode_pair<float, math_approx::diode_pair_quality::best, StdOmegaProvider>>);
+BENCHMARK (diode_pair<math_approx::wdf_diode_pair<float, math_approx::diode_pair_quality::best, math_approx::WrightOmegaProvider<1>>>);
+BENCHMARK (diode_pair<math_approx::wdf_diode_pair<float, math_approx::diode_pair_quality::best, math_approx::DAngeloOmegaProvider<1>>>);
+BENCHMARK (diode_pair<math_approx::wdf_diode_pair<float, math_approx::diode_pair_quality::good, StdOmegaProvider>>);
+BENCHMARK (diode_pair<math_approx::wdf_diode_pair<float, math_approx::diode_pair_quality::good, math_approx::WrightOmegaProvider<1>>>);
+BENCHMARK (diode_pair<math_approx::wdf_diode_pair<float, math_approx::diode_pair_quality::good, math_approx::DAngeloOmegaProvider<0>>>);
+
+template <typename Clipper>
+void diode_clipper (benchmark::State& state)
+{
+    Clipper clipper;
+    clipper.prepare (fs, 2200.0f, 10.0e-9f, Is, Vt);
+    auto x = data;
+    for (auto _ : state)
+    {
+        clipper.process_block (x.data(), N);
+        benchmark::DoNotOptimize (x.data());
+    }
+}
+BENCHMARK (diode_clipper<math_approx::wdf_diode_clipper<float, math_approx::diode_pair_quality::best, StdOmegaProvider>>);
+BENCHMARK (diode_clipper<math_approx::wdf_diode_clipper<float, math_approx::diode_pair_quality::best>>);
+BENCHMARK (diode_clipper<math_approx::wdf_diode_clipper<float, math_approx::diode_pair_quality::good>>);
+BENCHMARK (diode_clipper<math_approx::wdf_diode_clipper<float, math_approx::diode_pair_quality::good, math_approx::DAngeloOmegaProvider<0>>>);
+
+#if defined(XSIMD_HPP)
+template <typename Clipper>
+void diode_clipper_simd (benchmark::State& state)
+{
+    // one voice per SIMD lane
+    using B = xsimd::batch<float>;
+    std::vector<B> x (N);
+    for (size_t n = 0; n < N; ++n)
+        x[n] = B (data[n]);
+
+    Clipper clipper;
+    clipper.prepare (B (fs), B (2200.0f), B (10.0e-9f), B (Is), B (Vt));
+    for (auto _ : state)
+    {
+        clipper.process_block (x.data(), N);
+        benchmark::DoNotOptimize (x.data());
+    }
+}
+BENCHMARK (diode_clipper_simd<math_approx::wdf_diode_clipper<xsimd::batch<float>, math_approx::diode_pair_quality::best>>);
+BENCHMARK (diode_clipper_simd<math_approx::wdf_diode_clipper<xsimd::batch<float>, math_approx::diode_pair_quality::good>>);
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,86 @@
+#include <math_approx/math_approx.hpp>
+#include <benchmark/benchmark.h>
+
+void hann_std (benchmark::State& state)
+{
+    const auto N = (size_t) state.range (0);
+    std::vector<float> w (N);
+    for (auto _ : state)
+    {
+        for (size_t n = 0; n < N; ++n)
+            w[n] = 0.5f - 0.5f * std::cos (2.0f * (float) M_PI * (float) n / (float) (N - 1));
+        benchmark::DoNotOptimize (w.data());
+    }
+}
+BENCHMARK (hann_std)->RangeMultiplier (8)->Range (512, 65536);
+
+template <int order>
+void hann_approx (benchmark::State& state)
+{
+    const auto N = (size_t) state.range (0);
+    std::vector<float> w (N);
+    for (auto _ : state)
+    {
+        math_approx::hann_window<order> (w.data(), N);
+        benchmark::DoNotOptimize (w.data());
+    }
+}
+BENCHMARK (hann_approx<9>)->RangeMultiplier (8)->Range (512, 65536);
+BENCHMARK (hann_approx<7>)->RangeMultiplier (8)->Range (512, 65536);
+
+void blackman_harris_std (benchmark::State& state)
+{
+    const auto N = (size_t) state.range (0);
+    std::vector<float> w (N);
+    for (auto _ : state)
+    {
+        for (size_t n = 0; n < N; ++n)
+        {
+            const auto t = 2.0f * (float) M_PI * (float) n / (float) (N - 1);
+            w[n] = 0.35875f - 0.48829f * std::cos (t) + 0.14128f * std::cos (2.0f * t) - 0.01168f * std::cos (3.0f * t);
+        }
+        benchmark::DoNotOptimize (w.data());
+    }
+}
+BENCHMARK (blackman_harris_std)->RangeMultiplier (8)->Range (512, 65536);
+
+template <int order>
+void blackman_harris_approx (benchmark::State& state)
+{
+    const auto N = (size_t) state.range (0);
+    std::vector<float> w (N);
+    for (auto _ : state)
+    {
+        math_approx::blackman_harris_window<order> (w.data(), N);
+        benchmark::DoNotOptimize (w.data());
+    }
+}
+BENCHMARK (blackman_harris_approx<9>)->RangeMultiplier (8)->Range (512, 65536);
+
+template <int order>
+void flat_top_approx (benchmark::State& state)
+{
+    const auto N = (size_t) state.range (0);
+    std::vector<float> w (N);
+    for (auto _ : state)
+    {
+        math_approx::flat_top_window<order> (w.data(), N);
+        benchmark::DoNotOptimize (w.data());
+    }
+}
+BENCHMARK (flat_top_approx<9>)->RangeMultiplier (8)->Range (512, 65536);
+
+template <int order>
+void tukey_approx (benchmark::State& state)
+{
+    const auto N = (size_t) state.range (0);
+    std::vector<float> w (N);
+    for (auto _ : state)
+    {
+        math_approx::tukey_window<order> (w.data(), N, 0.5f);
+        benchmark::DoNotOptimize (w.data());
+    }
+}
+BENCHMARK (tukey_approx<9>)->RangeMultiplier (8)->Range (512, 65536);
+
+BENCHMARK_MAIN();